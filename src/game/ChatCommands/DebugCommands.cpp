@@ -1064,6 +1064,33 @@ bool ChatHandler::HandleDebugArenaCommand(char* /*args*/)
     return true;
 }
 
+/**
+ * @brief Shows the DB script schedule of the player's map.
+ *
+ * @param args Command arguments (unused).
+ * @returns True if the command executed successfully, false otherwise.
+ */
+bool ChatHandler::HandleDebugDbScriptsCommand(char* /*args*/)
+{
+    Player* player = m_session ? m_session->GetPlayer() : NULL;
+    if (!player)
+    {
+        SendSysMessage("This command requires an in-game player.");
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    Map* map = player->GetMap();
+    ScriptSchedule<ScriptAction>::Stats const& stats = map->GetScriptScheduleStats();
+
+    PSendSysMessage("DB script steps for map %u:", player->GetMapId());
+    PSendSysMessage("  queued now=%u peak=%u", uint32(map->GetScheduledScriptStepCount()), stats.peak);
+    PSendSysMessage("  scheduled=" UI64FMTD " run=" UI64FMTD " cancelled=" UI64FMTD " duplicate starts skipped=" UI64FMTD,
+                    stats.scheduled, stats.run, stats.cancelled, map->GetDuplicateScriptStartCount());
+
+    return true;
+}
+
 /**
  * @brief Handler for HandleDebugSpellCheckCommand command.
  *
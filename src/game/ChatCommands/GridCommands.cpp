@@ -47,6 +47,7 @@
 #include "ObjectMgr.h"
 #include "Creature.h"
 #include "GridDefines.h"
+#include "World.h"
 
 #include <algorithm>
 #include <map>
@@ -335,3 +336,32 @@ bool ChatHandler::HandleGridLwStatsCommand(char* /*args*/)
 
     return true;
 }
+
+/**
+ * @brief .grid ticks
+ *
+ * Prints how many cells Map::Update ticked and how many it skipped as asleep on the
+ * player's current map, and how many are asleep now.
+ */
+bool ChatHandler::HandleGridTicksCommand(char* /*args*/)
+{
+    Player* player = m_session ? m_session->GetPlayer() : NULL;
+    if (!player)
+    {
+        SendSysMessage("This command requires an in-game player.");
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    Map* map = player->GetMap();
+    Map::CellTickStats const& stats = map->GetCellTickStats();
+    uint64 total = stats.visited + stats.skipped;
+
+    PSendSysMessage("Cell updates for map %u:", player->GetMapId());
+    PSendSysMessage("  visited=" UI64FMTD " skipped=" UI64FMTD " (%.1f%% skipped)",
+                    stats.visited, stats.skipped, total ? 100.0 * stats.skipped / total : 0.0);
+    PSendSysMessage("  asleep now=%u (limit %u ms)",
+                    map->GetSleepingCellCount(), sWorld.getConfig(CONFIG_UINT32_MAP_IDLE_CELL_SLEEP));
+
+    return true;
+}
@@ -43,8 +43,13 @@
 #include "SystemConfig.h"
 #include "BattleGroundMgr.h"
 #include "UpdateTime.h"
+#include "TickStats.h"
+#include "Trace.h"
 #include "MapPersistentStateMgr.h"
+#include "MapManager.h"
 #include "CorpseManager.h"
+#include "DatabaseEnv.h"
+#include "SavedRowTracker.h"
 #include "revision_data.h"
 
 /**
@@ -93,6 +98,14 @@ bool ChatHandler::HandleServerInfoCommand(char* /*args*/)
     PSendSysMessage(LANG_UPTIME, str.c_str());
     PSendSysMessage("World Delay: %u", updateTime); // ToDo: move to language string
 
+    PacketBufferPool::Stats buffers = PacketBufferPool::GetStats();
+    PSendSysMessage("Packet buffers: %u system allocations last tick, " UI64FMTD " since startup, " UI64FMTD " oversized",
+                    sWorld.GetPacketBufferAllocationsLastTick(), buffers.systemAllocations, buffers.oversized);
+
+    GridPreloader::Stats preload = sMapMgr.GetGridPreloader().GetStats();
+    PSendSysMessage("Grid preload: " UI64FMTD " grids requested, " UI64FMTD " prepared, " UI64FMTD " dropped",
+                    preload.requested, preload.prepared, preload.dropped);
+
     return true;
 }
 
@@ -349,6 +362,178 @@ bool ChatHandler::HandleServerCorpsesCommand(char* /*args*/)
     return true;
 }
 
+/**
+ * @brief Handler for HandleServerDbStatsCommand command.
+ *
+ * Reports how well the async writers batch: COMMITs sent, transactions and
+ * statements per COMMIT, and rows merged into multi-row INSERTs.
+ *
+ * @param args Command arguments.
+ * @returns True if the command executed successfully, false otherwise.
+ */
+bool ChatHandler::HandleServerDbStatsCommand(char* /*args*/)
+{
+    struct
+    {
+        char const* name;
+        Database* db;
+    } const databases[] =
+    {
+        { "Character", &CharacterDatabase },
+        { "World",     &WorldDatabase     },
+        { "Login",     &LoginDatabase     },
+    };
+
+    for (size_t i = 0; i < sizeof(databases) / sizeof(databases[0]); ++i)
+    {
+        Database::CommitStats stats = databases[i].db->GetCommitStats();
+        double commits = stats.commits ? double(stats.commits) : 1.0;
+        PSendSysMessage("%s DB: " UI64FMTD " commits, %.2f transactions/commit, %.2f statements/commit, " UI64FMTD " rows merged",
+                        databases[i].name, stats.commits, stats.transactions / commits, stats.statements / commits, stats.rowsMerged);
+    }
+
+    PSendSysMessage("Player saves: " UI64FMTD " unchanged rows skipped", uint64(SavedRowsSkipped().load()));
+
+    return true;
+}
+
+/**
+ * @brief Handler for HandleServerTickStatsCommand command.
+ *
+ * Shows where the world update and the busiest map instances spent their time
+ * over the last full statistics window, phase by phase.
+ *
+ * @param args Optional number of map instances to show (default 5).
+ * @returns True if the command executed successfully, false otherwise.
+ */
+bool ChatHandler::HandleServerTickStatsCommand(char* args)
+{
+    uint32 count;
+    if (!ExtractOptUInt32(&args, count, 5))
+    {
+        return false;
+    }
+
+    uint32 seconds;
+    std::vector<TickStatsEntry> window = sTickStats.GetLastWindow(seconds);
+    if (window.empty())
+    {
+        SendSysMessage("No tick statistics yet, the first window closes a minute after startup.");
+        return true;
+    }
+
+    uint32 instances = 0;
+    for (std::vector<TickStatsEntry>::const_iterator itr = window.begin(); itr != window.end(); ++itr)
+    {
+        instances += itr->mapId != TICK_STATS_WORLD ? 1 : 0;
+    }
+    PSendSysMessage("Tick time over the last %u s, %u map instances updated:", seconds, instances);
+
+    uint32 maps = 0;
+    for (std::vector<TickStatsEntry>::const_iterator itr = window.begin(); itr != window.end(); ++itr)
+    {
+        bool world = itr->mapId == TICK_STATS_WORLD;
+        if (!world && maps++ >= count)
+        {
+            continue;
+        }
+
+        TickPhase first = world ? TICK_PHASE_WORLD_TIMERS : TICK_PHASE_MAP_SESSIONS;
+        TickPhase total = world ? TICK_PHASE_WORLD_TOTAL : TICK_PHASE_MAP_TOTAL;
+        TickHistogram const& updates = itr->phases[total];
+
+        if (world)
+        {
+            SendSysMessage("World:");
+        }
+        else
+        {
+            PSendSysMessage("Map %u instance %u:", itr->mapId, itr->instanceId);
+        }
+        PSendSysMessage("  " UI64FMTD " updates, avg %u us, p50 <= %u us, p99 <= %u us, max %u us",
+                        updates.GetCount(), updates.GetAverage(), updates.GetPercentile(50), updates.GetPercentile(99), updates.GetMax());
+
+        for (uint32 i = first; i < uint32(total); ++i)
+        {
+            TickHistogram const& phase = itr->phases[i];
+            if (!phase.GetCount())
+            {
+                continue;
+            }
+
+            PSendSysMessage("  %-14s %3u%%  avg %u us, p99 <= %u us, max %u us",
+                            GetTickPhaseName(TickPhase(i)), updates.GetTotal() ? uint32(phase.GetTotal() * 100 / updates.GetTotal()) : 0,
+                            phase.GetAverage(), phase.GetPercentile(99), phase.GetMax());
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Handler for HandleServerTraceOnCommand command.
+ *
+ * Starts recording the in-memory trace of the server threads.
+ *
+ * @param args Command arguments.
+ * @returns True if the command executed successfully, false otherwise.
+ */
+bool ChatHandler::HandleServerTraceOnCommand(char* /*args*/)
+{
+    Trace::SetEnabled(true);
+    SendSysMessage("Tracing is on.");
+    return true;
+}
+
+/**
+ * @brief Handler for HandleServerTraceOffCommand command.
+ *
+ * Stops recording; what was recorded stays available to .server trace dump.
+ *
+ * @param args Command arguments.
+ * @returns True if the command executed successfully, false otherwise.
+ */
+bool ChatHandler::HandleServerTraceOffCommand(char* /*args*/)
+{
+    Trace::SetEnabled(false);
+    SendSysMessage("Tracing is off.");
+    return true;
+}
+
+/**
+ * @brief Handler for HandleServerTraceDumpCommand command.
+ *
+ * Writes the trace as Chrome trace_event JSON to trace-<time>.json in the logs
+ * directory.
+ *
+ * @param args Optional number of seconds to write, counted back from now (default: all recorded).
+ * @returns True if the command executed successfully, false otherwise.
+ */
+bool ChatHandler::HandleServerTraceDumpCommand(char* args)
+{
+    uint32 seconds;
+    if (!ExtractOptUInt32(&args, seconds, 0))
+    {
+        return false;
+    }
+
+    char name[64];
+    snprintf(name, sizeof(name), "trace-%u.json", uint32(time(NULL)));
+    std::string path = sLog.GetLogsDir() + name;
+
+    int32 events = Trace::DumpChromeTrace(path, seconds * IN_MILLISECONDS);
+    if (events < 0)
+    {
+        PSendSysMessage("Could not write %s.", path.c_str());
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    PSendSysMessage("Trace written to %s (%d events)%s", path.c_str(), events,
+                    Trace::IsEnabled() ? "" : ", tracing is off");
+    return true;
+}
+
 /**
  * @brief Handler for HandleServerResetAllRaidCommand command.
  *
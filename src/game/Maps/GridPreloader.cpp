@@ -0,0 +1,210 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file GridPreloader.cpp
+ * @brief Implementation of the background grid prepare pool.
+ */
+
+#include "GridPreloader.h"
+
+#include "GridMap.h"
+#include "terrain/GoModelStore.hpp"
+
+#include "Trace.h"
+
+#include <algorithm>
+
+/// More than this many grids waiting means the players outrun the disk; further
+/// requests are dropped and those grids load the old way.
+static const size_t MAX_QUEUED_GRIDS = 64;
+
+GridPreloader::GridPreloader()
+    : m_stop(false)
+{
+    m_stats.requested = 0;
+    m_stats.prepared = 0;
+    m_stats.dropped = 0;
+}
+
+GridPreloader::~GridPreloader()
+{
+    deactivate();
+}
+
+int GridPreloader::activate(size_t num_threads)
+{
+    if (num_threads == 0 || activated())
+    {
+        return -1;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_stop = false;
+    }
+
+    m_workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        m_workers.emplace_back([this] { workerLoop(); });
+    }
+
+    return 0;
+}
+
+int GridPreloader::deactivate()
+{
+    if (!activated())
+    {
+        return 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        // unlike a map update, a prepare left undone loses nothing
+        m_stats.dropped += m_jobs.size();
+        m_jobs.clear();
+        m_stop = true;
+    }
+    m_jobAdded.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+
+    return 0;
+}
+
+bool GridPreloader::activated()
+{
+    return !m_workers.empty();
+}
+
+bool GridPreloader::schedule(TerrainInfo const* terrain, uint32 tileX, uint32 tileY, std::vector<uint32>&& displayIds)
+{
+    std::unique_lock<std::mutex> guard(m_mutex);
+
+    if (m_stop || m_workers.empty())
+    {
+        return false;
+    }
+
+    // instances of one dungeon share their terrain, and may ask for the same grid
+    for (Job const& job : m_jobs)
+    {
+        if (job.terrain == terrain && job.tileX == tileX && job.tileY == tileY)
+        {
+            return true;
+        }
+    }
+
+    if (m_jobs.size() >= MAX_QUEUED_GRIDS)
+    {
+        ++m_stats.dropped;
+        return false;
+    }
+
+    Job job;
+    job.terrain = terrain;
+    job.tileX = tileX;
+    job.tileY = tileY;
+    job.displayIds = std::move(displayIds);
+    m_jobs.push_back(std::move(job));
+    ++m_stats.requested;
+
+    guard.unlock();
+    m_jobAdded.notify_one();
+
+    return true;
+}
+
+void GridPreloader::forget(TerrainInfo const* terrain)
+{
+    std::unique_lock<std::mutex> guard(m_mutex);
+
+    size_t queued = m_jobs.size();
+    m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(), [terrain](Job const& job) { return job.terrain == terrain; }), m_jobs.end());
+    m_stats.dropped += queued - m_jobs.size();
+
+    m_jobDone.wait(guard, [this, terrain] { return std::find(m_running.begin(), m_running.end(), terrain) == m_running.end(); });
+}
+
+GridPreloader::Stats GridPreloader::GetStats()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_stats;
+}
+
+void GridPreloader::workerLoop()
+{
+    Trace::SetThreadName("grid preloader");
+
+    for (;;)
+    {
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> guard(m_mutex);
+
+            m_jobAdded.wait(guard, [this] { return m_stop || !m_jobs.empty(); });
+
+            if (m_stop)
+            {
+                return;
+            }
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+            m_running.push_back(job.terrain);
+        }
+
+        {
+            TRACE_SCOPE("grid preload");
+
+            // The terrain tile first: every query in the grid needs it, while a game
+            // object without collision geometry needs nothing.
+            job.terrain->Prefetch(job.tileX, job.tileY);
+
+            for (uint32 displayId : job.displayIds)
+            {
+                world::terrain::GoModelStore::Instance().Get(displayId);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_running.erase(std::find(m_running.begin(), m_running.end(), job.terrain));
+            ++m_stats.prepared;
+        }
+
+        m_jobDone.notify_all();
+    }
+}
@@ -0,0 +1,129 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file GridPreloader.h
+ * @brief Background pool that prepares grids before a player walks into them.
+ *
+ * Loading a grid used to do everything on the map thread at the moment a player
+ * crossed into it: read the terrain tile from disk, read the collision model of
+ * every game object display in it, then build the creatures and game objects.
+ * The reads are what hitch, and none of them needs the map. A map now hands the
+ * grids ahead of its moving players to this pool, which does the reads into the
+ * shared caches (FusedTerrain, GoModelStore); the load itself -- the commit --
+ * stays on the map thread, and by then only finds warm caches.
+ *
+ * Preparing is only ever ahead of time. A grid that is loaded before its job has
+ * run simply loads the old way, and a job for a grid nobody came to costs a tile
+ * the cache sweep will age out.
+ */
+
+#ifndef MANGOS_H_GRIDPRELOADER
+#define MANGOS_H_GRIDPRELOADER
+
+#include "Platform/Define.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class TerrainInfo;
+
+class GridPreloader
+{
+    public:
+        /// Counters since startup, for .server info.
+        struct Stats
+        {
+            uint64 requested;                               ///< grids handed to the pool
+            uint64 prepared;                                ///< of those, finished
+            uint64 dropped;                                 ///< refused: queue full, or forgotten
+        };
+
+        GridPreloader();
+        ~GridPreloader();
+
+        GridPreloader(const GridPreloader&) = delete;
+        GridPreloader& operator=(const GridPreloader&) = delete;
+
+        /**
+         * @brief Start @p num_threads workers.
+         * @return 0 on success, -1 on failure.
+         */
+        int activate(size_t num_threads);
+
+        /**
+         * @brief Drop whatever is still queued, then stop and join the workers.
+         * @return Always 0.
+         */
+        int deactivate();
+
+        /// True while worker threads are running.
+        bool activated();
+
+        /**
+         * @brief Queue the prepare phase of one grid.
+         *
+         * @param terrain the map's terrain; it must be passed to forget() before
+         *                it goes away
+         * @param tileX grid index in TerrainInfo coordinates
+         * @param tileY grid index in TerrainInfo coordinates
+         * @param displayIds game object display ids spawned in the grid
+         * @return false if the pool is not running or its queue is full
+         */
+        bool schedule(TerrainInfo const* terrain, uint32 tileX, uint32 tileY, std::vector<uint32>&& displayIds);
+
+        /// Drop the queued jobs on @p terrain and wait for a running one to finish.
+        void forget(TerrainInfo const* terrain);
+
+        Stats GetStats();
+
+    private:
+        struct Job
+        {
+            TerrainInfo const* terrain;
+            uint32 tileX;
+            uint32 tileY;
+            std::vector<uint32> displayIds;
+        };
+
+        void workerLoop();
+
+        std::vector<std::thread> m_workers;
+        std::deque<Job>          m_jobs;
+        std::vector<TerrainInfo const*> m_running;          ///< terrain of each job being run
+
+        std::mutex              m_mutex;                    ///< Guards everything below m_workers
+        std::condition_variable m_jobAdded;                 ///< Wakes a worker when work arrives
+        std::condition_variable m_jobDone;                  ///< Wakes forget() when a job ends
+
+        Stats m_stats;
+        bool  m_stop;                                       ///< Set by deactivate() to retire the workers
+};
+
+#endif
@@ -33,6 +33,7 @@
 #include "Map.h"
 #include "Database/DatabaseEnv.h"
 #include "Log.h"
+#include "Trace.h"
 #include <mutex>
 #include <thread>
 
@@ -107,16 +108,26 @@ bool MapUpdater::activated()
 }
 
 int MapUpdater::schedule_update(Map& map, uint32 diff)
+{
+    if (schedule([&map, diff] { map.Update(diff); }) != 0)
+    {
+        sLog.outError("MapUpdater::schedule_update: pool is not running, map %u not updated", map.GetId());
+        return -1;
+    }
+
+    return 0;
+}
+
+int MapUpdater::schedule(std::function<void()> task)
 {
     std::unique_lock<std::mutex> guard(m_mutex);
 
     if (m_stop || m_workers.empty())
     {
-        sLog.outError("MapUpdater::schedule_update: pool is not running, map %u not updated", map.GetId());
         return -1;
     }
 
-    m_tasks.push(Task(&map, diff));
+    m_tasks.push(std::move(task));
     ++m_pending;
 
     guard.unlock();
@@ -141,10 +152,11 @@ void MapUpdater::workerLoop()
     // other. They never did -- and MapUpdateThreads defaults to 2, so this
     // ran unregistered in the default configuration.
     DbThreadGuard dbThread(&WorldDatabase);
+    Trace::SetThreadName("map worker");
 
     for (;;)
     {
-        Task task(nullptr, 0);
+        Task task;
 
         {
             std::unique_lock<std::mutex> guard(m_mutex);
@@ -163,11 +175,14 @@ void MapUpdater::workerLoop()
                 continue;
             }
 
-            task = m_tasks.front();
+            task = std::move(m_tasks.front());
             m_tasks.pop();
         }
 
-        task.first->Update(task.second);
+        {
+            TRACE_SCOPE("map worker task");
+            task();
+        }
 
         {
             std::lock_guard<std::mutex> guard(m_mutex);
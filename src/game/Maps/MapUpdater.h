@@ -29,7 +29,8 @@
  *
  * The world thread hands each map's Update() to this pool via
  * schedule_update(), then blocks in wait() until the whole tick has been
- * processed.
+ * processed. Other phases of the world tick that can be split up borrow the
+ * same threads through schedule().
  */
 
 #ifndef _MAP_UPDATER_H_INCLUDED
@@ -39,6 +40,7 @@
 
 #include <condition_variable>
 #include <cstddef>
+#include <functional>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -66,6 +68,15 @@ class MapUpdater
          */
         int schedule_update(Map& map, uint32 diff);
 
+        /**
+         * @brief Queue any other piece of tick work for a worker.
+         *
+         * wait() covers it like a map update.
+         *
+         * @return 0 on success, -1 if the pool is not running.
+         */
+        int schedule(std::function<void()> task);
+
         /**
          * @brief Block until every scheduled update has finished.
          *
@@ -93,8 +104,8 @@ class MapUpdater
 
     private:
 
-        /// One queued map tick.
-        typedef std::pair<Map*, uint32> Task;
+        /// One queued map tick, or other piece of tick work.
+        typedef std::function<void()> Task;
 
         /// Worker body: run tasks until stopped and the queue has drained.
         void workerLoop();
@@ -631,6 +631,7 @@ void MotionMaster::Mutate(MovementGenerator* m)
 
     m->Initialize(*m_owner);
     push(m);
+    m_owner->WakeUpdateCell();
 }
 
 /**
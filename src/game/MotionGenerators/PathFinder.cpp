@@ -36,6 +36,7 @@
 #include "Player.h"
 #include "PathFinder.h"
 #include "Log.h"
+#include "Trace.h"
 
 ////////////////// PathFinder //////////////////
 
@@ -104,6 +105,8 @@ bool PathFinder::calculate(float destX, float destY, float destZ, bool forceDest
  */
 bool PathFinder::calculate(float startX, float startY, float startZ, float destX, float destY, float destZ, bool forceDest)
 {
+    TRACE_SCOPE("path");
+
     if (!MaNGOS::IsValidMapCoord(startX, startY, startZ) ||
         !MaNGOS::IsValidMapCoord(destX, destY, destZ))
     {
@@ -176,6 +176,18 @@ void AggressorAI::UpdateAI(const uint32 /*diff*/)
     DoMeleeAttackIfReady();
 }
 
+/**
+ * @brief Checks whether UpdateAI has anything to do.
+ *
+ * Aggro comes from MoveInLineOfSight, not from here; out of combat there is nothing to tick.
+ *
+ * @return true while the creature is out of combat.
+ */
+bool AggressorAI::IsIdle() const
+{
+    return !m_creature->IsInCombat();
+}
+
 /**
  * @brief Checks whether a unit can be seen by this creature AI.
  *
@@ -51,6 +51,7 @@ class AggressorAI : public CreatureAI
         bool CanIgnoreForRelocationNotify(Unit*) const override;
 
         void UpdateAI(const uint32) override;
+        bool IsIdle() const override;
         static int Permissible(const Creature*);
 
     private:
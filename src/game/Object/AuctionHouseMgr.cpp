@@ -24,6 +24,7 @@
  */
 
 #include "Utilities/Errors.h"
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -94,6 +95,40 @@ AuctionHouseObject* AuctionHouseMgr::GetAuctionsMap(AuctionHouseEntry const* hou
     }
 }
 
+/**
+ * @brief Returns an item's name in a locale, prepared for auction browsing.
+ *
+ * Browsing used to convert and lower-case the name of every auction on every search
+ * and every comparison of a sort by name; the names are fixed once loaded, so each is
+ * converted the first time it is asked for and kept.
+ *
+ * @param proto The item prototype.
+ * @param locale The DB locale index, -1 for the default locale.
+ * @return The cached names.
+ */
+AuctionItemName const& AuctionHouseMgr::GetItemName(ItemPrototype const* proto, int32 locale)
+{
+    size_t slot = size_t(locale + 1);
+    if (slot >= mItemNames.size())
+    {
+        mItemNames.resize(slot + 1);
+    }
+
+    std::pair<ItemNameMap::iterator, bool> result = mItemNames[slot].insert(ItemNameMap::value_type(proto->ItemId, AuctionItemName()));
+    AuctionItemName& name = result.first->second;
+    if (result.second)
+    {
+        std::string utf8 = proto->Name1;
+        sObjectMgr.GetItemLocaleStrings(proto->ItemId, locale, &utf8);
+
+        name.valid = Utf8toWStr(utf8, name.name);
+        name.lower = name.name;
+        wstrToLower(name.lower);
+    }
+
+    return name;
+}
+
 
 
 /**
@@ -707,6 +742,7 @@ void AuctionHouseObject::Update()
 
                 itr->second->DeleteFromDB();
                 MANGOS_ASSERT(!itr->second->itemGuidLow);   // already removed or send in mail at won
+                UnindexAuction(itr->second);
                 delete itr->second;
                 AuctionsMap.erase(itr++);
                 continue;
@@ -727,6 +763,7 @@ void AuctionHouseObject::Update()
                     sAuctionMgr.SendAuctionExpiredMail(itr->second);
 
                     itr->second->DeleteFromDB();
+                    UnindexAuction(itr->second);
                     delete itr->second;
                     AuctionsMap.erase(itr++);
                     continue;
@@ -738,6 +775,143 @@ void AuctionHouseObject::Update()
     }
 }
 
+/**
+ * @brief Adds an auction to the browse index.
+ *
+ * @param auction The auction, already in AuctionsMap.
+ */
+void AuctionHouseObject::IndexAuction(AuctionEntry* auction)
+{
+    AuctionEntryList& list = m_auctionsByItem[auction->itemTemplate];
+    list.push_back(auction);
+
+    if (list.size() == 1)
+    {
+        if (ItemPrototype const* proto = ObjectMgr::GetItemPrototype(auction->itemTemplate))
+        {
+            m_itemsByCategory[CategoryKey(proto->Class, proto->SubClass)].insert(proto->ItemId);
+        }
+    }
+}
+
+/**
+ * @brief Removes an auction from the browse index.
+ *
+ * @param auction The auction, still in AuctionsMap.
+ */
+void AuctionHouseObject::UnindexAuction(AuctionEntry* auction)
+{
+    AuctionsByItemMap::iterator itr = m_auctionsByItem.find(auction->itemTemplate);
+    if (itr == m_auctionsByItem.end())
+    {
+        return;
+    }
+
+    AuctionEntryList& list = itr->second;
+    AuctionEntryList::iterator found = std::find(list.begin(), list.end(), auction);
+    if (found == list.end())
+    {
+        return;
+    }
+
+    *found = list.back();
+    list.pop_back();
+
+    if (!list.empty())
+    {
+        return;
+    }
+
+    m_auctionsByItem.erase(itr);
+
+    if (ItemPrototype const* proto = ObjectMgr::GetItemPrototype(auction->itemTemplate))
+    {
+        ItemsByCategoryMap::iterator category = m_itemsByCategory.find(CategoryKey(proto->Class, proto->SubClass));
+        if (category != m_itemsByCategory.end())
+        {
+            category->second.erase(proto->ItemId);
+            if (category->second.empty())
+            {
+                m_itemsByCategory.erase(category);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Collects the auctions whose item passes a browse filter.
+ *
+ * @param filter The item filters of the search.
+ * @param auctions Receives the matching auctions, in no particular order.
+ */
+void AuctionHouseObject::GetBrowseCandidates(AuctionBrowseFilter const& filter, std::vector<AuctionEntry*>& auctions) const
+{
+    ItemsByCategoryMap::const_iterator begin = m_itemsByCategory.begin();
+    ItemsByCategoryMap::const_iterator end = m_itemsByCategory.end();
+
+    if (filter.itemClass != 0xffffffff)
+    {
+        if (filter.itemSubClass != 0xffffffff)
+        {
+            begin = m_itemsByCategory.lower_bound(CategoryKey(filter.itemClass, filter.itemSubClass));
+            end = m_itemsByCategory.upper_bound(CategoryKey(filter.itemClass, filter.itemSubClass));
+        }
+        else
+        {
+            begin = m_itemsByCategory.lower_bound(CategoryKey(filter.itemClass, 0));
+            end = m_itemsByCategory.lower_bound(CategoryKey(filter.itemClass + 1, 0));
+        }
+    }
+
+    for (ItemsByCategoryMap::const_iterator category = begin; category != end; ++category)
+    {
+        // a subclass filter without a class filter is unusual; the range cannot serve it
+        if (filter.itemSubClass != 0xffffffff && (category->first & 0xFFFF) != filter.itemSubClass)
+        {
+            continue;
+        }
+
+        for (std::set<uint32>::const_iterator entry = category->second.begin(); entry != category->second.end(); ++entry)
+        {
+            ItemPrototype const* proto = ObjectMgr::GetItemPrototype(*entry);
+            if (!proto)
+            {
+                continue;
+            }
+
+            if (filter.inventoryType != 0xffffffff && proto->InventoryType != filter.inventoryType)
+            {
+                continue;
+            }
+
+            if (filter.quality != 0xffffffff && proto->Quality < filter.quality)
+            {
+                continue;
+            }
+
+            if (filter.levelMin != 0x00 && (proto->RequiredLevel < filter.levelMin || (filter.levelMax != 0x00 && proto->RequiredLevel > filter.levelMax)))
+            {
+                continue;
+            }
+
+            if (!filter.name.empty())
+            {
+                AuctionItemName const& name = sAuctionMgr.GetItemName(proto, filter.locale);
+                if (!name.valid || name.lower.find(filter.name) == std::wstring::npos)
+                {
+                    continue;
+                }
+            }
+
+            AuctionsByItemMap::const_iterator list = m_auctionsByItem.find(*entry);
+            if (list != m_auctionsByItem.end())
+            {
+                auctions.insert(auctions.end(), list->second.begin(), list->second.end());
+            }
+        }
+    }
+}
+
 /**
  * @brief Builds the list of auctions the player is currently bidding on.
  *
@@ -892,16 +1066,7 @@ int AuctionEntry::CompareAuctionEntry(uint32 column, const AuctionEntry* auc, Pl
 
             int32 loc_idx = viewPlayer->GetSession()->GetSessionDbLocaleIndex();
 
-            std::string name1 = itemProto1->Name1;
-            sObjectMgr.GetItemLocaleStrings(itemProto1->ItemId, loc_idx, &name1);
-
-            std::string name2 = itemProto2->Name1;
-            sObjectMgr.GetItemLocaleStrings(itemProto2->ItemId, loc_idx, &name2);
-
-            std::wstring wname1, wname2;
-            Utf8toWStr(name1, wname1);
-            Utf8toWStr(name2, wname2);
-            return wname1.compare(wname2);
+            return sAuctionMgr.GetItemName(itemProto1, loc_idx).name.compare(sAuctionMgr.GetItemName(itemProto2, loc_idx).name);
         }
         case 6:                                             // minbidbuyout = 6
         {
@@ -1007,28 +1172,29 @@ bool AuctionSorter::operator()(const AuctionEntry* auc1, const AuctionEntry* auc
     return false;                                           // "equal" by all sorts
 }
 
+/// Auctions sent per page of a browse; the client asks for the next page by offset.
+static const uint32 AUCTION_BROWSE_PAGE_SIZE = 50;
+
 /**
- * @brief Builds the filtered public auction browse list.
+ * @brief Builds one page of the public auction browse list.
  *
+ * The auctions come from AuctionHouseObject::GetBrowseCandidates, already filtered by
+ * item. Only what is left -- pending sales, missing items, usability -- is checked
+ * here, and only the auctions up to the end of the requested page are sorted.
+ *
+ * @param auctions The candidates; filtered and reordered in place.
+ * @param sorter The sort the client asked for.
  * @param data The packet buffer to append to.
- * @param player The player requesting the list.
- * @param wsearchedname The search string in wide-character form.
  * @param listfrom The starting result offset.
- * @param levelmin The minimum required item level filter.
- * @param levelmax The maximum required item level filter.
  * @param usable Whether only usable items should be listed.
- * @param inventoryType The inventory type filter.
- * @param itemClass The item class filter.
- * @param itemSubClass The item subclass filter.
- * @param quality The minimum quality filter.
  * @param count Receives the number of appended entries.
  * @param totalcount Receives the total number of matching entries.
+ * @param isFull Whether the client asked for every auction at once.
  */
-void WorldSession::BuildListAuctionItems(std::vector<AuctionEntry*> const& auctions, WorldPacket& data, std::wstring const& wsearchedname, uint32 listfrom, uint32 levelmin,
-        uint32 levelmax, uint32 usable, uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality, uint32& count, uint32& totalcount, bool isFull)
+void WorldSession::BuildListAuctionItems(std::vector<AuctionEntry*>& auctions, AuctionSorter const& sorter, WorldPacket& data, uint32 listfrom,
+        uint32 usable, uint32& count, uint32& totalcount, bool isFull)
 {
-    int loc_idx = _player->GetSession()->GetSessionDbLocaleIndex();
-
+    size_t kept = 0;
     for (std::vector<AuctionEntry*>::const_iterator itr = auctions.begin(); itr != auctions.end(); ++itr)
     {
         AuctionEntry* Aentry = *itr;
@@ -1042,81 +1208,70 @@ void WorldSession::BuildListAuctionItems(std::vector<AuctionEntry*> const& aucti
             continue;
         }
 
-        if (isFull)
+        if (!isFull && usable != 0x00)
         {
-            ++count;
-            Aentry->BuildAuctionInfo(data);
-        }
-        else
-        {
-            ItemPrototype const* proto = item->GetProto();
-
-            if (itemClass != 0xffffffff && proto->Class != itemClass)
-            {
-                continue;
-            }
-
-            if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
-            {
-                continue;
-            }
-
-            if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
-            {
-                continue;
-            }
-
-            if (quality != 0xffffffff && proto->Quality < quality)
+            if (_player->CanUseItem(item) != EQUIP_ERR_OK)
             {
                 continue;
             }
 
-            if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
-            {
-                continue;
-            }
-
-            if (usable != 0x00)
+            ItemPrototype const* proto = item->GetProto();
+            if (proto->Class == ITEM_CLASS_RECIPE)
             {
-                if (_player->CanUseItem(item) != EQUIP_ERR_OK)
+                if (SpellEntry const* spell = sSpellStore.LookupEntry(proto->Spells[0].SpellId))
                 {
-                    continue;
-                }
+                    SpellEffectEntry const* spellEff = spell->GetSpellEffect(EFFECT_INDEX_0);
+                    if (!spellEff)
+                    {
+                        continue;
+                    }
 
-                if (proto->Class == ITEM_CLASS_RECIPE)
-                {
-                    if (SpellEntry const* spell = sSpellStore.LookupEntry(proto->Spells[0].SpellId))
+                    if (_player->HasSpell(spellEff->EffectTriggerSpell))
                     {
-                        SpellEffectEntry const* spellEff = spell->GetSpellEffect(EFFECT_INDEX_0);
-                        if (!spellEff)
-                        {
-                            continue;
-                        }
-
-                        if (_player->HasSpell(spellEff->EffectTriggerSpell))
-                        {
-                            continue;
-                        }
+                        continue;
                     }
                 }
             }
+        }
 
-            std::string name = proto->Name1;
-            sObjectMgr.GetItemLocaleStrings(proto->ItemId, loc_idx, &name);
+        auctions[kept++] = Aentry;
+    }
+    auctions.resize(kept);
 
-            if (!wsearchedname.empty() && !Utf8FitTo(name, wsearchedname))
-            {
-                continue;
-            }
+    totalcount = uint32(kept);
 
-            if (count < 50 && totalcount >= listfrom)
-            {
-                ++count;
-                Aentry->BuildAuctionInfo(data);
-            }
+    // auctions the sort cannot tell apart go by id, so a page boundary never moves
+    // between two requests for neighbouring pages
+    auto pageOrder = [&sorter](AuctionEntry const* auc1, AuctionEntry const* auc2)
+    {
+        if (sorter(auc1, auc2))
+        {
+            return true;
         }
+        if (sorter(auc2, auc1))
+        {
+            return false;
+        }
+        return auc1->Id < auc2->Id;
+    };
 
-        ++totalcount;
+    size_t first = 0;
+    size_t last = kept;
+    if (isFull)
+    {
+        std::sort(auctions.begin(), auctions.end(), pageOrder);
+    }
+    else
+    {
+        first = std::min<size_t>(listfrom, kept);
+        last = std::min<size_t>(size_t(listfrom) + AUCTION_BROWSE_PAGE_SIZE, kept);
+        std::partial_sort(auctions.begin(), auctions.begin() + last, auctions.end(), pageOrder);
+    }
+
+    for (size_t i = first; i < last; ++i)
+    {
+        ++count;
+        auctions[i]->BuildAuctionInfo(data);
     }
 }
 
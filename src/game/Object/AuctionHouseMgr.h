@@ -46,6 +46,9 @@
 #include "Common/TimeConstants.h"
 #include <ctime>
 #include <map>
+#include <set>
+#include <string>
+#include <vector>
 #include "DBCStructure.h"
 #include "World.h"
 
@@ -55,6 +58,7 @@
  */
 
 class Item;
+struct ItemPrototype;
 class Player;
 class Unit;
 class WorldPacket;
@@ -121,6 +125,30 @@ struct AuctionEntry
     bool UpdateBid(uint64 newbid, Player* newbidder = NULL);// true if normal bid, false if buyout, bidder==NULL for generated bid
 };
 
+/**
+ * The part of a CMSG_AUCTION_LIST_ITEMS search that depends on the item alone, and so
+ * can be settled once per item on sale rather than once per auction.
+ */
+struct AuctionBrowseFilter
+{
+    std::wstring name;                                      ///< lower case; empty matches every name
+    int32 locale;                                           ///< the searcher's DB locale index
+    uint32 levelMin;                                        ///< 0 for no level filter
+    uint32 levelMax;                                        ///< 0 for no upper bound
+    uint32 inventoryType;                                   ///< 0xFFFFFFFF for any
+    uint32 itemClass;                                       ///< 0xFFFFFFFF for any
+    uint32 itemSubClass;                                    ///< 0xFFFFFFFF for any
+    uint32 quality;                                         ///< minimum; 0xFFFFFFFF for any
+};
+
+/// An item's name in one locale, as browsing sorts and searches it.
+struct AuctionItemName
+{
+    std::wstring name;                                      ///< as displayed, for sorting
+    std::wstring lower;                                     ///< lower case, for searching
+    bool valid;                                             ///< false if the name is not valid UTF-8
+};
+
 // this class is used as auctionhouse instance
 class AuctionHouseObject
 {
@@ -146,6 +174,7 @@ class AuctionHouseObject
         {
             MANGOS_ASSERT(ah);
             AuctionsMap[ah->Id] = ah;
+            IndexAuction(ah);
         }
 
         AuctionEntry* GetAuction(uint32 id) const
@@ -156,18 +185,48 @@ class AuctionHouseObject
 
         bool RemoveAuction(uint32 id)
         {
-            return AuctionsMap.erase(id);
+            AuctionEntryMap::iterator itr = AuctionsMap.find(id);
+            if (itr == AuctionsMap.end())
+            {
+                return false;
+            }
+
+            UnindexAuction(itr->second);
+            AuctionsMap.erase(itr);
+            return true;
         }
 
         void Update();
 
+        /**
+         * @brief Collect the auctions whose item passes `filter`, for a browse.
+         *
+         * Only the items on sale in the requested class and subclass are looked at,
+         * each of them once, however many auctions it has. What depends on the
+         * auction or the viewer -- pending sales, usability -- is left to the caller.
+         */
+        void GetBrowseCandidates(AuctionBrowseFilter const& filter, std::vector<AuctionEntry*>& auctions) const;
+
         void BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
         void BuildListOwnerItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
         void BuildListPendingSales(WorldPacket& data, Player* player, uint32& count);
 
         AuctionEntry* AddAuction(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint64 bid, uint64 buyout = 0, uint64 deposit = 0, Player* pl = NULL);
     private:
+        typedef std::vector<AuctionEntry*> AuctionEntryList;
+        typedef std::unordered_map<uint32, AuctionEntryList> AuctionsByItemMap;
+        typedef std::map<uint32, std::set<uint32> > ItemsByCategoryMap;
+
+        /// Key of an item class and subclass in m_itemsByCategory; a class is a contiguous range.
+        static uint32 CategoryKey(uint32 itemClass, uint32 itemSubClass) { return (itemClass << 16) | (itemSubClass & 0xFFFF); }
+
+        void IndexAuction(AuctionEntry* auction);
+        void UnindexAuction(AuctionEntry* auction);
+
         AuctionEntryMap AuctionsMap;
+
+        AuctionsByItemMap m_auctionsByItem;                 ///< item entry -> its auctions
+        ItemsByCategoryMap m_itemsByCategory;               ///< class and subclass -> item entries on sale
 };
 
 class AuctionSorter
@@ -226,6 +285,9 @@ class AuctionHouseMgr
         static uint32 GetAuctionHouseTeam(AuctionHouseEntry const* house);
         static AuctionHouseEntry const* GetAuctionHouseEntry(Unit* unit);
 
+        /// The name of `proto` in `locale`, converted once and then kept for every later browse.
+        AuctionItemName const& GetItemName(ItemPrototype const* proto, int32 locale);
+
     public:
         // load first auction items, because of check if item exists, when loading
         void LoadAuctionItems();
@@ -237,9 +299,12 @@ class AuctionHouseMgr
         void Update();
 
     private:
+        typedef std::unordered_map<uint32, AuctionItemName> ItemNameMap;
+
         AuctionHouseObject  mAuctions[MAX_AUCTION_HOUSE_TYPE];
 
         ItemMap             mAitems;
+        std::vector<ItemNameMap> mItemNames;                ///< by locale index + 1
 };
 
 /// Convenience define to access the singleton object for the Auction House Manager
@@ -934,6 +934,63 @@ void Creature::Update(uint32 update_diff, uint32 diff)
     }
 }
 
+/**
+ * @brief How long this creature's Update can be skipped.
+ *
+ * A dead creature only waits for its respawn. A living one qualifies when Unit::Update
+ * has nothing to do, it is at full health and power, and its AI says it has no timers
+ * of its own; the first hit, cast, aura or movement order wakes it again.
+ *
+ * @return Milliseconds, 0 if the creature needs every tick.
+ */
+uint32 Creature::GetQuiescentTime() const
+{
+    switch (m_deathState)
+    {
+        case DEAD:
+        {
+            time_t now = time(NULL);
+            if (m_respawnTime <= now)
+            {
+                return 0;
+            }
+
+            return uint32(std::min<time_t>(m_respawnTime - now, time_t(DAY)) * IN_MILLISECONDS);
+        }
+        case ALIVE:
+        {
+            if (m_IsDeadByDefault || m_aggroDelay || m_cannotReachTarget || !i_AI || !i_AI->IsIdle())
+            {
+                return 0;
+            }
+
+            if (GetHealth() < GetMaxHealth())
+            {
+                return 0;
+            }
+
+            Powers powerType = GetPowerType();
+            switch (powerType)
+            {
+                case POWER_MANA:
+                case POWER_ENERGY:
+                case POWER_FOCUS:
+                    if (GetPower(powerType) < GetMaxPower(powerType))
+                    {
+                        return 0;
+                    }
+                    break;
+                default:
+                    break;
+            }
+
+            return IsQuiescent() ? UINT32_MAX : 0;
+        }
+        default:
+            return 0;
+    }
+}
+
 /**
  * @brief Starts group loot tracking for this creature.
  *
@@ -1166,6 +1223,9 @@ bool Creature::AIM_Initialize()
 
     // Handle Spawned Events, also calls Reset()
     i_AI->JustRespawned();
+
+    // the new AI decides for itself whether it is idle
+    WakeUpdateCell();
     return true;
 }
 
@@ -2029,6 +2089,8 @@ float Creature::GetAttackDistance(Unit const* pl) const
  */
 void Creature::SetDeathState(DeathState s)
 {
+    WakeUpdateCell();
+
     if ((s == JUST_DIED && !m_IsDeadByDefault) || (s == JUST_ALIVED && m_IsDeadByDefault))
     {
         m_corpseDecayTimer = m_corpseDelay * IN_MILLISECONDS; // the max/default time for corpse decay (before creature is looted/AllLootRemovedFromCorpse() is called)
@@ -2121,6 +2183,7 @@ void Creature::Respawn()
             GetMap()->GetPersistentState()->SaveCreatureRespawnTime(GetGUIDLow(), 0);
         }
         m_respawnTime = time(NULL);                         // respawn at next tick
+        WakeUpdateCell();                                   // and not a whole idle interval later
     }
 }
 
@@ -2136,6 +2199,7 @@ void Creature::ForcedDespawn(uint32 timeMSToDespawn)
         ForcedDespawnDelayEvent* pEvent = new ForcedDespawnDelayEvent(*this);
 
         m_Events.AddEvent(pEvent, m_Events.CalculateTime(timeMSToDespawn));
+        WakeUpdateCell();
         return;
     }
 
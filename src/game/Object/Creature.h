@@ -601,6 +601,7 @@ class Creature : public Unit
         char const* GetSubName() const { return GetCreatureInfo()->SubName; }
 
         void Update(uint32 update_diff, uint32 time) override;  // overwrite Unit::Update
+        uint32 GetQuiescentTime() const override;
 
         virtual void RegenerateAll(uint32 update_diff);
         uint32 GetEquipmentId() const { return m_equipmentId; }
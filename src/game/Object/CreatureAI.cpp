@@ -346,6 +346,7 @@ void CreatureAI::SendAIEventAround(AIEventType eventType, Unit* pInvoker, uint32
         {
             AiDelayEventAround* e = new AiDelayEventAround(eventType, pInvoker ? pInvoker->GetObjectGuid() : ObjectGuid(), *m_creature, receiverList, miscValue);
             m_creature->m_Events.AddEvent(e, m_creature->m_Events.CalculateTime(uiDelay));
+            m_creature->WakeUpdateCell();
         }
     }
 }
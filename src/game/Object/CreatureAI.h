@@ -301,6 +301,13 @@ class CreatureAI
          */
         virtual void UpdateAI(const uint32 /*uiDiff*/) {}
 
+        /**
+         * Check if UpdateAI would do nothing in the creature's current state
+         * Note: Only AIs that keep no timers of their own can answer true; the creature's
+         * cell may then skip its updates until something happens to it
+         */
+        virtual bool IsIdle() const { return false; }
+
         ///== State checks =================================
 
         /**
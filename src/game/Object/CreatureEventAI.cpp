@@ -28,6 +28,8 @@
 #include "Platform/Define.h"
 #include "Utilities/MathDefines.h"
 #include <cstdlib>
+#include <algorithm>
+#include <functional>
 #include <list>
 #include "CreatureEventAI.h"
 #include "CreatureEventAIMgr.h"
@@ -46,31 +48,151 @@
 /**
  * @brief Updates the repeat timer for an EventAI event.
  *
- * @param creature The creature using the event.
+ * @param holder The event state to update.
  * @param repeatMin The minimum repeat interval.
  * @param repeatMax The maximum repeat interval.
  * @return true if a valid timer was set; otherwise, false.
  */
-bool CreatureEventAIHolder::UpdateRepeatTimer(Creature* creature, uint32 repeatMin, uint32 repeatMax)
+bool CreatureEventAI::UpdateRepeatTimer(CreatureEventAIHolder& holder, uint32 repeatMin, uint32 repeatMax)
 {
     if (repeatMin == repeatMax)
     {
-        Time = repeatMin;
+        StartTimer(holder, repeatMin);
     }
     else if (repeatMax > repeatMin)
     {
-        Time = urand(repeatMin, repeatMax);
+        StartTimer(holder, urand(repeatMin, repeatMax));
     }
     else
     {
-        sLog.outErrorEventAI("Creature %u using Event %u (Type = %u) has RandomMax < RandomMin. Event repeating disabled.", creature->GetEntry(), Event.event_id, Event.event_type);
-        Enabled = false;
+        sLog.outErrorEventAI("Creature %u using Event %u (Type = %u) has RandomMax < RandomMin. Event repeating disabled.", m_creature->GetEntry(), holder.Event.event_id, holder.Event.event_type);
+        holder.Enabled = false;
         return false;
     }
 
     return true;
 }
 
+/**
+ * @brief Starts the timer of an event, replacing any timer still running.
+ *
+ * Running timers sit in a min-heap keyed by the event clock, so an event
+ * update only touches the timers that actually expire. A timer whose event is
+ * masked by the current phase does not run until the phase changes.
+ *
+ * @param holder The event state.
+ * @param time The timer length in milliseconds, 0 clears the timer.
+ */
+void CreatureEventAI::StartTimer(CreatureEventAIHolder& holder, uint32 time)
+{
+    holder.Time = time;
+    holder.Paused = time && (holder.Event.event_inverse_phase_mask & (1 << m_Phase));
+    if (!time || holder.Paused)
+    {
+        return;
+    }
+
+    // Stale entries of replaced timers are skipped when they come up, drop them before they pile up
+    if (m_EventTimers.size() >= 4 * m_CreatureEventAIList.size() + 16)
+    {
+        std::vector<EventTimer> live;
+        for (std::vector<EventTimer>::const_iterator itr = m_EventTimers.begin(); itr != m_EventTimers.end(); ++itr)
+        {
+            CreatureEventAIHolder const& queued = m_CreatureEventAIList[itr->second];
+            if (queued.Time && !queued.Paused && queued.Due == itr->first)
+            {
+                live.push_back(*itr);
+            }
+        }
+        std::make_heap(live.begin(), live.end(), std::greater<EventTimer>());
+        m_EventTimers.swap(live);
+    }
+
+    holder.Due = m_EventClock + time;
+    m_EventTimers.push_back(EventTimer(holder.Due, uint32(&holder - &m_CreatureEventAIList[0])));
+    std::push_heap(m_EventTimers.begin(), m_EventTimers.end(), std::greater<EventTimer>());
+}
+
+/**
+ * @brief Clears the timer of an event so it may trigger right away.
+ *
+ * @param holder The event state.
+ */
+void CreatureEventAI::ClearTimer(CreatureEventAIHolder& holder)
+{
+    holder.Time = 0;
+    holder.Paused = false;
+}
+
+/**
+ * @brief Returns the time left on the timer of an event.
+ *
+ * @param holder The event state.
+ * @return The remaining time in milliseconds, 0 if no timer is set.
+ */
+uint32 CreatureEventAI::GetRemainingTime(CreatureEventAIHolder const& holder) const
+{
+    if (!holder.Time || holder.Paused)
+    {
+        return holder.Time;
+    }
+
+    return holder.Due > m_EventClock ? uint32(holder.Due - m_EventClock) : 0;
+}
+
+/**
+ * @brief Clears the timers that ran out by the current event clock.
+ */
+void CreatureEventAI::ExpireTimers()
+{
+    while (!m_EventTimers.empty() && m_EventTimers.front().first <= m_EventClock)
+    {
+        EventTimer timer = m_EventTimers.front();
+        std::pop_heap(m_EventTimers.begin(), m_EventTimers.end(), std::greater<EventTimer>());
+        m_EventTimers.pop_back();
+
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[timer.second];
+        if (holder.Time && !holder.Paused && holder.Due == timer.first)
+        {
+            holder.Time = 0;
+        }
+    }
+}
+
+/**
+ * @brief Changes the event phase, holding or resuming timers of masked events.
+ *
+ * @param phase The new phase.
+ */
+void CreatureEventAI::SetPhase(uint8 phase)
+{
+    if (phase == m_Phase)
+    {
+        return;
+    }
+
+    m_Phase = phase;
+
+    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    {
+        if (!i->Time)
+        {
+            continue;
+        }
+
+        bool masked = (i->Event.event_inverse_phase_mask & (1 << m_Phase)) != 0;
+        if (masked && !i->Paused)
+        {
+            i->Time = GetRemainingTime(*i);
+            i->Paused = i->Time != 0;
+        }
+        else if (!masked && i->Paused)
+        {
+            StartTimer(*i, i->Time);
+        }
+    }
+}
+
 /**
  * @brief Checks whether EventAI is the appropriate AI for a creature.
  *
@@ -107,32 +229,26 @@ void CreatureEventAI::GetAIInformation(ChatHandler& reader)
     {
         if (itr->Event.action[2].type != ACTION_T_NONE)
         {
-            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) actions[type(param1)]: %2u(%5u)  --  %2u(%u)  --  %2u(%5u)", itr->Event.event_id, itr->Event.event_type, itr->Enabled ? "On" : "Off", itr->Time / 1000, itr->Event.action[0].type, itr->Event.action[0].raw.param1, itr->Event.action[1].type, itr->Event.action[1].raw.param1, itr->Event.action[2].type, itr->Event.action[2].raw.param1);
+            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) actions[type(param1)]: %2u(%5u)  --  %2u(%u)  --  %2u(%5u)", itr->Event.event_id, itr->Event.event_type, itr->Enabled ? "On" : "Off", GetRemainingTime(*itr) / 1000, itr->Event.action[0].type, itr->Event.action[0].raw.param1, itr->Event.action[1].type, itr->Event.action[1].raw.param1, itr->Event.action[2].type, itr->Event.action[2].raw.param1);
         }
         else if (itr->Event.action[1].type != ACTION_T_NONE)
         {
-            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) actions[type(param1)]: %2u(%5u)  --  %2u(%5u)", itr->Event.event_id, itr->Event.event_type, itr->Enabled ? "On" : "Off", itr->Time / 1000, itr->Event.action[0].type, itr->Event.action[0].raw.param1, itr->Event.action[1].type, itr->Event.action[1].raw.param1);
+            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) actions[type(param1)]: %2u(%5u)  --  %2u(%5u)", itr->Event.event_id, itr->Event.event_type, itr->Enabled ? "On" : "Off", GetRemainingTime(*itr) / 1000, itr->Event.action[0].type, itr->Event.action[0].raw.param1, itr->Event.action[1].type, itr->Event.action[1].raw.param1);
         }
         else
         {
-            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) action[type(param1)]:  %2u(%5u)", itr->Event.event_id, itr->Event.event_type, itr->Enabled ? "On" : "Off", itr->Time / 1000, itr->Event.action[0].type, itr->Event.action[0].raw.param1);
+            reader.PSendSysMessage("%u Type%3u (%s) Timer(%3us) action[type(param1)]:  %2u(%5u)", itr->Event.event_id, itr->Event.event_type, itr->Enabled ? "On" : "Off", GetRemainingTime(*itr) / 1000, itr->Event.action[0].type, itr->Event.action[0].raw.param1);
         }
     }
 }
 
-// For Non Dungeon map only allow non-difficulty flags or EFLAG_DIFFICULTY_0 mode
-inline bool IsEventFlagsFitForNormalMap(uint8 eFlags)
-{
-    return !(eFlags & (EFLAG_DIFFICULTY_0 | EFLAG_DIFFICULTY_1 | EFLAG_DIFFICULTY_2 | EFLAG_DIFFICULTY_3)) ||
-           (eFlags & EFLAG_DIFFICULTY_0);
-}
-
 /**
  * @brief Constructs EventAI state for a creature and loads its events.
  *
  * @param c The controlled creature.
  */
 CreatureEventAI::CreatureEventAI(Creature* c) : CreatureAI(c),
+    m_EventClock(0),
     m_Phase(0),
     m_MeleeEnabled(true),
     m_DynamicMovement(false),
@@ -142,116 +258,33 @@ CreatureEventAI::CreatureEventAI(Creature* c) : CreatureAI(c),
     m_throwAIEventStep(0),
     m_LastSpellMaxRange(0)
 {
-    // Need make copy for filter unneeded steps and safe in case table reload
-    CreatureEventAI_Event_Map::const_iterator creatureEventsItr = sEventAIMgr.GetCreatureEventAIMap().find(m_creature->GetEntry());
-    if (creatureEventsItr != sEventAIMgr.GetCreatureEventAIMap().end())
+    // The definitions are shared, only the timer and enabled state is per creature
+    m_EventTable = sEventAIMgr.GetEventTable(m_creature->GetEntry(), m_creature->GetMap());
+    if (!m_EventTable)
     {
-        uint32 events_count = 0;
-
-        const CreatureEventAI_Event_Vec &creatureEvent = creatureEventsItr->second;
-        for (CreatureEventAI_Event_Vec::const_iterator i = creatureEvent.begin(); i != creatureEvent.end(); ++i)
-        {
-            // Debug check
-#ifndef MANGOS_DEBUG
-            if (i->event_flags & EFLAG_DEBUG_ONLY)
-            {
-                continue;
-            }
-#endif
-            if (m_creature->GetMap()->IsDungeon())
-            {
-                if ((1 << (m_creature->GetMap()->GetSpawnMode() + 1)) & i->event_flags)
-                {
-                    ++events_count;
-                }
-            }
-            else if (IsEventFlagsFitForNormalMap(i->event_flags))
-            {
-                ++events_count;
-            }
-        }
-        // EventMap had events but they were not added because they must be for instance
-        if (events_count == 0)
-        {
-            sLog.outErrorEventAI("Creature %u has events but no events added to list because of instance flags (spawned in map %u, difficulty %u).", m_creature->GetEntry(), m_creature->GetMapId(), m_creature->GetMap()->GetDifficulty());
-        }
-        else
-        {
-            m_CreatureEventAIList.reserve(events_count);
-            for (CreatureEventAI_Event_Vec::const_iterator i = creatureEvent.begin(); i != creatureEvent.end(); ++i)
-            {
-                // Debug check
-#ifndef MANGOS_DEBUG
-                if (i->event_flags & EFLAG_DEBUG_ONLY)
-                {
-                    continue;
-                }
-#endif
-                bool storeEvent = false;
-                if (m_creature->GetMap()->IsDungeon())
-                {
-                    if ((1 << (m_creature->GetMap()->GetSpawnMode() + 1)) & i->event_flags)
-                    {
-                        storeEvent = true;
-                    }
-                }
-                else if (IsEventFlagsFitForNormalMap(i->event_flags))
-                {
-                    storeEvent = true;
-                }
-
-                if (storeEvent)
-                {
-                    m_CreatureEventAIList.push_back(CreatureEventAIHolder(*i));
-                    // Cache for fast use
-                    if (i->event_type == EVENT_T_OOC_LOS)
-                    {
-                        m_HasOOCLoSEvent = true;
-                    }
-                }
-            }
-        }
+        sLog.outErrorEventAI("EventMap for Creature %u is empty but creature is using CreatureEventAI.", m_creature->GetEntry());
+        m_EventTable = std::make_shared<CreatureEventAI_EventTable>();
     }
-    else
+    // EventMap had events but they were not added because they must be for instance
+    else if (m_EventTable->Events.empty())
     {
-        sLog.outErrorEventAI("EventMap for Creature %u is empty but creature is using CreatureEventAI.", m_creature->GetEntry());
+        sLog.outErrorEventAI("Creature %u has events but no events added to list because of instance flags (spawned in map %u, difficulty %u).", m_creature->GetEntry(), m_creature->GetMapId(), m_creature->GetMap()->GetDifficulty());
     }
+
+    m_CreatureEventAIList.reserve(m_EventTable->Events.size());
+    for (CreatureEventAI_Event_Vec::const_iterator i = m_EventTable->Events.begin(); i != m_EventTable->Events.end(); ++i)
+    {
+        m_CreatureEventAIList.push_back(CreatureEventAIHolder(*i));
+    }
+
+    // Cache for fast use
+    m_HasOOCLoSEvent = m_EventTable->OfType(EVENT_T_OOC_LOS).begin() != m_EventTable->OfType(EVENT_T_OOC_LOS).end();
 }
 
 #define LOG_PROCESS_EVENT                                                                                                       \
     DEBUG_FILTER_LOG(LOG_FILTER_EVENT_AI_DEV, "CreatureEventAI: Event type %u (script %u) triggered for %s (invoked by %s)",    \
                      pHolder.Event.event_type, pHolder.Event.event_id, m_creature->GetGuidStr().c_str(), pActionInvoker ? pActionInvoker->GetGuidStr().c_str() : "<no invoker>")
 
-/**
- * @brief Checks whether an EventAI event type is driven by timer-style scheduling.
- *
- * @param type The EventAI event type.
- * @return true if the event type uses timer-based execution; otherwise false.
- */
-inline bool IsTimerBasedEvent(EventAI_Type type)
-{
-    switch (type)
-    {
-        case EVENT_T_TIMER_IN_COMBAT:
-        case EVENT_T_TIMER_OOC:
-        case EVENT_T_TIMER_GENERIC:
-        case EVENT_T_MANA:
-        case EVENT_T_HP:
-        case EVENT_T_TARGET_HP:
-        case EVENT_T_TARGET_CASTING:
-        case EVENT_T_FRIENDLY_HP:
-        case EVENT_T_AURA:
-        case EVENT_T_TARGET_AURA:
-        case EVENT_T_MISSING_AURA:
-        case EVENT_T_TARGET_MISSING_AURA:
-        case EVENT_T_RANGE:
-        case EVENT_T_ENERGY:
-            return true;
-        default:
-            return false;
-    }
-}
-
 /**
  * @brief Processes a single EventAI event and its actions.
  *
@@ -295,7 +328,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.timer.repeatMin, event.timer.repeatMax);
+            UpdateRepeatTimer(pHolder, event.timer.repeatMin, event.timer.repeatMax);
             break;
         case EVENT_T_TIMER_OOC:
             if (m_creature->IsInCombat() || m_creature->IsInEvadeMode())
@@ -305,12 +338,12 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.timer.repeatMin, event.timer.repeatMax);
+            UpdateRepeatTimer(pHolder, event.timer.repeatMin, event.timer.repeatMax);
             break;
         case EVENT_T_TIMER_GENERIC:
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.timer.repeatMin, event.timer.repeatMax);
+            UpdateRepeatTimer(pHolder, event.timer.repeatMin, event.timer.repeatMax);
             break;
         case EVENT_T_HP:
         {
@@ -328,7 +361,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.percent_range.repeatMin, event.percent_range.repeatMax);
+            UpdateRepeatTimer(pHolder, event.percent_range.repeatMin, event.percent_range.repeatMax);
             break;
         }
         case EVENT_T_MANA:
@@ -347,14 +380,14 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.percent_range.repeatMin, event.percent_range.repeatMax);
+            UpdateRepeatTimer(pHolder, event.percent_range.repeatMin, event.percent_range.repeatMax);
             break;
         }
         case EVENT_T_AGGRO:
             break;
         case EVENT_T_KILL:
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.kill.repeatMin, event.kill.repeatMax);
+            UpdateRepeatTimer(pHolder, event.kill.repeatMin, event.kill.repeatMax);
             break;
         case EVENT_T_DEATH:
         case EVENT_T_EVADE:
@@ -363,7 +396,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
             // Spell hit is special case, param1 and param2 handled within CreatureEventAI::SpellHit
 
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.spell_hit.repeatMin, event.spell_hit.repeatMax);
+            UpdateRepeatTimer(pHolder, event.spell_hit.repeatMin, event.spell_hit.repeatMax);
             break;
         case EVENT_T_RANGE:
             if (!m_creature->IsInCombat() || !m_creature->getVictim() || !m_creature->Where().ShareFrame(m_creature->getVictim()->Where()))
@@ -378,11 +411,11 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
             }
 
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.range.repeatMin, event.range.repeatMax);
+            UpdateRepeatTimer(pHolder, event.range.repeatMin, event.range.repeatMax);
             break;
         case EVENT_T_OOC_LOS:
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.ooc_los.repeatMin, event.ooc_los.repeatMax);
+            UpdateRepeatTimer(pHolder, event.ooc_los.repeatMin, event.ooc_los.repeatMax);
             break;
         case EVENT_T_SPAWNED:
             break;
@@ -402,7 +435,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.percent_range.repeatMin, event.percent_range.repeatMax);
+            UpdateRepeatTimer(pHolder, event.percent_range.repeatMin, event.percent_range.repeatMax);
             break;
         }
         case EVENT_T_TARGET_CASTING:
@@ -413,7 +446,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.target_casting.repeatMin, event.target_casting.repeatMax);
+            UpdateRepeatTimer(pHolder, event.target_casting.repeatMin, event.target_casting.repeatMax);
             break;
         case EVENT_T_FRIENDLY_HP:
         {
@@ -432,7 +465,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.friendly_hp.repeatMin, event.friendly_hp.repeatMax);
+            UpdateRepeatTimer(pHolder, event.friendly_hp.repeatMin, event.friendly_hp.repeatMax);
             break;
         }
         case EVENT_T_FRIENDLY_IS_CC:
@@ -456,7 +489,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.friendly_is_cc.repeatMin, event.friendly_is_cc.repeatMax);
+            UpdateRepeatTimer(pHolder, event.friendly_is_cc.repeatMin, event.friendly_is_cc.repeatMax);
             break;
         }
         case EVENT_T_FRIENDLY_MISSING_BUFF:
@@ -474,7 +507,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
             pActionInvoker = *(pList.begin());
 
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.friendly_buff.repeatMin, event.friendly_buff.repeatMax);
+            UpdateRepeatTimer(pHolder, event.friendly_buff.repeatMin, event.friendly_buff.repeatMax);
             break;
         }
         case EVENT_T_SUMMONED_UNIT:
@@ -494,7 +527,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
             }
 
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.summoned.repeatMin, event.summoned.repeatMax);
+            UpdateRepeatTimer(pHolder, event.summoned.repeatMin, event.summoned.repeatMax);
             break;
         }
         case EVENT_T_TARGET_MANA:
@@ -512,7 +545,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
             }
 
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.percent_range.repeatMin, event.percent_range.repeatMax);
+            UpdateRepeatTimer(pHolder, event.percent_range.repeatMin, event.percent_range.repeatMax);
             break;
         }
         case EVENT_T_REACHED_HOME:
@@ -533,7 +566,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.buffed.repeatMin, event.buffed.repeatMax);
+            UpdateRepeatTimer(pHolder, event.buffed.repeatMin, event.buffed.repeatMax);
             break;
         }
         case EVENT_T_TARGET_AURA:
@@ -551,7 +584,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.buffed.repeatMin, event.buffed.repeatMax);
+            UpdateRepeatTimer(pHolder, event.buffed.repeatMin, event.buffed.repeatMax);
             break;
         }
         case EVENT_T_MISSING_AURA:
@@ -569,7 +602,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.buffed.repeatMin, event.buffed.repeatMax);
+            UpdateRepeatTimer(pHolder, event.buffed.repeatMin, event.buffed.repeatMax);
             break;
         }
         case EVENT_T_TARGET_MISSING_AURA:
@@ -587,7 +620,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.buffed.repeatMin, event.buffed.repeatMax);
+            UpdateRepeatTimer(pHolder, event.buffed.repeatMin, event.buffed.repeatMax);
             break;
         }
         case EVENT_T_RECEIVE_AI_EVENT:
@@ -622,7 +655,7 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
 
             LOG_PROCESS_EVENT;
             // Repeat Timers
-            pHolder.UpdateRepeatTimer(m_creature, event.percent_range.repeatMin, event.percent_range.repeatMax);
+            UpdateRepeatTimer(pHolder, event.percent_range.repeatMin, event.percent_range.repeatMax);
             break;
         }
         default:
@@ -689,6 +722,20 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
     return true;
 }
 
+/**
+ * @brief Processes every event of one type, in database order.
+ *
+ * @param type The EventAI event type.
+ * @param pActionInvoker The unit that triggered the events.
+ */
+void CreatureEventAI::ProcessEventsOfType(EventAI_Type type, Unit* pActionInvoker)
+{
+    for (uint32 index : m_EventTable->OfType(type))
+    {
+        ProcessEvent(m_CreatureEventAIList[index], pActionInvoker);
+    }
+}
+
 /**
  * @brief Executes a single EventAI action.
  *
@@ -1058,7 +1105,7 @@ void CreatureEventAI::ProcessAction(CreatureEventAI_Action const& action, uint32
             }
             break;
         case ACTION_T_SET_PHASE:            //22
-            m_Phase = action.set_phase.phase;
+            SetPhase(action.set_phase.phase);
             DEBUG_FILTER_LOG(LOG_FILTER_EVENT_AI_DEV, "CreatureEventAI: ACTION_T_SET_PHASE - script %u for %s, phase is now %u", EventId, m_creature->GetGuidStr().c_str(), m_Phase);
             break;
         case ACTION_T_INC_PHASE:            //23
@@ -1067,16 +1114,16 @@ void CreatureEventAI::ProcessAction(CreatureEventAI_Action const& action, uint32
             if (new_phase < 0)
             {
                 sLog.outErrorEventAI("Event %d decrease Phase under 0. CreatureEntry = %d", EventId, m_creature->GetEntry());
-                m_Phase = 0;
+                SetPhase(0);
             }
             else if (new_phase >= MAX_PHASE)
             {
                 sLog.outErrorEventAI("Event %d incremented Phase above %u. Phase mask can not be used with phases past %u. CreatureEntry = %d", EventId, MAX_PHASE - 1, MAX_PHASE - 1, m_creature->GetEntry());
-                m_Phase = MAX_PHASE - 1;
+                SetPhase(MAX_PHASE - 1);
             }
             else
             {
-                m_Phase = new_phase;
+                SetPhase(new_phase);
             }
 
             DEBUG_FILTER_LOG(LOG_FILTER_EVENT_AI_DEV, "CreatureEventAI: ACTION_T_INC_PHASE - script %u for %s, phase is now %u", EventId, m_creature->GetGuidStr().c_str(), m_Phase);
@@ -1138,13 +1185,13 @@ void CreatureEventAI::ProcessAction(CreatureEventAI_Action const& action, uint32
             }
             break;
         case ACTION_T_RANDOM_PHASE:             //30
-            m_Phase = GetRandActionParam(rnd, action.random_phase.phase1, action.random_phase.phase2, action.random_phase.phase3);
+            SetPhase(GetRandActionParam(rnd, action.random_phase.phase1, action.random_phase.phase2, action.random_phase.phase3));
             DEBUG_FILTER_LOG(LOG_FILTER_EVENT_AI_DEV, "CreatureEventAI: ACTION_T_RANDOM_PHASE - script %u for %s, phase is now %u", EventId, m_creature->GetGuidStr().c_str(), m_Phase);
             break;
         case ACTION_T_RANDOM_PHASE_RANGE:       //31
             if (action.random_phase_range.phaseMax > action.random_phase_range.phaseMin)
             {
-                m_Phase = action.random_phase_range.phaseMin + (rnd % (action.random_phase_range.phaseMax - action.random_phase_range.phaseMin));
+                SetPhase(action.random_phase_range.phaseMin + (rnd % (action.random_phase_range.phaseMax - action.random_phase_range.phaseMin)));
             }
             else
             {
@@ -1373,20 +1420,23 @@ void CreatureEventAI::JustRespawned()                       // NOTE that this is
 {
     Reset();
 
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    // Reset generic timer
+    for (uint32 index : m_EventTable->OfType(EVENT_T_TIMER_GENERIC))
     {
-        // Reset generic timer
-        if (i->Event.event_type == EVENT_T_TIMER_GENERIC)
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[index];
+        if (UpdateRepeatTimer(holder, holder.Event.timer.initialMin, holder.Event.timer.initialMax))
         {
-            if (i->UpdateRepeatTimer(m_creature, i->Event.timer.initialMin, i->Event.timer.initialMax))
-            {
-                i->Enabled = true;
-            }
+            holder.Enabled = true;
         }
-        // Handle Spawned Events
-        else if (SpawnedEventConditionsCheck((*i).Event))
+    }
+
+    // Handle Spawned Events
+    for (uint32 index : m_EventTable->OfType(EVENT_T_SPAWNED))
+    {
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[index];
+        if (SpawnedEventConditionsCheck(holder.Event))
         {
-            ProcessEvent(*i);
+            ProcessEvent(holder);
         }
     }
 }
@@ -1400,26 +1450,14 @@ void CreatureEventAI::Reset()
     m_EventDiff = 0;
     m_throwAIEventStep = 0;
 
-    // Reset all events to enabled
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    // Reset all out of combat timers
+    // TODO: verify whether other events previously disabled (ex. aggro yell) should be enabled here, instead of enable this in void Aggro()
+    for (uint32 index : m_EventTable->OfType(EVENT_T_TIMER_OOC))
     {
-        CreatureEventAI_Event const& event = i->Event;
-        switch (event.event_type)
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[index];
+        if (UpdateRepeatTimer(holder, holder.Event.timer.initialMin, holder.Event.timer.initialMax))
         {
-                // Reset all out of combat timers
-            case EVENT_T_TIMER_OOC:
-            {
-                if (i->UpdateRepeatTimer(m_creature, event.timer.initialMin, event.timer.initialMax))
-                {
-                    i->Enabled = true;
-                }
-                break;
-            }
-            default:
-            // TODO: enable below code line / verify this is correct to enable events previously disabled (ex. aggro yell), instead of enable this in void Aggro()
-            //i->Enabled = true;
-            //i->Time = 0;
-            break;
+            holder.Enabled = true;
         }
     }
 }
@@ -1429,13 +1467,7 @@ void CreatureEventAI::Reset()
  */
 void CreatureEventAI::JustReachedHome()
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_REACHED_HOME)
-        {
-            ProcessEvent(*i);
-        }
-    }
+    ProcessEventsOfType(EVENT_T_REACHED_HOME);
 
     Reset();
 }
@@ -1458,13 +1490,7 @@ void CreatureEventAI::EnterEvadeMode()
     m_creature->SetLootRecipient(NULL);
 
     // Handle Evade events
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_EVADE)
-        {
-            ProcessEvent(*i);
-        }
-    }
+    ProcessEventsOfType(EVENT_T_EVADE);
 }
 
 /**
@@ -1491,16 +1517,10 @@ void CreatureEventAI::JustDied(Unit* killer)
     }
 
     // Handle On Death events
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_DEATH)
-        {
-            ProcessEvent(*i, killer);
-        }
-    }
+    ProcessEventsOfType(EVENT_T_DEATH, killer);
 
     // reset phase after any death state events
-    m_Phase = 0;
+    SetPhase(0);
 }
 
 /**
@@ -1515,13 +1535,7 @@ void CreatureEventAI::KilledUnit(Unit* victim)
         return;
     }
 
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_KILL)
-        {
-            ProcessEvent(*i, victim);
-        }
-    }
+    ProcessEventsOfType(EVENT_T_KILL, victim);
 }
 
 /**
@@ -1531,13 +1545,7 @@ void CreatureEventAI::KilledUnit(Unit* victim)
  */
 void CreatureEventAI::JustSummoned(Creature* pUnit)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_SUMMONED_UNIT)
-        {
-            ProcessEvent(*i, pUnit);
-        }
-    }
+    ProcessEventsOfType(EVENT_T_SUMMONED_UNIT, pUnit);
 }
 
 /**
@@ -1547,13 +1555,7 @@ void CreatureEventAI::JustSummoned(Creature* pUnit)
  */
 void CreatureEventAI::SummonedCreatureJustDied(Creature* pUnit)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_SUMMONED_JUST_DIED)
-        {
-            ProcessEvent(*i, pUnit);
-        }
-    }
+    ProcessEventsOfType(EVENT_T_SUMMONED_JUST_DIED, pUnit);
 }
 
 /**
@@ -1563,13 +1565,7 @@ void CreatureEventAI::SummonedCreatureJustDied(Creature* pUnit)
  */
 void CreatureEventAI::SummonedCreatureDespawn(Creature* pUnit)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_SUMMONED_JUST_DESPAWN)
-        {
-            ProcessEvent(*i, pUnit);
-        }
-    }
+    ProcessEventsOfType(EVENT_T_SUMMONED_JUST_DESPAWN, pUnit);
 }
 
 /**
@@ -1584,13 +1580,13 @@ void CreatureEventAI::ReceiveAIEvent(AIEventType eventType, Creature* pSender, U
 {
     MANGOS_ASSERT(pSender);
 
-    for (CreatureEventAIList::iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
+    for (uint32 index : m_EventTable->OfType(EVENT_T_RECEIVE_AI_EVENT))
     {
-        if (itr->Event.event_type == EVENT_T_RECEIVE_AI_EVENT &&
-            itr->Event.receiveAIEvent.eventType == eventType && (!itr->Event.receiveAIEvent.senderEntry || itr->Event.receiveAIEvent.senderEntry == pSender->GetEntry()))
-            {
-                ProcessEvent(*itr, pInvoker, pSender);
-            }
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[index];
+        if (holder.Event.receiveAIEvent.eventType == eventType && (!holder.Event.receiveAIEvent.senderEntry || holder.Event.receiveAIEvent.senderEntry == pSender->GetEntry()))
+        {
+            ProcessEvent(holder, pInvoker, pSender);
+        }
     }
 }
 
@@ -1613,7 +1609,7 @@ void CreatureEventAI::EnterCombat(Unit* enemy)
                 break;
                 // Reset all in combat timers
             case EVENT_T_TIMER_IN_COMBAT:
-                if (i->UpdateRepeatTimer(m_creature, event.timer.initialMin, event.timer.initialMax))
+                if (UpdateRepeatTimer(*i, event.timer.initialMin, event.timer.initialMax))
                 {
                     i->Enabled = true;
                 }
@@ -1621,7 +1617,7 @@ void CreatureEventAI::EnterCombat(Unit* enemy)
                 // All normal events need to be re-enabled and their time set to 0
             default:
                 i->Enabled = true;
-                i->Time = 0;
+                ClearTimer(*i);
                 break;
         }
     }
@@ -1667,22 +1663,21 @@ void CreatureEventAI::MoveInLineOfSight(Unit* who)
     // Check for OOC LOS Event
     if (m_HasOOCLoSEvent && !m_creature->getVictim())
     {
-        for (CreatureEventAIList::iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
+        for (uint32 index : m_EventTable->OfType(EVENT_T_OOC_LOS))
         {
-            if (itr->Event.event_type == EVENT_T_OOC_LOS)
-            {
-                // can trigger if closer than fMaxAllowedRange
-                float fMaxAllowedRange = (float)itr->Event.ooc_los.maxRange;
+            CreatureEventAIHolder& holder = m_CreatureEventAIList[index];
+
+            // can trigger if closer than fMaxAllowedRange
+            float fMaxAllowedRange = (float)holder.Event.ooc_los.maxRange;
 
-                // if friendly event && who is not hostile OR hostile event && who is hostile
-                if ((itr->Event.ooc_los.noHostile && !m_creature->IsHostileTo(who)) ||
-                    ((!itr->Event.ooc_los.noHostile) && m_creature->IsHostileTo(who)))
+            // if friendly event && who is not hostile OR hostile event && who is hostile
+            if ((holder.Event.ooc_los.noHostile && !m_creature->IsHostileTo(who)) ||
+                ((!holder.Event.ooc_los.noHostile) && m_creature->IsHostileTo(who)))
+            {
+                // if range is ok and we are actually in LOS
+                if (InReach(*m_creature, *who, fMaxAllowedRange) && HasLineOfSight(*m_creature, *who))
                 {
-                    // if range is ok and we are actually in LOS
-                    if (InReach(*m_creature, *who, fMaxAllowedRange) && HasLineOfSight(*m_creature, *who))
-                    {
-                        ProcessEvent(*itr, who);
-                    }
+                    ProcessEvent(holder, who);
                 }
             }
         }
@@ -1726,17 +1721,16 @@ void CreatureEventAI::MoveInLineOfSight(Unit* who)
  */
 void CreatureEventAI::SpellHit(Unit* pUnit, const SpellEntry* pSpell)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    for (uint32 index : m_EventTable->OfType(EVENT_T_SPELLHIT))
     {
-        if (i->Event.event_type == EVENT_T_SPELLHIT)
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[index];
+
+        // If spell id matches (or no spell id) & if spell school matches (or no spell school)
+        if (!holder.Event.spell_hit.spellId || pSpell->ID == holder.Event.spell_hit.spellId)
         {
-            // If spell id matches (or no spell id) & if spell school matches (or no spell school)
-            if (!i->Event.spell_hit.spellId || pSpell->ID == i->Event.spell_hit.spellId)
+            if (pSpell->SchoolMask & holder.Event.spell_hit.schoolMask)
             {
-                if (pSpell->SchoolMask & i->Event.spell_hit.schoolMask)
-                {
-                    ProcessEvent(*i, pUnit);
-                }
+                ProcessEvent(holder, pUnit);
             }
         }
     }
@@ -1757,36 +1751,22 @@ void CreatureEventAI::UpdateAI(const uint32 diff)
     {
         m_EventDiff += diff;
 
+        // Advance timers, only those running out are touched (masked events hold their timer, see SetPhase)
+        m_EventClock += m_EventDiff;
+        ExpireTimers();
+
         // Check for time based events
-        for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+        for (uint32 index : m_EventTable->Polled)
         {
-            // Decrement Timers
-            if (i->Time)
-            {
-                if (i->Time > m_EventDiff)
-                {
-                    // Do not decrement timers if event can not trigger in this phase
-                    if (!(i->Event.event_inverse_phase_mask & (1 << m_Phase)))
-                    {
-                        i->Time -= m_EventDiff;
-                    }
-                }
-                else
-                {
-                    i->Time = 0;
-                }
-            }
+            CreatureEventAIHolder& holder = m_CreatureEventAIList[index];
 
             // Skip processing of events that have time remaining or are disabled
-            if (!(i->Enabled) || i->Time)
+            if (!holder.Enabled || holder.Time)
             {
                 continue;
             }
 
-            if (IsTimerBasedEvent(i->Event.event_type))
-            {
-                ProcessEvent(*i);
-            }
+            ProcessEvent(holder);
         }
 
         m_EventDiff = 0;
@@ -2033,21 +2013,19 @@ void CreatureEventAI::DoFindFriendlyMissingBuff(std::list<Creature*>& _list, flo
  */
 void CreatureEventAI::ReceiveEmote(Player* pPlayer, uint32 text_emote)
 {
-    for (CreatureEventAIList::iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
+    for (uint32 index : m_EventTable->OfType(EVENT_T_RECEIVE_EMOTE))
     {
-        if (itr->Event.event_type == EVENT_T_RECEIVE_EMOTE)
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[index];
+        if (holder.Event.receive_emote.emoteId != text_emote)
         {
-            if (itr->Event.receive_emote.emoteId != text_emote)
-            {
-                continue;
-            }
+            continue;
+        }
 
-            PlayerCondition pcon(0, itr->Event.receive_emote.condition, itr->Event.receive_emote.conditionValue1, itr->Event.receive_emote.conditionValue2);
-            if (pcon.Meets(pPlayer, m_creature->GetMap(), m_creature, CONDITION_FROM_EVENTAI))
-            {
-                DEBUG_FILTER_LOG(LOG_FILTER_AI_AND_MOVEGENSS, "CreatureEventAI: ReceiveEmote CreatureEventAI: Condition ok, processing");
-                ProcessEvent(*itr, pPlayer);
-            }
+        PlayerCondition pcon(0, holder.Event.receive_emote.condition, holder.Event.receive_emote.conditionValue1, holder.Event.receive_emote.conditionValue2);
+        if (pcon.Meets(pPlayer, m_creature->GetMap(), m_creature, CONDITION_FROM_EVENTAI))
+        {
+            DEBUG_FILTER_LOG(LOG_FILTER_AI_AND_MOVEGENSS, "CreatureEventAI: ReceiveEmote CreatureEventAI: Condition ok, processing");
+            ProcessEvent(holder, pPlayer);
         }
     }
 }
@@ -29,6 +29,7 @@
 #include <unordered_map>
 #include "Platform/Define.h"
 #include <vector>
+#include <memory>
 #include <list>
 #include "Creature.h"
 #include "CreatureAI.h"
@@ -633,6 +634,71 @@ struct CreatureEventAI_Event
 typedef std::vector<CreatureEventAI_Event> CreatureEventAI_Event_Vec;
 typedef std::unordered_map<uint32, CreatureEventAI_Event_Vec > CreatureEventAI_Event_Map;
 
+/**
+ * @brief Checks whether an EventAI event type is polled on every event update.
+ *
+ * @param type The EventAI event type.
+ * @return true if the event type uses timer-based execution; otherwise false.
+ */
+inline bool IsTimerBasedEvent(EventAI_Type type)
+{
+    switch (type)
+    {
+        case EVENT_T_TIMER_IN_COMBAT:
+        case EVENT_T_TIMER_OOC:
+        case EVENT_T_TIMER_GENERIC:
+        case EVENT_T_MANA:
+        case EVENT_T_HP:
+        case EVENT_T_TARGET_HP:
+        case EVENT_T_TARGET_CASTING:
+        case EVENT_T_FRIENDLY_HP:
+        case EVENT_T_AURA:
+        case EVENT_T_TARGET_AURA:
+        case EVENT_T_MISSING_AURA:
+        case EVENT_T_TARGET_MISSING_AURA:
+        case EVENT_T_RANGE:
+        case EVENT_T_ENERGY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * The events of one creature entry that apply in one kind of map (open world or
+ * a dungeon difficulty). Built once when the scripts are loaded and shared by
+ * every creature of that entry, which only keeps the mutable timer and enabled
+ * state of each event (see CreatureEventAIHolder).
+ */
+struct CreatureEventAI_EventTable
+{
+    struct IndexRange
+    {
+        uint32 const* first;
+        uint32 const* last;
+
+        uint32 const* begin() const { return first; }
+        uint32 const* end() const { return last; }
+    };
+
+    CreatureEventAI_EventTable() : TypeStart() {}
+
+    /// Indexes into Events of all events of one type, in database order
+    IndexRange OfType(EventAI_Type type) const
+    {
+        uint32 const* base = ByType.data();
+        IndexRange range = { base + TypeStart[type], base + TypeStart[type + 1] };
+        return range;
+    }
+
+    CreatureEventAI_Event_Vec Events;                       // Events in database order
+    std::vector<uint32> ByType;                             // Indexes into Events, grouped by event type
+    uint32 TypeStart[EVENT_T_END + 1];                      // ByType[TypeStart[t]] .. ByType[TypeStart[t + 1] - 1] are of type t
+    std::vector<uint32> Polled;                             // Indexes of the events UpdateAI checks, see IsTimerBasedEvent
+};
+
+typedef std::shared_ptr<CreatureEventAI_EventTable const> CreatureEventAI_EventTablePtr;
+
 struct CreatureEventAI_Summon
 {
     uint32 id;
@@ -649,14 +715,13 @@ typedef std::unordered_map<uint32, CreatureEventAI_Summon> CreatureEventAI_Summo
 
 struct CreatureEventAIHolder
 {
-    CreatureEventAIHolder(CreatureEventAI_Event p) : Event(p), Time(0), Enabled(true) {}
+    explicit CreatureEventAIHolder(CreatureEventAI_Event const& p) : Event(p), Time(0), Due(0), Enabled(true), Paused(false) {}
 
-    CreatureEventAI_Event Event;
-    uint32 Time;
+    CreatureEventAI_Event const& Event;                     // Owned by the shared CreatureEventAI_EventTable
+    uint32 Time;                                            // Non-zero while the event waits for its timer
+    uint64 Due;                                             // Event clock value at which a running timer expires
     bool Enabled;
-
-    // helper
-    bool UpdateRepeatTimer(Creature* creature, uint32 repeatMin, uint32 repeatMax);
+    bool Paused;                                            // Timer is held because the current phase masks the event
 };
 
 class CreatureEventAI : public CreatureAI
@@ -693,6 +758,7 @@ class CreatureEventAI : public CreatureAI
         static int Permissible(const Creature*);
 
         bool ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pActionInvoker = NULL, Creature* pAIEventSender = NULL);
+        void ProcessEventsOfType(EventAI_Type type, Unit* pActionInvoker = NULL);
         void ProcessAction(CreatureEventAI_Action const& action, uint32 rnd, uint32 EventId, Unit* pActionInvoker, Creature* pAIEventSender);
         inline uint32 GetRandActionParam(uint32 rnd, uint32 param1, uint32 param2, uint32 param3);
         inline int32 GetRandActionParam(uint32 rnd, int32 param1, int32 param2, int32 param3);
@@ -706,13 +772,25 @@ class CreatureEventAI : public CreatureAI
         void DoFindFriendlyCC(std::list<Creature*>& _list, float range);
 
     protected:
+        // Event timers
+        bool UpdateRepeatTimer(CreatureEventAIHolder& holder, uint32 repeatMin, uint32 repeatMax);
+        void StartTimer(CreatureEventAIHolder& holder, uint32 time);
+        void ClearTimer(CreatureEventAIHolder& holder);
+        uint32 GetRemainingTime(CreatureEventAIHolder const& holder) const;
+        void ExpireTimers();
+        void SetPhase(uint8 phase);
+
         uint32 m_EventUpdateTime;                           // Time between event updates
         uint32 m_EventDiff;                                 // Time between the last event call
+        uint64 m_EventClock;                                // Sum of all event update intervals, timers expire against it
         bool   m_bEmptyList;
 
         // Variables used by Events themselves
         typedef std::vector<CreatureEventAIHolder> CreatureEventAIList;
-        CreatureEventAIList m_CreatureEventAIList;          // Holder for events (stores enabled, time, and eventid)
+        typedef std::pair<uint64, uint32> EventTimer;       // Due clock, index into m_CreatureEventAIList
+        CreatureEventAI_EventTablePtr m_EventTable;         // Shared event definitions of this entry and map difficulty
+        CreatureEventAIList m_CreatureEventAIList;          // Per creature state of m_EventTable->Events (enabled, time)
+        std::vector<EventTimer> m_EventTimers;              // Min-heap of running timers, stale entries are skipped
 
         uint8  m_Phase;                                     // Current phase, max 32 phases
         bool   m_MeleeEnabled;                              // If we allow melee auto attack
@@ -40,6 +40,7 @@
 #include "GridDefines.h"
 #include "SpellMgr.h"
 #include "World.h"
+#include "Map.h"
 
 
 // -------------------
@@ -304,8 +305,9 @@ bool IsValidTargetType(EventAI_Type eventType, EventAI_ActionType actionType, ui
  */
 void CreatureEventAIMgr::LoadCreatureEventAI_Scripts()
 {
-    // Drop Existing EventAI List
+    // Drop Existing EventAI List, creatures keep the tables they were spawned with
     m_CreatureEventAI_Event_Map.clear();
+    m_CreatureEventAI_EventTable_Map.clear();
     std::set<int32> usedTextIds;
 
     // Gather event data
@@ -1136,6 +1138,7 @@ void CreatureEventAIMgr::LoadCreatureEventAI_Scripts()
 
         CheckUnusedAITexts();
         CheckUnusedAISummons();
+        BuildEventTables();
 
         sLog.outString(">> Loaded %u CreatureEventAI scripts", Count);
         sLog.outString();
@@ -1148,3 +1151,126 @@ void CreatureEventAIMgr::LoadCreatureEventAI_Scripts()
         sLog.outString();
     }
 }
+
+// For Non Dungeon map only allow non-difficulty flags or EFLAG_DIFFICULTY_0 mode
+inline bool IsEventFlagsFitForNormalMap(uint8 eFlags)
+{
+    return !(eFlags & (EFLAG_DIFFICULTY_0 | EFLAG_DIFFICULTY_1 | EFLAG_DIFFICULTY_2 | EFLAG_DIFFICULTY_3)) ||
+           (eFlags & EFLAG_DIFFICULTY_0);
+}
+
+/**
+ * @brief Checks whether an event is used on a kind of map.
+ *
+ * @param event The event definition.
+ * @param slot 0 for non-dungeon maps, 1 + spawn mode for dungeons.
+ * @return true if creatures spawned on such a map run the event.
+ */
+static bool IsEventUsableInSlot(CreatureEventAI_Event const& event, uint32 slot)
+{
+    // Debug check
+#ifndef MANGOS_DEBUG
+    if (event.event_flags & EFLAG_DEBUG_ONLY)
+    {
+        return false;
+    }
+#endif
+    if (slot == 0)
+    {
+        return IsEventFlagsFitForNormalMap(event.event_flags);
+    }
+
+    return ((1 << slot) & event.event_flags) != 0;
+}
+
+/**
+ * @brief Builds the shared per-map-kind event tables from the loaded scripts.
+ *
+ * Events are grouped by type once here, so the creature hooks only visit the
+ * events they can trigger. Map kinds selecting the same events share a table.
+ */
+void CreatureEventAIMgr::BuildEventTables()
+{
+    for (CreatureEventAI_Event_Map::const_iterator itr = m_CreatureEventAI_Event_Map.begin(); itr != m_CreatureEventAI_Event_Map.end(); ++itr)
+    {
+        CreatureEventAI_Event_Vec const& events = itr->second;
+        CreatureEventAI_EventTables& tables = m_CreatureEventAI_EventTable_Map[itr->first];
+        std::vector<uint32> selected[1 + MAX_DIFFICULTY];
+
+        for (uint32 slot = 0; slot < 1 + MAX_DIFFICULTY; ++slot)
+        {
+            for (uint32 i = 0; i < events.size(); ++i)
+            {
+                if (IsEventUsableInSlot(events[i], slot))
+                {
+                    selected[slot].push_back(i);
+                }
+            }
+
+            for (uint32 other = 0; other < slot; ++other)
+            {
+                if (selected[other] == selected[slot])
+                {
+                    tables[slot] = tables[other];
+                    break;
+                }
+            }
+
+            if (tables[slot])
+            {
+                continue;
+            }
+
+            std::shared_ptr<CreatureEventAI_EventTable> table = std::make_shared<CreatureEventAI_EventTable>();
+            table->Events.reserve(selected[slot].size());
+            for (std::vector<uint32>::const_iterator i = selected[slot].begin(); i != selected[slot].end(); ++i)
+            {
+                table->Events.push_back(events[*i]);
+            }
+
+            // Counting sort by type keeps the database order within each type
+            uint32 count[EVENT_T_END] = {};
+            for (CreatureEventAI_Event_Vec::const_iterator e = table->Events.begin(); e != table->Events.end(); ++e)
+            {
+                ++count[e->event_type];
+            }
+            for (uint32 type = 0; type < EVENT_T_END; ++type)
+            {
+                table->TypeStart[type + 1] = table->TypeStart[type] + count[type];
+            }
+
+            uint32 fill[EVENT_T_END];
+            std::copy(table->TypeStart, table->TypeStart + EVENT_T_END, fill);
+            table->ByType.resize(table->Events.size());
+            for (uint32 i = 0; i < table->Events.size(); ++i)
+            {
+                EventAI_Type type = table->Events[i].event_type;
+                table->ByType[fill[type]++] = i;
+                if (IsTimerBasedEvent(type))
+                {
+                    table->Polled.push_back(i);
+                }
+            }
+
+            tables[slot] = table;
+        }
+    }
+}
+
+/**
+ * @brief Returns the shared event table a creature of an entry uses on a map.
+ *
+ * @param entry The creature entry.
+ * @param map The map the creature is spawned on.
+ * @return The event table, or NULL if the entry has no EventAI events at all.
+ */
+CreatureEventAI_EventTablePtr CreatureEventAIMgr::GetEventTable(uint32 entry, Map const* map) const
+{
+    CreatureEventAI_EventTable_Map::const_iterator itr = m_CreatureEventAI_EventTable_Map.find(entry);
+    if (itr == m_CreatureEventAI_EventTable_Map.end())
+    {
+        return CreatureEventAI_EventTablePtr();
+    }
+
+    return itr->second[map->IsDungeon() ? 1 + map->GetSpawnMode() : 0];
+}
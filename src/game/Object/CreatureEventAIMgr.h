@@ -42,12 +42,21 @@ class CreatureEventAIMgr
         CreatureEventAI_Event_Map  const& GetCreatureEventAIMap()       const { return m_CreatureEventAI_Event_Map; }
         CreatureEventAI_Summon_Map const& GetCreatureEventAISummonMap() const { return m_CreatureEventAI_Summon_Map; }
 
+        /// Events of the entry usable on the map, NULL if the entry has no EventAI script
+        CreatureEventAI_EventTablePtr GetEventTable(uint32 entry, Map const* map) const;
+
     private:
         void CheckUnusedAITexts();
         void CheckUnusedAISummons();
+        void BuildEventTables();
+
+        // One table per map kind: open world, then each dungeon difficulty
+        typedef CreatureEventAI_EventTablePtr CreatureEventAI_EventTables[1 + MAX_DIFFICULTY];
+        typedef std::unordered_map<uint32, CreatureEventAI_EventTables> CreatureEventAI_EventTable_Map;
 
         CreatureEventAI_Event_Map  m_CreatureEventAI_Event_Map;
         CreatureEventAI_Summon_Map m_CreatureEventAI_Summon_Map;
+        CreatureEventAI_EventTable_Map m_CreatureEventAI_EventTable_Map;
 
         uint32 m_usedTextsAmount;
 };
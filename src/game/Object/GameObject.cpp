@@ -760,6 +760,7 @@ void GameObject::Respawn()
     {
         m_respawnTime = time(NULL);
         GetMap()->GetPersistentState()->SaveGORespawnTime(GetGUIDLow(), 0);
+        WakeUpdateCell();
     }
 }
 
@@ -1293,6 +1294,7 @@ bool GameObject::IsFriendlyTo(Unit const* unit) const
 void GameObject::SetLootState(LootState state)
 {
     m_lootState = state;
+    WakeUpdateCell();
 #ifdef ENABLE_ELUNA
     if (Eluna* e = GetEluna())
     {
@@ -719,6 +719,7 @@ class GameObject : public WorldObject
         bool Create(uint32 guidlow, uint32 name_id, Map* map, uint32 phaseMask, float x, float y, float z, float ang,
                     const QuaternionData& rotation = QuaternionData(), uint8 animprogress = GO_ANIMPROGRESS_DEFAULT, GOState go_state = GO_STATE_READY);
         void Update(uint32 update_diff, uint32 p_time) override;
+        uint32 GetQuiescentTime() const override;
         GameObjectInfo const* GetGOInfo() const;
 
         bool IsTransport() const;
@@ -784,6 +785,7 @@ class GameObject : public WorldObject
         {
             m_respawnTime = respawn > 0 ? time(NULL) + respawn : 0;
             m_respawnDelayTime = respawn > 0 ? uint32(respawn) : 0;
+            WakeUpdateCell();
         }
         void Respawn();
         bool isSpawned() const
@@ -394,3 +394,48 @@ void GameObject::Update(uint32 update_diff, uint32 p_time)
         m_AI_locked = false;
     }
 }
+
+/**
+ * @brief How long this game object's Update can be skipped.
+ *
+ * Only a ready object without AI, traps and charges qualifies: it waits for a use, which
+ * wakes it, or for its respawn timer. Transports are moved by their map, not by Update.
+ *
+ * @return Milliseconds, 0 if the object needs every tick.
+ */
+uint32 GameObject::GetQuiescentTime() const
+{
+    if (GetObjectGuid().IsMOTransport())
+    {
+        return UINT32_MAX;
+    }
+
+#ifdef ENABLE_ELUNA
+    // the script engine gets its own tick through Update
+    return 0;
+#else
+    if (m_lootState != GO_READY || m_AI)
+    {
+        return 0;
+    }
+
+    GameObjectInfo const* goInfo = GetGOInfo();
+    if (goInfo->type == GAMEOBJECT_TYPE_TRAP || goInfo->type == GAMEOBJECT_TYPE_FISHINGNODE || goInfo->GetCharges())
+    {
+        return 0;
+    }
+
+    if (m_respawnTime > 0)
+    {
+        time_t now = time(NULL);
+        if (m_respawnTime <= now)
+        {
+            return 0;
+        }
+
+        return uint32(std::min<time_t>(m_respawnTime - now, time_t(DAY)) * IN_MILLISECONDS);
+    }
+
+    return UINT32_MAX;
+#endif /* ENABLE_ELUNA */
+}
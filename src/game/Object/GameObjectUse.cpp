@@ -76,6 +76,8 @@ void GameObject::Use(Unit* user)
     // user must be provided
     MANGOS_ASSERT(user || PrintEntryError("GameObject::Use (without user)"));
 
+    WakeUpdateCell();
+
     // by default spell caster is user
     Unit* spellCaster = user;
     uint32 spellId = 0;
@@ -162,6 +162,18 @@ void GuardAI::UpdateAI(const uint32 /*diff*/)
     DoMeleeAttackIfReady();
 }
 
+/**
+ * @brief Checks whether UpdateAI has anything to do.
+ *
+ * Guards pick fights in MoveInLineOfSight; out of combat UpdateAI finds no victim and returns.
+ *
+ * @return true while the creature is out of combat.
+ */
+bool GuardAI::IsIdle() const
+{
+    return !m_creature->IsInCombat();
+}
+
 /**
  * @brief Checks whether a unit can be seen by this guard.
  *
@@ -52,6 +52,7 @@ class GuardAI : public CreatureAI
         bool CanIgnoreForRelocationNotify(Unit*) const override;
 
         void UpdateAI(const uint32) override;
+        bool IsIdle() const override;
         static int Permissible(const Creature*);
 
     private:
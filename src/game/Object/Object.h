@@ -675,6 +675,20 @@ class WorldObject : public Object
 
         virtual void Update(uint32 /*update_diff*/, uint32 /*time_diff*/);
 
+        /**
+         * @brief How long Update() can be left out without changing what the object does.
+         *
+         * Map::Update lets a cell sleep while every object in it answers non-zero. An
+         * override must only answer for state that Update() alone would change; anything
+         * else that disturbs the object goes through WakeUpdateCell().
+         *
+         * @return milliseconds, 0 if the object needs every tick
+         */
+        virtual uint32 GetQuiescentTime() const { return 0; }
+
+        /// Tell the map that this object's cell needs its next tick.
+        void WakeUpdateCell();
+
         void _Create(uint32 guidlow, HighGuid guidhigh, uint32 phaseMask);
 
         /// A VEHICLE SEAT, and only ever that. Nothing aboard a ship has one: she is a
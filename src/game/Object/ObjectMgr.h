@@ -1199,14 +1199,14 @@ class ObjectMgr
             return mMapObjectGuids[MAKE_PAIR32(mapid, spawnMode)][cell_id];
         }
 
-        // Read-only per-cell spawn lookup for diagnostics. Unlike
+        // Read-only per-cell spawn lookup for diagnostics and grid preloading. Unlike
         // GetCellObjectGuids() this is find-based and const: it never
         // inserts an empty entry on miss, so scanning many cells (e.g. a
         // whole grid) does not mutate mMapObjectGuids. Returns NULL when
         // the cell has no static DB spawn definitions.
-        CellObjectGuids const* GetCellObjectGuidsReadOnly(uint16 mapid, uint32 cell_id) const
+        CellObjectGuids const* GetCellObjectGuidsReadOnly(uint16 mapid, uint32 cell_id, uint8 spawnMode = 0) const
         {
-            MapObjectGuids::const_iterator mapItr = mMapObjectGuids.find(mapid);
+            MapObjectGuids::const_iterator mapItr = mMapObjectGuids.find(MAKE_PAIR32(mapid, spawnMode));
             if (mapItr == mMapObjectGuids.end())
             {
                 return NULL;
@@ -6518,7 +6518,7 @@ void Player::UpdateArmorSpecializations()
 
         // recalculate modifier depending on current tree
         aura->ApplyModifier(false, false);
-        aura->GetModifier()->m_amount = CalculateSpellDamage(this, spellProto, EFFECT_INDEX_0);
+        aura->ChangeAmount(CalculateSpellDamage(this, spellProto, EFFECT_INDEX_0), false);
         aura->ApplyModifier(true, false);
     }
 }
@@ -57,6 +57,7 @@
 #include "Unit.h"
 #include "PlayerTaxi.h" // Player needs full PlayerTaxi
 #include <utility>
+#include <tuple>
 #include <queue>
 #include "Common/ServerDefines.h"
 #include "Utilities/Errors.h"
@@ -78,6 +79,7 @@
 #include "CurrencyMgr.h" // CurrencyMgr is held by value on Player; brings in PlayerCurrency struct + PlayerCurrencyState/Flag enums + PlayerCurrenciesMap typedef
 #include "RuneMgr.h"    // RuneMgr is held by value on Player; brings in RuneType/RuneInfo/Runes + owns death-knight rune state
 #include "SpellCooldownMgr.h" // SpellCooldownMgr is held by value on Player; brings in SpellCooldown/SpellCooldowns + owns the cooldown map
+#include "SavedRowTracker.h"  // aura and stat rows as last written, so autosaves skip what did not change
 
 #include "Database/DatabaseEnv.h"
 #include "NPCHandler.h"
@@ -4041,6 +4043,11 @@ class Player : public Unit
         std::unique_ptr<CUFProfile> m_cufProfiles[MAX_CUF_PROFILES]; // raid-frame layouts, echoed back on login
         bool m_cufProfilesChanged = false;                           // only rewrite the table when the client edited them
 
+        typedef std::tuple<uint64, uint32, uint32> SavedAuraKey;     // caster guid, cast item guid, spell id
+        SavedRowTracker<SavedAuraKey> m_savedAuras;                  // character_aura rows as last written
+        SavedRowTracker<uint32> m_savedStats;                        // the single character_stats row
+        std::shared_ptr<std::atomic<bool> > m_saveFailed = std::make_shared<std::atomic<bool> >(false); // set by a save transaction that did not commit
+
         float m_auraBaseMod[BASEMOD_END][MOD_END];
         int16 m_baseRatingValue[MAX_COMBAT_RATING];
         uint16 m_baseSpellPower;
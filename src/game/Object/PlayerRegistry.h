@@ -29,7 +29,7 @@
 #include <utility>
 #include "ObjectGuid.h"
 #include "Policies/Singleton.h"
-#include "Utilities/ConcurrentRegistry.h"
+#include "Utilities/LockFreeRegistry.h"
 
 class Player;
 
@@ -44,6 +44,10 @@ class Player;
  * The index is held by composition rather than inheritance, which is what closes
  * the hazard in the old HashMapHolder/Player2Corpse pair: with no virtual
  * functions anywhere, the derived Insert/Remove only hid the base ones.
+ *
+ * Lookups come from every map thread -- guild and group broadcasts, whispers,
+ * ObjectLookup -- while logins and logouts are rare, so the index is a
+ * LockFreeRegistry: reads take no lock and write no shared memory.
  */
 class PlayerRegistry : public MaNGOS::Singleton<PlayerRegistry>
 {
@@ -72,7 +76,7 @@ class PlayerRegistry : public MaNGOS::Singleton<PlayerRegistry>
         void Add(Player* player);
         void Remove(Player* player);
 
-        /// Run work(Player*) over everyone online, under the shared lock.
+        /// Run work(Player*) over everyone online; a player logging out meanwhile stays valid until it returns.
         template <typename F>
         void ForEach(F&& work) const
         {
@@ -86,7 +90,7 @@ class PlayerRegistry : public MaNGOS::Singleton<PlayerRegistry>
         PlayerRegistry() = default;
         ~PlayerRegistry() = default;
 
-        MaNGOS::ConcurrentRegistry<ObjectGuid, Player> m_players;
+        MaNGOS::LockFreeRegistry<ObjectGuid, Player> m_players;
 };
 
 #define sPlayerRegistry MaNGOS::Singleton<PlayerRegistry>::Instance()
@@ -83,6 +83,7 @@
 #endif /* ENABLE_ELUNA */
 
 #include <cmath>
+#include <tuple>
 
 /*********************************************************/
 /***                   SAVE SYSTEM                     ***/
@@ -109,6 +110,16 @@ void Player::SaveToDB()
 
     CharacterDatabase.BeginTransaction();
 
+    // A previous save never committed, so the row trackers remember rows the
+    // database does not have. Forget them: this save rewrites those tables in full.
+    if (m_saveFailed->exchange(false))
+    {
+        m_savedAuras.Invalidate();
+        m_savedStats.Invalidate();
+        m_spellCooldownMgr.InvalidateSavedRows();
+    }
+    CharacterDatabase.SetTransactionFailureFlag(m_saveFailed);
+
 #ifdef ENABLE_ELUNA
     // Hack to check that this is not on create save
     if (Eluna* e = GetEluna())
@@ -337,15 +348,18 @@ void Player::SaveToDB()
     _SaveCUFProfiles();
     _SaveTalents();
 
-    CharacterDatabase.CommitTransaction();
-
     // check if stats should only be saved on logout
-    // save stats can be out of transaction
+    // saved with the rest, so a failed commit also forgets the stats row
     if (m_session->isLogingOut() || !sWorld.getConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT))
     {
         _SaveStats();
     }
 
+    if (!CharacterDatabase.CommitTransaction())
+    {
+        m_saveFailed->store(true);
+    }
+
     // save pet (hunter pet level and experience and all type pets health/mana).
     if (Pet* pet = GetPet())
     {
@@ -436,22 +450,25 @@ void Player::_SaveActions()
 void Player::_SaveAuras()
 {
     static SqlStatementID deleteAuras ;
+    static SqlStatementID deleteAura ;
     static SqlStatementID insertAuras ;
 
-    SqlStatement stmt = CharacterDatabase.CreateStatement(deleteAuras, "DELETE FROM `character_aura` WHERE `guid` = ?");
-    stmt.PExecute(GetGUIDLow());
-
-    SpellAuraHolderMap const& auraHolders = GetSpellAuraHolderMap();
-
-    if (auraHolders.empty())
+    // Only the first save of the session rewrites the table; after that, auras whose
+    // row is already in the database as it is (permanent buffs, mostly) are skipped.
+    if (!m_savedAuras.IsValid())
     {
-        return;
+        SqlStatement stmt = CharacterDatabase.CreateStatement(deleteAuras, "DELETE FROM `character_aura` WHERE `guid` = ?");
+        stmt.PExecute(GetGUIDLow());
     }
 
-    stmt = CharacterDatabase.CreateStatement(insertAuras, "INSERT INTO `character_aura` (`guid`, `caster_guid`, `item_guid`, `spell`, `stackcount`, `remaincharges`, "
+    SqlStatement stmtDel = CharacterDatabase.CreateStatement(deleteAura, "DELETE FROM `character_aura` WHERE `guid` = ? AND `caster_guid` = ? AND `item_guid` = ? AND `spell` = ?");
+    SqlStatement stmt = CharacterDatabase.CreateStatement(insertAuras, "INSERT INTO `character_aura` (`guid`, `caster_guid`, `item_guid`, `spell`, `stackcount`, `remaincharges`, "
             "`basepoints0`, `basepoints1`, `basepoints2`, `periodictime0`, `periodictime1`, `periodictime2`, `maxduration`, `remaintime`, `effIndexMask`) "
             "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
 
+    m_savedAuras.Begin();
+
+    SpellAuraHolderMap const& auraHolders = GetSpellAuraHolderMap();
     for (SpellAuraHolderMap::const_iterator itr = auraHolders.begin(); itr != auraHolders.end(); ++itr)
     {
         SpellAuraHolder* holder = itr->second;
@@ -490,6 +507,27 @@ void Player::_SaveAuras()
                 continue;
             }
 
+            SavedAuraKey key(holder->GetCasterGuid().GetRawValue(), holder->GetCastItemGuid().GetCounter(), holder->GetId());
+
+            RowFingerprint row;
+            row << holder->GetStackAmount() << holder->GetAuraCharges();
+            for (uint32 i = 0; i < MAX_EFFECT_INDEX; ++i)
+            {
+                row << damage[i] << periodicTime[i];
+            }
+            row << holder->GetAuraMaxDuration() << holder->GetAuraDuration() << effIndexMask;
+
+            switch (m_savedAuras.Check(key, row.Value()))
+            {
+                case SAVED_ROW_UNCHANGED:
+                    continue;
+                case SAVED_ROW_CHANGED:
+                    stmtDel.PExecute(GetGUIDLow(), std::get<0>(key), std::get<1>(key), std::get<2>(key));
+                    break;
+                case SAVED_ROW_NEW:
+                    break;
+            }
+
             stmt.addUInt32(GetGUIDLow());
             stmt.addUInt64(holder->GetCasterGuid().GetRawValue());
             stmt.addUInt32(holder->GetCastItemGuid().GetCounter());
@@ -513,6 +551,14 @@ void Player::_SaveAuras()
             stmt.Execute();
         }
     }
+
+    // auras that were saved last time and have since expired or been removed
+    std::vector<SavedAuraKey> gone;
+    m_savedAuras.Finish(gone);
+    for (std::vector<SavedAuraKey>::const_iterator itr = gone.begin(); itr != gone.end(); ++itr)
+    {
+        stmtDel.PExecute(GetGUIDLow(), std::get<0>(*itr), std::get<1>(*itr), std::get<2>(*itr));
+    }
 }
 
 // Player::_SaveGlyphs moved to GlyphMgr::Save (2026-05-12); thin delegating wrapper lives inline in Player.h.
@@ -1053,6 +1099,37 @@ void Player::_SaveStats()
         return;
     }
 
+    // Stats move with gear and buffs, not with time: most autosaves find the row
+    // exactly as it was written last time.
+    RowFingerprint row;
+    row << GetMaxHealth();
+    for (uint32 i = 0; i < MAX_STORED_POWERS; ++i)
+    {
+        row << GetMaxPowerByIndex(i);
+    }
+    for (int i = 0; i < MAX_STATS; ++i)
+    {
+        row << GetStat(Stats(i));
+    }
+    for (int i = 0; i < MAX_SPELL_SCHOOL; ++i)
+    {
+        row << GetResistance(SpellSchools(i));
+    }
+    row << GetFloatValue(PLAYER_BLOCK_PERCENTAGE) << GetFloatValue(PLAYER_DODGE_PERCENTAGE)
+        << GetFloatValue(PLAYER_PARRY_PERCENTAGE) << GetFloatValue(PLAYER_CRIT_PERCENTAGE)
+        << GetFloatValue(PLAYER_RANGED_CRIT_PERCENTAGE) << GetFloatValue(PLAYER_SPELL_CRIT_PERCENTAGE1)
+        << GetUInt32Value(UNIT_FIELD_ATTACK_POWER) << GetUInt32Value(UNIT_FIELD_RANGED_ATTACK_POWER)
+        << GetBaseSpellPowerBonus();
+
+    m_savedStats.Begin();
+    SavedRowState state = m_savedStats.Check(0, row.Value());
+    std::vector<uint32> gone;
+    m_savedStats.Finish(gone);
+    if (state == SAVED_ROW_UNCHANGED)
+    {
+        return;
+    }
+
     static SqlStatementID delStats ;
     static SqlStatementID insertStats ;
 
@@ -111,6 +111,18 @@ void ReactorAI::UpdateAI(const uint32 /*time_diff*/)
     DoMeleeAttackIfReady();
 }
 
+/**
+ * @brief Checks whether UpdateAI has anything to do.
+ *
+ * A reactor waits to be attacked, which starts combat; until then there is nothing to tick.
+ *
+ * @return true while the creature is out of combat.
+ */
+bool ReactorAI::IsIdle() const
+{
+    return !m_creature->IsInCombat();
+}
+
 /**
  * @brief Clears combat state and returns the creature home when evading.
  */
@@ -43,6 +43,7 @@ class ReactorAI : public CreatureAI
         bool IsVisible(Unit*) const override;
 
         void UpdateAI(const uint32) override;
+        bool IsIdle() const override;
         static int Permissible(const Creature*);
 
     private:
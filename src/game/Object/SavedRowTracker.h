@@ -0,0 +1,189 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file SavedRowTracker.h
+ * @brief Remembers which rows of a character sub-table are already in the database.
+ *
+ * Most of the character tables carry their own NEW/CHANGED/UNCHANGED state and are
+ * saved row by row. A few never did -- auras, spell cooldowns, stats -- and were
+ * rewritten in full on every autosave: DELETE everything, INSERT everything, even
+ * when nothing had moved since the last save. For those, the tracker keeps a
+ * fingerprint of every row as it was last written, so the save can skip the rows
+ * that still match and delete only the ones that went away.
+ *
+ * The first save of a session knows nothing about the database and rewrites the
+ * table as before; every later save is incremental.
+ *
+ * A save is recorded as it is queued, before its transaction commits. If the
+ * transaction then fails, the owner learns of it from the transaction's failure
+ * flag and calls Invalidate(), so the next save rewrites the table in full.
+ */
+
+#ifndef MANGOS_H_SAVEDROWTRACKER
+#define MANGOS_H_SAVEDROWTRACKER
+
+#include "Platform/Define.h"
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <vector>
+
+/// Rows that the trackers found unchanged and did not write, since startup.
+inline std::atomic<uint64>& SavedRowsSkipped()
+{
+    static std::atomic<uint64> skipped(0);
+    return skipped;
+}
+
+/// What a save has to do with one row.
+enum SavedRowState
+{
+    SAVED_ROW_UNCHANGED,                                    ///< in the database as it is: skip it
+    SAVED_ROW_NEW,                                          ///< not in the database: INSERT
+    SAVED_ROW_CHANGED                                       ///< in the database, but stale: replace it
+};
+
+/**
+ * @brief Per-character record of one sub-table as last written.
+ *
+ * @tparam Key the row's primary key within the character's rows; whatever the
+ *             save needs to DELETE a row that went away
+ */
+template<typename Key>
+class SavedRowTracker
+{
+    public:
+        SavedRowTracker() : m_valid(false), m_pass(0) {}
+
+        /// False until the first full rewrite; the save must then DELETE the whole table.
+        bool IsValid() const { return m_valid; }
+
+        /// Forget everything, forcing the next save to rewrite the table.
+        void Invalidate() { m_valid = false; m_rows.clear(); }
+
+        /// Start a save. Every row still present must be passed to Check() before Finish().
+        void Begin() { ++m_pass; }
+
+        /**
+         * @brief Record the row under `key` and report what the save must do with it.
+         *
+         * Until the first Finish() every row is new: the caller has just emptied the table.
+         *
+         * @param key the row's primary key
+         * @param fingerprint a hash of every column that is written
+         * @return SavedRowState
+         */
+        SavedRowState Check(Key const& key, uint64 fingerprint)
+        {
+            std::pair<typename RowMap::iterator, bool> slot = m_rows.insert(typename RowMap::value_type(key, Row()));
+            Row& row = slot.first->second;
+            row.pass = m_pass;
+            if (!m_valid || slot.second)
+            {
+                row.fingerprint = fingerprint;
+                return SAVED_ROW_NEW;
+            }
+
+            if (row.fingerprint == fingerprint)
+            {
+                SavedRowsSkipped().fetch_add(1, std::memory_order_relaxed);
+                return SAVED_ROW_UNCHANGED;
+            }
+
+            row.fingerprint = fingerprint;
+            return SAVED_ROW_CHANGED;
+        }
+
+        /**
+         * @brief Close the save: collect the keys of rows that were not seen this time.
+         *
+         * @param gone receives the keys whose rows must be deleted
+         */
+        void Finish(std::vector<Key>& gone)
+        {
+            for (typename RowMap::iterator itr = m_rows.begin(); itr != m_rows.end();)
+            {
+                if (itr->second.pass != m_pass)
+                {
+                    if (m_valid)
+                    {
+                        gone.push_back(itr->first);
+                    }
+                    m_rows.erase(itr++);
+                }
+                else
+                {
+                    ++itr;
+                }
+            }
+
+            m_valid = true;
+        }
+
+    private:
+        struct Row
+        {
+            Row() : fingerprint(0), pass(0) {}
+
+            uint64 fingerprint;
+            uint32 pass;
+        };
+
+        typedef std::map<Key, Row> RowMap;
+
+        RowMap m_rows;
+        bool m_valid;
+        uint32 m_pass;
+};
+
+/// FNV-1a over the columns of a row, fed one value at a time.
+class RowFingerprint
+{
+    public:
+        RowFingerprint() : m_hash(UI64LIT(14695981039346656037)) {}
+
+        template<typename T>
+        RowFingerprint& operator<<(T value)
+        {
+            uint64 bits = 0;
+            static_assert(sizeof(T) <= sizeof(bits), "RowFingerprint takes scalar columns only");
+            memcpy(&bits, &value, sizeof(T));
+            for (uint32 i = 0; i < sizeof(T); ++i)
+            {
+                m_hash ^= (bits >> (i * 8)) & 0xFF;
+                m_hash *= UI64LIT(1099511628211);
+            }
+            return *this;
+        }
+
+        uint64 Value() const { return m_hash; }
+
+    private:
+        uint64 m_hash;
+};
+
+#endif
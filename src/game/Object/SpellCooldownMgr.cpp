@@ -315,15 +315,26 @@ void SpellCooldownMgr::LoadFromDB(QueryResult* result)
 
 void SpellCooldownMgr::SaveToDB()
 {
+    static SqlStatementID deleteSpellCooldowns ;
     static SqlStatementID deleteSpellCooldown ;
     static SqlStatementID insertSpellCooldown ;
 
-    SqlStatement stmt = CharacterDatabase.CreateStatement(deleteSpellCooldown, "DELETE FROM `character_spell_cooldown` WHERE `guid` = ?");
-    stmt.PExecute(m_owner->GetGUIDLow());
+    // a cooldown's end time does not move once set, so after the first save only
+    // the cooldowns started or finished since the previous save touch the table
+    if (!m_saved.IsValid())
+    {
+        SqlStatement stmt = CharacterDatabase.CreateStatement(deleteSpellCooldowns, "DELETE FROM `character_spell_cooldown` WHERE `guid` = ?");
+        stmt.PExecute(m_owner->GetGUIDLow());
+    }
+
+    SqlStatement stmtDel = CharacterDatabase.CreateStatement(deleteSpellCooldown, "DELETE FROM `character_spell_cooldown` WHERE `guid` = ? AND `spell` = ?");
+    SqlStatement stmtIns = CharacterDatabase.CreateStatement(insertSpellCooldown, "INSERT INTO `character_spell_cooldown` (`guid`,`spell`,`item`,`time`) VALUES( ?, ?, ?, ?)");
 
     time_t curTime = time(NULL);
     time_t infTime = curTime + Player::infinityCooldownDelayCheck;
 
+    m_saved.Begin();
+
     // remove outdated and save active
     for (SpellCooldowns::iterator itr = m_cooldowns.begin(); itr != m_cooldowns.end();)
     {
@@ -333,8 +344,20 @@ void SpellCooldownMgr::SaveToDB()
         }
         else if (itr->second.end <= infTime)                // not save locked cooldowns, it will be reset or set at reload
         {
-            stmt = CharacterDatabase.CreateStatement(insertSpellCooldown, "INSERT INTO `character_spell_cooldown` (`guid`,`spell`,`item`,`time`) VALUES( ?, ?, ?, ?)");
-            stmt.PExecute(m_owner->GetGUIDLow(), itr->first, itr->second.itemid, uint64(itr->second.end));
+            RowFingerprint row;
+            row << itr->second.itemid << uint64(itr->second.end);
+
+            switch (m_saved.Check(itr->first, row.Value()))
+            {
+                case SAVED_ROW_UNCHANGED:
+                    break;
+                case SAVED_ROW_CHANGED:
+                    stmtDel.PExecute(m_owner->GetGUIDLow(), itr->first);
+                    // no break
+                case SAVED_ROW_NEW:
+                    stmtIns.PExecute(m_owner->GetGUIDLow(), itr->first, itr->second.itemid, uint64(itr->second.end));
+                    break;
+            }
             ++itr;
         }
         else
@@ -342,4 +365,12 @@ void SpellCooldownMgr::SaveToDB()
             ++itr;
         }
     }
+
+    // expired, removed or locked since the last save
+    std::vector<uint32> gone;
+    m_saved.Finish(gone);
+    for (std::vector<uint32>::const_iterator itr = gone.begin(); itr != gone.end(); ++itr)
+    {
+        stmtDel.PExecute(m_owner->GetGUIDLow(), *itr);
+    }
 }
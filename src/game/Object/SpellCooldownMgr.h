@@ -27,6 +27,7 @@
 #define MANGOS_H_SPELLCOOLDOWNMGR
 
 #include "Platform/Define.h"
+#include "SavedRowTracker.h"
 #include <ctime>
 #include <map>
 
@@ -81,11 +82,14 @@ class SpellCooldownMgr
         void RemoveAllSpellCooldown();
         void LoadFromDB(QueryResult* result);
         void SaveToDB();
+        /// The last save did not reach the database: rewrite the table at the next one.
+        void InvalidateSavedRows() { m_saved.Invalidate(); }
         void UpdatePotionCooldown(Spell* spell = NULL);
 
     private:
         Player* m_owner;
         SpellCooldowns m_cooldowns;
+        SavedRowTracker<uint32> m_saved;                    ///< character_spell_cooldown rows as last written, by spell id
 };
 
 #endif
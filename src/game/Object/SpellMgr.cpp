@@ -64,7 +64,7 @@ bool IsPrimaryProfessionSkill(uint32 skill)
 /**
  * @brief Initializes the spell manager.
  */
-SpellMgr::SpellMgr()
+SpellMgr::SpellMgr() : mSpellProcEventsGeneration(0)
 {
 }
 
@@ -1260,6 +1260,20 @@ class SpellMgr
             return NULL;
         }
 
+        // Proc flags a holder of this spell reacts to: spell_proc_event's if set, else the DBC's
+        uint32 GetSpellProcFlags(SpellEntry const* spellProto) const
+        {
+            SpellProcEventEntry const* spellProcEvent = GetSpellProcEvent(spellProto->ID);
+            if (spellProcEvent && spellProcEvent->procFlags)
+            {
+                return spellProcEvent->procFlags;
+            }
+            return spellProto->GetProcFlags();
+        }
+
+        // Changes on every (re)load of spell_proc_event, so that proc flags cached elsewhere can tell they are stale
+        uint32 GetSpellProcEventsGeneration() const { return mSpellProcEventsGeneration; }
+
         // Spell procs from item enchants
         float GetItemEnchantProcChance(uint32 spellid) const
         {
@@ -1535,6 +1549,7 @@ class SpellMgr
         SpellElixirMap     mSpellElixirs;
         SpellThreatMap     mSpellThreatMap;
         SpellProcEventMap  mSpellProcEventMap;
+        uint32             mSpellProcEventsGeneration;
         SpellProcItemEnchantMap mSpellProcItemEnchantMap;
         SpellBonusMap      mSpellBonusMap;
         SkillLineAbilityMap mSkillLineAbilityMap;
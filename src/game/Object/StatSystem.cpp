@@ -901,7 +901,7 @@ void Player::UpdateMasteryAuras()
             }
 
             aura->ApplyModifier(false, false);
-            aura->GetModifier()->m_amount = int32(masteryValue * masteryCoef / 100.0f);
+            aura->ChangeAmount(int32(masteryValue * masteryCoef / 100.0f), false);
             aura->ApplyModifier(true, false);
         }
     }
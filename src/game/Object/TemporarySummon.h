@@ -37,6 +37,7 @@ class TemporarySummon : public Creature
         virtual ~TemporarySummon() {};
 
         void Update(uint32 update_diff, uint32 time) override;
+        uint32 GetQuiescentTime() const override { return 0; }  // counts its lifetime down every tick
         void SetSummonProperties(TempSpawnType type, uint32 lifetime);
         void Summon(TempSpawnType type, uint32 lifetime);
         void UnSummon();
@@ -42,6 +42,7 @@ class Totem : public Creature
         virtual ~Totem() {};
         bool Create(uint32 guidlow, CreatureCreatePos& cPos, CreatureInfo const* cinfo, Unit* owner);
         void Update(uint32 update_diff, uint32 time) override;
+        uint32 GetQuiescentTime() const override { return 0; }  // counts its duration down every tick
         void Summon(Unit* owner);
         void UnSummon();
         uint32 GetSpell() const { return m_spells[0]; }
@@ -59,6 +59,7 @@
 #include "MapPersistentStateMgr.h"
 #include "GridNotifiersImpl.h"
 #include "CellImpl.h"
+#include "CellSpatialIndex.h"
 #include "MovementGenerator.h"
 #include "movement/MoveSplineInit.h"
 #include "movement/MoveSpline.h"
@@ -658,10 +659,14 @@ Unit::Unit() :
     // m_AurasCheck = 2000;
     // m_removeAuraTimer = 4;
     m_spellAuraHoldersUpdateIterator = m_spellAuraHolders.end();
+    m_procAurasGeneration = sSpellMgr.GetSpellProcEventsGeneration();
+    m_procDepth = 0;
     m_AuraFlags = 0;
 
     m_Visibility = VISIBILITY_ON;
     m_AINotifyScheduled = false;
+    m_spatialCell = CellSpatialIndex<Unit>::NOT_INDEXED;
+    m_spatialSlot = CellSpatialIndex<Unit>::NOT_INDEXED;
 
     m_detectInvisibilityMask = 0;
     m_invisibilityMask = 0;
@@ -734,6 +739,12 @@ Unit::~Unit()
         }
     }
 
+    // a unit deleted while still listed in a cell must not turn up in an area search
+    if (m_spatialCell != CellSpatialIndex<Unit>::NOT_INDEXED && FindMap())
+    {
+        FindMap()->RemoveSpatialEntry(this);
+    }
+
     delete m_charmInfo;
     delete m_vehicleInfo;
     delete movespline;
@@ -838,6 +849,65 @@ void Unit::Update(uint32 update_diff, uint32 p_time)
     i_motionMaster.UpdateMotion(p_time);
 }
 
+/**
+ * @brief Checks whether Unit::Update would only let time pass for this unit.
+ *
+ * Timers that Update counts down by update_diff (attack timers, the event clock) catch
+ * up on the next tick, which receives the whole elapsed time; anything that must fire
+ * at a given moment keeps the unit awake.
+ *
+ * @return True if the unit can go without updates until something disturbs it.
+ */
+bool Unit::IsQuiescent() const
+{
+    if (IsInCombat() || getVictim() || m_fixateTargetGuid || IsVehicle())
+    {
+        return false;
+    }
+
+    if (!m_Events.Empty() || !m_ThreatManager.isThreatListEmpty() || !m_gameObj.empty() ||
+        !m_deletedAuras.empty() || !m_deletedHolders.empty())
+    {
+        return false;
+    }
+
+    for (uint32 i = 0; i < CURRENT_MAX_SPELL; ++i)
+    {
+        if (m_currentSpells[i])
+        {
+            return false;
+        }
+    }
+
+    for (uint32 i = 0; i < MAX_REACTIVE; ++i)
+    {
+        if (m_reactiveTimer[i])
+        {
+            return false;
+        }
+    }
+
+    for (SpellAuraHolderMap::const_iterator itr = m_spellAuraHolders.begin(); itr != m_spellAuraHolders.end(); ++itr)
+    {
+        SpellAuraHolder const* holder = itr->second;
+        if (!(holder->IsPermanent() || holder->IsPassive()) || holder->IsAreaAura())
+        {
+            return false;
+        }
+
+        for (int32 j = 0; j < MAX_EFFECT_INDEX; ++j)
+        {
+            Aura const* aura = holder->GetAuraByEffectIndex(SpellEffectIndex(j));
+            if (aura && aura->IsPeriodic())
+            {
+                return false;
+            }
+        }
+    }
+
+    return movespline->Finalized() && i_motionMaster.GetCurrentMovementGeneratorType() == IDLE_MOTION_TYPE;
+}
+
 /**
  * @brief Processes pending melee swings against the current victim.
  *
@@ -5266,6 +5336,8 @@ void Unit::RemoveFromWorld()
     // cleanup
     if (IsInWorld())
     {
+        // a grid unload deletes its creatures without taking them off the grid first
+        GetMap()->RemoveSpatialEntry(this);
         Uncharm();
         RemoveNotOwnTrackedTargetAuras();
         RemoveGuardians();
@@ -5662,16 +5734,6 @@ bool Unit::IsFrozen() const
     return HasAuraState(AURA_STATE_FROZEN);
 }
 
-struct ProcTriggeredData
-{
-    ProcTriggeredData(SpellProcEventEntry const* _spellProcEvent, SpellAuraHolder* _triggeredByHolder)
-        : spellProcEvent(_spellProcEvent), triggeredByHolder(_triggeredByHolder)
-    {}
-    SpellProcEventEntry const* spellProcEvent;
-    SpellAuraHolder* triggeredByHolder;
-};
-
-typedef std::list< ProcTriggeredData > ProcTriggeredList;
 typedef std::list< uint32> RemoveSpellList;
 
 /**
@@ -5793,30 +5855,55 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* pTarget, uint32 procFlag,
         }
     }
 
+    // spell_proc_event was reloaded: the proc flags in the index may be stale
+    if (m_procAurasGeneration != sSpellMgr.GetSpellProcEventsGeneration())
+    {
+        RebuildProcAuraIndex();
+    }
+
+    // procs may trigger spells that proc again on this unit, so each nesting level
+    // has its own list; they are kept to save the allocation on the next event
+    if (m_procDepth == m_procTriggeredScratch.size())
+    {
+        m_procTriggeredScratch.push_back(ProcTriggeredList());
+    }
+    ProcTriggeredList& procTriggered = m_procTriggeredScratch[m_procDepth++];
+    procTriggered.clear();
+
+    bool damageTaken = isVictim && (procFlag & PROC_FLAG_TAKEN_ANY_DAMAGE);
+
     RemoveSpellList removedSpells;
-    ProcTriggeredList procTriggered;
     // Fill procTriggered list
-    for (SpellAuraHolderMap::const_iterator itr = GetSpellAuraHolderMap().begin(); itr != GetSpellAuraHolderMap().end(); ++itr)
+    for (size_t i = 0; i < m_procAuras.size(); ++i)
     {
+        // a holder without any of these flags cannot trigger (see IsSpellProcEventCanTriggeredBy)
+        // and only matters here if damage breaks it
+        if (!(m_procAuras[i].procFlags & procFlag) && !(damageTaken && m_procAuras[i].breaksOnDamage))
+        {
+            continue;
+        }
+
+        SpellAuraHolder* holder = m_procAuras[i].holder;
+
         // skip deleted auras (possible at recursive triggered call
-        if (itr->second->GetState() != SPELLAURAHOLDER_STATE_READY || itr->second->IsDeleted())
+        if (holder->GetState() != SPELLAURAHOLDER_STATE_READY || holder->IsDeleted())
         {
             continue;
         }
 
         SpellProcEventEntry const* spellProcEvent = NULL;
         // check if that aura is triggered by proc event (then it will be managed by proc handler)
-        if (!IsTriggeredAtSpellProcEvent(pTarget, itr->second, procSpell, procFlag, procExtra, attType, isVictim, spellProcEvent))
+        if (!IsTriggeredAtSpellProcEvent(pTarget, holder, procSpell, procFlag, procExtra, attType, isVictim, spellProcEvent))
         {
             // spell seem not managed by proc system, although some case need to be handled
 
             // only process damage case on victim
-            if (!isVictim || !(procFlag & PROC_FLAG_TAKEN_ANY_DAMAGE))
+            if (!damageTaken)
             {
                 continue;
             }
 
-            const SpellEntry* se = itr->second->GetSpellProto();
+            const SpellEntry* se = holder->GetSpellProto();
 
             // check if the aura is interruptible by damage and if its not just added by this spell (spell who is responsible for this damage is procSpell)
             if (se->GetAuraInterruptFlags() & AURA_INTERRUPT_FLAG_DAMAGE && (!procSpell || procSpell->ID != se->ID))
@@ -5827,8 +5914,8 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* pTarget, uint32 procFlag,
             continue;
         }
 
-        itr->second->SetInUse(true);                        // prevent holder deletion
-        procTriggered.push_back(ProcTriggeredData(spellProcEvent, itr->second));
+        holder->SetInUse(true);                             // prevent holder deletion
+        procTriggered.push_back(ProcTriggeredData(spellProcEvent, holder));
     }
 
     if (!procTriggered.empty())
@@ -5994,6 +6081,9 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* pTarget, uint32 procFlag,
         }
     }
 
+    procTriggered.clear();
+    --m_procDepth;
+
     if (!removedSpells.empty())
     {
         // Sort spells and remove duplicates
@@ -6130,6 +6220,10 @@ void Unit::InterruptMoving(bool forceSendStop /*=false*/)
         Movement::Location loc = movespline->ComputePosition();
         movespline->_Interrupt();
         Place().MoveTo(loc.x, loc.y, loc.z, loc.orientation);
+        if (IsInWorld())
+        {
+            GetMap()->RefreshSpatialEntry(this);
+        }
         isMoving = true;
     }
 
@@ -7142,6 +7236,7 @@ void Unit::ScheduleAINotify(uint32 delay)
     if (!IsAINotifyScheduled())
     {
         m_Events.AddEvent(new RelocationNotifyEvent(*this), m_Events.CalculateTime(delay));
+        WakeUpdateCell();
     }
 }
 
@@ -7164,6 +7259,10 @@ void Unit::OnRelocated()
         GetViewPoint().Call_UpdateVisibilityForOwner();
         UpdateObjectVisibility();
     }
+    if (IsInWorld())
+    {
+        GetMap()->RefreshSpatialEntry(this);
+    }
     ScheduleAINotify(World::GetRelocationAINotifyDelay());
 }
 
@@ -82,6 +82,9 @@
 #include "Timer.h"
 
 #include <list>
+#include <deque>
+#include <memory>
+#include <vector>
 
 /**
  * @brief Spell interrupt flags
@@ -1345,6 +1348,18 @@ enum PowerDefaults
 
 struct SpellProcEventEntry;                                 // used only privately
 
+/// A holder that passed its proc checks, waiting for its handlers to run.
+struct ProcTriggeredData
+{
+    ProcTriggeredData(SpellProcEventEntry const* _spellProcEvent, SpellAuraHolder* _triggeredByHolder)
+        : spellProcEvent(_spellProcEvent), triggeredByHolder(_triggeredByHolder)
+    {}
+    SpellProcEventEntry const* spellProcEvent;
+    SpellAuraHolder* triggeredByHolder;
+};
+
+typedef std::vector<ProcTriggeredData> ProcTriggeredList;
+
 #define MAX_OBJECT_SLOT 5
 
 // Combat reach is a GAME RULE about two units, not a property of either, so it is a
@@ -1453,6 +1468,14 @@ class Unit : public WorldObject
 
         void Update(uint32 update_diff, uint32 time) override;
 
+        /**
+         * Checks that Unit::Update has nothing to do for this unit: no combat, events,
+         * spells, expiring or ticking auras, reactive timers or movement in progress.
+         * \return true if skipping Unit::Update changes nothing but the elapsed time
+         * \see WorldObject::GetQuiescentTime
+         */
+        bool IsQuiescent() const;
+
         /**
          * Updates the attack time for the given WeaponAttackType
          * @param type The type of weapon that we want to update the time for
@@ -3802,6 +3825,20 @@ class Unit : public WorldObject
         AuraList const& GetAurasByType(AuraType type) const { return m_modAuras[type]; }
         void ApplyAuraProcTriggerDamage(Aura* aura, bool apply);
 
+        /**
+         * Forget the cached modifier totals of an \ref AuraType. Called whenever an
+         * \ref Aura of that type joins or leaves \ref Unit::m_modAuras, or changes
+         * its amount in place (see \ref Aura::ChangeAmount).
+         * @param type the aura type whose auras changed
+         */
+        void InvalidateAuraModifierTotals(AuraType type)
+        {
+            if (m_modAuraTotals[type])
+            {
+                m_modAuraTotals[type]->valid = false;
+            }
+        }
+
         int32 GetTotalAuraModifier(AuraType auratype) const;
         float GetTotalAuraMultiplier(AuraType auratype) const;
         int32 GetMaxPositiveAuraModifier(AuraType auratype) const;
@@ -3875,6 +3912,11 @@ class Unit : public WorldObject
         uint32 SpellCriticalHealingBonus(SpellEntry const* spellProto, uint32 damage, Unit* pVictim);
 
         bool IsTriggeredAtSpellProcEvent(Unit* pVictim, SpellAuraHolder* holder, SpellEntry const* procSpell, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, bool isVictim, SpellProcEventEntry const*& spellProcEvent);
+
+        // Holders ProcDamageAndSpellFor has to look at, see m_procAuras
+        void AddToProcAuraIndex(SpellAuraHolder* holder);
+        void RemoveFromProcAuraIndex(SpellAuraHolder* holder);
+        void RebuildProcAuraIndex();
         // Aura proc handlers
         SpellAuraProcResult HandleDummyAuraProc(Unit* pVictim, uint32 damage, Aura* triggeredByAura, SpellEntry const* procSpell, uint32 procFlag, uint32 procEx, uint32 cooldown);
         SpellAuraProcResult HandleHasteAuraProc(Unit* pVictim, uint32 damage, Aura* triggeredByAura, SpellEntry const* procSpell, uint32 procFlag, uint32 procEx, uint32 cooldown);
@@ -3990,6 +4032,12 @@ class Unit : public WorldObject
         void _SetAINotifyScheduled(bool on) { m_AINotifyScheduled = on;}       // only for call from RelocationNotifyEvent code
         void OnRelocated();
 
+        // Where the map's spatial index keeps this unit: the cell id and the slot in
+        // that cell's CellSpatialIndex. Only Map sets them.
+        uint32 GetSpatialCell() const { return m_spatialCell; }
+        uint32 GetSpatialSlot() const { return m_spatialSlot; }
+        void SetSpatialEntry(uint32 cell, uint32 slot) { m_spatialCell = cell; m_spatialSlot = slot; }
+
         bool IsLinkingEventTrigger() const { return m_isCreatureLinkingTrigger; }
 
         virtual bool CanSwim() const = 0;
@@ -4035,6 +4083,23 @@ class Unit : public WorldObject
 
         SpellAuraHolderMap m_spellAuraHolders;
         SpellAuraHolderMap::iterator m_spellAuraHoldersUpdateIterator; // != end() in Unit::m_spellAuraHolders update and point to next element
+
+        /**
+         * The holders that can react to a proc event: those with proc flags, and
+         * those that break on damage. Most auras on a raid-buffed unit are neither,
+         * so ProcDamageAndSpellFor scans this instead of every holder. Kept in
+         * m_spellAuraHolders order, which is the order procs have always fired in.
+         */
+        struct ProcAuraEntry
+        {
+            SpellAuraHolder* holder;
+            uint32 procFlags;                               // events it may proc from, 0 if none
+            bool breaksOnDamage;                            // AURA_INTERRUPT_FLAG_DAMAGE
+        };
+        std::vector<ProcAuraEntry> m_procAuras;
+        uint32 m_procAurasGeneration;                       // SpellMgr proc event generation m_procAuras was built for
+        std::deque<ProcTriggeredList> m_procTriggeredScratch; // one list per ProcDamageAndSpellFor nesting level
+        uint32 m_procDepth;
         AuraList m_deletedAuras;                            // auras removed while in ApplyModifier and waiting deleted
         SpellAuraHolderList m_deletedHolders;
 
@@ -4051,6 +4116,40 @@ class Unit : public WorldObject
         uint32 m_transform;
 
         AuraList m_modAuras[TOTAL_AURAS];
+
+        /**
+         * What the GetTotalAuraModifier family computes from one m_modAuras list,
+         * kept until the list or an amount on it changes. Damage, speed and stat
+         * code asks for the same few types several times per hit; with this they
+         * walk the list once per change instead of once per question.
+         *
+         * The lists themselves stay linked lists: callers across the core walk
+         * them while auras come and go.
+         */
+        struct AuraModifierTotals
+        {
+            /// The same, over the auras of one misc value.
+            struct MiscTotals
+            {
+                int32 miscValue;
+                int32 sum;
+                float product;
+                int32 maxPositive;
+                int32 maxNegative;
+            };
+
+            AuraModifierTotals() : valid(false), sum(0), product(1.0f), maxPositive(0), maxNegative(0) {}
+
+            bool valid;
+            int32 sum;
+            float product;                                  // of (100 + amount) / 100, in list order
+            int32 maxPositive;                              // 0 if none is positive
+            int32 maxNegative;                              // 0 if none is negative
+            std::vector<MiscTotals> byMisc;                 // one per misc value present, in list order
+        };
+        mutable std::unique_ptr<AuraModifierTotals> m_modAuraTotals[TOTAL_AURAS]; // allocated on first use
+        AuraModifierTotals const* GetAuraModifierTotals(AuraType type) const;
+        AuraModifierTotals::MiscTotals const* GetAuraMiscTotals(AuraType type, int32 misc_value) const;
         float m_auraModifiersGroup[UNIT_MOD_END][MODIFIER_TYPE_END];
         float m_weaponDamage[MAX_ATTACK][2];
         bool m_canModifyStats;
@@ -4097,6 +4196,8 @@ class Unit : public WorldObject
         UnitVisibility m_Visibility;
         Position m_last_notified_position;
         bool m_AINotifyScheduled;
+        uint32 m_spatialCell;
+        uint32 m_spatialSlot;
         TimeTracker m_movesplineTimer;
 
         Diminishing m_Diminishing;
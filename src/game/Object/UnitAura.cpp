@@ -68,22 +68,76 @@
 #include <stdarg.h>
 
 /**
- * @brief Sums all aura modifiers of a given type.
+ * @brief Gets the modifier totals of an aura type, recomputing them if stale.
  *
- * @param auratype The aura type to sum.
- * @return The total modifier amount.
+ * @param type The aura type to total.
+ * @return The totals, or NULL if no aura of that type is applied.
  */
-int32 Unit::GetTotalAuraModifier(AuraType auratype) const
+Unit::AuraModifierTotals const* Unit::GetAuraModifierTotals(AuraType type) const
 {
-    int32 modifier = 0;
+    AuraList const& auras = GetAurasByType(type);
+    if (auras.empty())
+    {
+        return NULL;
+    }
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    std::unique_ptr<AuraModifierTotals>& totals = m_modAuraTotals[type];
+    if (!totals)
     {
-        modifier += (*i)->GetModifier()->m_amount;
+        totals.reset(new AuraModifierTotals);
     }
 
-    return modifier;
+    if (totals->valid)
+    {
+        return totals.get();
+    }
+
+    totals->sum = 0;
+    totals->product = 1.0f;
+    totals->maxPositive = 0;
+    totals->maxNegative = 0;
+    totals->byMisc.clear();
+
+    for (AuraList::const_iterator i = auras.begin(); i != auras.end(); ++i)
+    {
+        Modifier const* mod = (*i)->GetModifier();
+
+        totals->sum += mod->m_amount;
+        totals->product *= (100.0f + mod->m_amount) / 100.0f;
+        totals->maxPositive = std::max(totals->maxPositive, mod->m_amount);
+        totals->maxNegative = std::min(totals->maxNegative, mod->m_amount);
+
+        std::vector<AuraModifierTotals::MiscTotals>::iterator misc = totals->byMisc.begin();
+        while (misc != totals->byMisc.end() && misc->miscValue != mod->m_miscvalue)
+        {
+            ++misc;
+        }
+        if (misc == totals->byMisc.end())
+        {
+            AuraModifierTotals::MiscTotals fresh = { mod->m_miscvalue, 0, 1.0f, 0, 0 };
+            misc = totals->byMisc.insert(totals->byMisc.end(), fresh);
+        }
+
+        misc->sum += mod->m_amount;
+        misc->product *= (100.0f + mod->m_amount) / 100.0f;
+        misc->maxPositive = std::max(misc->maxPositive, mod->m_amount);
+        misc->maxNegative = std::min(misc->maxNegative, mod->m_amount);
+    }
+
+    totals->valid = true;
+    return totals.get();
+}
+
+/**
+ * @brief Sums all aura modifiers of a given type.
+ *
+ * @param auratype The aura type to sum.
+ * @return The total modifier amount.
+ */
+int32 Unit::GetTotalAuraModifier(AuraType auratype) const
+{
+    AuraModifierTotals const* totals = GetAuraModifierTotals(auratype);
+    return totals ? totals->sum : 0;
 }
 
 /**
@@ -94,15 +148,8 @@ int32 Unit::GetTotalAuraModifier(AuraType auratype) const
  */
 float Unit::GetTotalAuraMultiplier(AuraType auratype) const
 {
-    float multiplier = 1.0f;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-    {
-        multiplier *= (100.0f + (*i)->GetModifier()->m_amount) / 100.0f;
-    }
-
-    return multiplier;
+    AuraModifierTotals const* totals = GetAuraModifierTotals(auratype);
+    return totals ? totals->product : 1.0f;
 }
 
 /**
@@ -113,16 +160,8 @@ float Unit::GetTotalAuraMultiplier(AuraType auratype) const
  */
 int32 Unit::GetMaxPositiveAuraModifier(AuraType auratype) const
 {
-    int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        if ((*i)->GetModifier()->m_amount > modifier)
-        {
-            modifier = (*i)->GetModifier()->m_amount;
-        }
-
-    return modifier;
+    AuraModifierTotals const* totals = GetAuraModifierTotals(auratype);
+    return totals ? totals->maxPositive : 0;
 }
 
 /**
@@ -133,16 +172,8 @@ int32 Unit::GetMaxPositiveAuraModifier(AuraType auratype) const
  */
 int32 Unit::GetMaxNegativeAuraModifier(AuraType auratype) const
 {
-    int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        if ((*i)->GetModifier()->m_amount < modifier)
-        {
-            modifier = (*i)->GetModifier()->m_amount;
-        }
-
-    return modifier;
+    AuraModifierTotals const* totals = GetAuraModifierTotals(auratype);
+    return totals ? totals->maxNegative : 0;
 }
 
 /**
@@ -154,20 +185,18 @@ int32 Unit::GetMaxNegativeAuraModifier(AuraType auratype) const
  */
 int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const
 {
-    if (!misc_mask)
+    AuraModifierTotals const* totals = misc_mask ? GetAuraModifierTotals(auratype) : NULL;
+    if (!totals)
     {
         return 0;
     }
 
     int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    for (std::vector<AuraModifierTotals::MiscTotals>::const_iterator i = totals->byMisc.begin(); i != totals->byMisc.end(); ++i)
     {
-        Modifier* mod = (*i)->GetModifier();
-        if (mod->m_miscvalue & misc_mask)
+        if (i->miscValue & misc_mask)
         {
-            modifier += mod->m_amount;
+            modifier += i->sum;
         }
     }
     return modifier;
@@ -182,20 +211,18 @@ int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask)
  */
 float Unit::GetTotalAuraMultiplierByMiscMask(AuraType auratype, uint32 misc_mask) const
 {
-    if (!misc_mask)
+    AuraModifierTotals const* totals = misc_mask ? GetAuraModifierTotals(auratype) : NULL;
+    if (!totals)
     {
         return 1.0f;
     }
 
     float multiplier = 1.0f;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    for (std::vector<AuraModifierTotals::MiscTotals>::const_iterator i = totals->byMisc.begin(); i != totals->byMisc.end(); ++i)
     {
-        Modifier* mod = (*i)->GetModifier();
-        if (mod->m_miscvalue & misc_mask)
+        if (i->miscValue & misc_mask)
         {
-            multiplier *= (100.0f + mod->m_amount) / 100.0f;
+            multiplier *= i->product;
         }
     }
     return multiplier;
@@ -210,23 +237,20 @@ float Unit::GetTotalAuraMultiplierByMiscMask(AuraType auratype, uint32 misc_mask
  */
 int32 Unit::GetMaxPositiveAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const
 {
-    if (!misc_mask)
+    AuraModifierTotals const* totals = misc_mask ? GetAuraModifierTotals(auratype) : NULL;
+    if (!totals)
     {
         return 0;
     }
 
     int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    for (std::vector<AuraModifierTotals::MiscTotals>::const_iterator i = totals->byMisc.begin(); i != totals->byMisc.end(); ++i)
     {
-        Modifier* mod = (*i)->GetModifier();
-        if (mod->m_miscvalue & misc_mask && mod->m_amount > modifier)
+        if (i->miscValue & misc_mask)
         {
-            modifier = mod->m_amount;
+            modifier = std::max(modifier, i->maxPositive);
         }
     }
-
     return modifier;
 }
 
@@ -239,47 +263,56 @@ int32 Unit::GetMaxPositiveAuraModifierByMiscMask(AuraType auratype, uint32 misc_
  */
 int32 Unit::GetMaxNegativeAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const
 {
-    if (!misc_mask)
+    AuraModifierTotals const* totals = misc_mask ? GetAuraModifierTotals(auratype) : NULL;
+    if (!totals)
     {
         return 0;
     }
 
     int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    for (std::vector<AuraModifierTotals::MiscTotals>::const_iterator i = totals->byMisc.begin(); i != totals->byMisc.end(); ++i)
     {
-        Modifier* mod = (*i)->GetModifier();
-        if (mod->m_miscvalue & misc_mask && mod->m_amount < modifier)
+        if (i->miscValue & misc_mask)
         {
-            modifier = mod->m_amount;
+            modifier = std::min(modifier, i->maxNegative);
         }
     }
-
     return modifier;
 }
 
 /**
- * @brief Sums aura modifiers of a type that match an exact misc value.
+ * @brief Finds the totals of the auras of a type with an exact misc value.
  *
- * @param auratype The aura type to inspect.
+ * @param type The aura type to inspect.
  * @param misc_value The exact misc value to match.
- * @return The total modifier amount.
+ * @return The misc value's totals, or NULL if no aura has it.
  */
-int32 Unit::GetTotalAuraModifierByMiscValue(AuraType auratype, int32 misc_value) const
+Unit::AuraModifierTotals::MiscTotals const* Unit::GetAuraMiscTotals(AuraType type, int32 misc_value) const
 {
-    int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    if (AuraModifierTotals const* totals = GetAuraModifierTotals(type))
     {
-        Modifier* mod = (*i)->GetModifier();
-        if (mod->m_miscvalue == misc_value)
+        for (std::vector<AuraModifierTotals::MiscTotals>::const_iterator i = totals->byMisc.begin(); i != totals->byMisc.end(); ++i)
         {
-            modifier += mod->m_amount;
+            if (i->miscValue == misc_value)
+            {
+                return &*i;
+            }
         }
     }
-    return modifier;
+    return NULL;
+}
+
+/**
+ * @brief Sums aura modifiers of a type that match an exact misc value.
+ *
+ * @param auratype The aura type to inspect.
+ * @param misc_value The exact misc value to match.
+ * @return The total modifier amount.
+ */
+int32 Unit::GetTotalAuraModifierByMiscValue(AuraType auratype, int32 misc_value) const
+{
+    AuraModifierTotals::MiscTotals const* misc = GetAuraMiscTotals(auratype, misc_value);
+    return misc ? misc->sum : 0;
 }
 
 /**
@@ -291,18 +324,8 @@ int32 Unit::GetTotalAuraModifierByMiscValue(AuraType auratype, int32 misc_value)
  */
 float Unit::GetTotalAuraMultiplierByMiscValue(AuraType auratype, int32 misc_value) const
 {
-    float multiplier = 1.0f;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-    {
-        Modifier* mod = (*i)->GetModifier();
-        if (mod->m_miscvalue == misc_value)
-        {
-            multiplier *= (100.0f + mod->m_amount) / 100.0f;
-        }
-    }
-    return multiplier;
+    AuraModifierTotals::MiscTotals const* misc = GetAuraMiscTotals(auratype, misc_value);
+    return misc ? misc->product : 1.0f;
 }
 
 /**
@@ -314,19 +337,8 @@ float Unit::GetTotalAuraMultiplierByMiscValue(AuraType auratype, int32 misc_valu
  */
 int32 Unit::GetMaxPositiveAuraModifierByMiscValue(AuraType auratype, int32 misc_value) const
 {
-    int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-    {
-        Modifier* mod = (*i)->GetModifier();
-        if (mod->m_miscvalue == misc_value && mod->m_amount > modifier)
-        {
-            modifier = mod->m_amount;
-        }
-    }
-
-    return modifier;
+    AuraModifierTotals::MiscTotals const* misc = GetAuraMiscTotals(auratype, misc_value);
+    return misc ? misc->maxPositive : 0;
 }
 
 /**
@@ -338,37 +350,24 @@ int32 Unit::GetMaxPositiveAuraModifierByMiscValue(AuraType auratype, int32 misc_
  */
 int32 Unit::GetMaxNegativeAuraModifierByMiscValue(AuraType auratype, int32 misc_value) const
 {
-    int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-    {
-        Modifier* mod = (*i)->GetModifier();
-        if (mod->m_miscvalue == misc_value && mod->m_amount < modifier)
-        {
-            modifier = mod->m_amount;
-        }
-    }
-
-    return modifier;
+    AuraModifierTotals::MiscTotals const* misc = GetAuraMiscTotals(auratype, misc_value);
+    return misc ? misc->maxNegative : 0;
 }
 
 float Unit::GetTotalAuraMultiplierByMiscValueForMask(AuraType auratype, uint32 mask) const
 {
-    if (!mask)
+    AuraModifierTotals const* totals = mask ? GetAuraModifierTotals(auratype) : NULL;
+    if (!totals)
     {
         return 1.0f;
     }
 
     float multiplier = 1.0f;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (AuraList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    for (std::vector<AuraModifierTotals::MiscTotals>::const_iterator i = totals->byMisc.begin(); i != totals->byMisc.end(); ++i)
     {
-        Modifier* mod = (*i)->GetModifier();
-        if (mask & (1 << (mod->m_miscvalue - 1)))
+        if (mask & (1 << (i->miscValue - 1)))
         {
-            multiplier *= (100.0f + mod->m_amount) / 100.0f;
+            multiplier *= i->product;
         }
     }
     return multiplier;
@@ -382,6 +381,8 @@ float Unit::GetTotalAuraMultiplierByMiscValueForMask(AuraType auratype, uint32 m
  */
 bool Unit::AddSpellAuraHolder(SpellAuraHolder* holder)
 {
+    WakeUpdateCell();
+
     SpellEntry const* aurSpellInfo = holder->GetSpellProto();
 
     // ghost spell check, allow apply any auras at player loading in ghost mode (will be cleanup after load)
@@ -446,7 +447,7 @@ bool Unit::AddSpellAuraHolder(SpellAuraHolder* holder)
                                     int32 remainingTicks = existing->GetAuraMaxTicks() - existing->GetAuraTicks();
                                     int32 remainingDamage = existing->GetModifier()->m_amount * remainingTicks;
 
-                                    aur->GetModifier()->m_amount += int32(remainingDamage / aur->GetAuraMaxTicks());
+                                    aur->ChangeAmount(aur->GetModifier()->m_amount + int32(remainingDamage / aur->GetAuraMaxTicks()), false);
                                 }
                                 else
                                 {
@@ -616,6 +617,7 @@ bool Unit::AddSpellAuraHolder(SpellAuraHolder* holder)
     // add aura, register in lists and arrays
     holder->_AddSpellAuraHolder();
     m_spellAuraHolders.insert(SpellAuraHolderMap::value_type(holder->GetId(), holder));
+    AddToProcAuraIndex(holder);
 
     for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
         if (Aura* aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
@@ -648,6 +650,7 @@ void Unit::AddAuraToModList(Aura* aura)
     if (aura->GetModifier()->m_auraname < TOTAL_AURAS)
     {
         m_modAuras[aura->GetModifier()->m_auraname].push_back(aura);
+        InvalidateAuraModifierTotals(aura->GetModifier()->m_auraname);
     }
 }
 
@@ -1450,6 +1453,7 @@ void Unit::RemoveSpellAuraHolder(SpellAuraHolder* holder, AuraRemoveMode mode)
             break;
         }
     }
+    RemoveFromProcAuraIndex(holder);
 
     holder->SetRemoveMode(mode);
     holder->UnregisterAndCleanupTrackedAuras();
@@ -1493,6 +1497,64 @@ void Unit::RemoveSpellAuraHolder(SpellAuraHolder* holder, AuraRemoveMode mode)
     }
 }
 
+/**
+ * @brief Registers a newly added holder in the proc aura index, if it belongs there.
+ *
+ * @param holder The holder just inserted into m_spellAuraHolders.
+ */
+void Unit::AddToProcAuraIndex(SpellAuraHolder* holder)
+{
+    SpellEntry const* spellProto = holder->GetSpellProto();
+
+    ProcAuraEntry entry;
+    entry.holder = holder;
+    entry.procFlags = sSpellMgr.GetSpellProcFlags(spellProto);
+    entry.breaksOnDamage = (spellProto->GetAuraInterruptFlags() & AURA_INTERRUPT_FLAG_DAMAGE) != 0;
+
+    if (!entry.procFlags && !entry.breaksOnDamage)
+    {
+        return;
+    }
+
+    // after every holder of the same or a lower spell id: where the multimap put it
+    std::vector<ProcAuraEntry>::iterator pos = m_procAuras.end();
+    while (pos != m_procAuras.begin() && (pos - 1)->holder->GetId() > holder->GetId())
+    {
+        --pos;
+    }
+    m_procAuras.insert(pos, entry);
+}
+
+/**
+ * @brief Drops a removed holder from the proc aura index.
+ *
+ * @param holder The holder just erased from m_spellAuraHolders.
+ */
+void Unit::RemoveFromProcAuraIndex(SpellAuraHolder* holder)
+{
+    for (std::vector<ProcAuraEntry>::iterator itr = m_procAuras.begin(); itr != m_procAuras.end(); ++itr)
+    {
+        if (itr->holder == holder)
+        {
+            m_procAuras.erase(itr);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Rebuilds the proc aura index from scratch, after spell_proc_event was reloaded.
+ */
+void Unit::RebuildProcAuraIndex()
+{
+    m_procAuras.clear();
+    for (SpellAuraHolderMap::const_iterator itr = m_spellAuraHolders.begin(); itr != m_spellAuraHolders.end(); ++itr)
+    {
+        AddToProcAuraIndex(itr->second);
+    }
+    m_procAurasGeneration = sSpellMgr.GetSpellProcEventsGeneration();
+}
+
 /**
  * @brief Removes a single aura effect from a holder.
  *
@@ -1530,6 +1592,7 @@ void Unit::RemoveAura(Aura* Aur, AuraRemoveMode mode)
     if (Aur->GetModifier()->m_auraname < TOTAL_AURAS)
     {
         m_modAuras[Aur->GetModifier()->m_auraname].remove(Aur);
+        InvalidateAuraModifierTotals(Aur->GetModifier()->m_auraname);
     }
 
     // Set remove mode
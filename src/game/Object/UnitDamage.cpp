@@ -522,10 +522,10 @@ void Unit::CalculateDamageAbsorbAndResist(Unit* pCaster, SpellSchoolMask schoolM
         }
 
         // Reduce shield amount
-        mod->m_amount -= currentAbsorb;
+        (*i)->ChangeAmount(mod->m_amount - currentAbsorb, false);
         if ((*i)->GetHolder()->DropAuraCharge())
         {
-            mod->m_amount = 0;
+            (*i)->ChangeAmount(0, false);
         }
         // Need remove it later
         if (mod->m_amount <= 0)
@@ -606,7 +606,7 @@ void Unit::CalculateDamageAbsorbAndResist(Unit* pCaster, SpellSchoolMask schoolM
             incanterAbsorption += currentAbsorb;
         }
 
-        (*i)->GetModifier()->m_amount -= currentAbsorb;
+        (*i)->ChangeAmount((*i)->GetModifier()->m_amount - currentAbsorb, false);
         if ((*i)->GetModifier()->m_amount <= 0)
         {
             RemoveAurasDueToSpell((*i)->GetId());
@@ -793,10 +793,10 @@ void Unit::CalculateHealAbsorb(const uint32 heal, uint32* absorb)
         RemainingHeal -= currentAbsorb;
 
         // Reduce aura amount
-        mod->m_amount -= currentAbsorb;
+        (*i)->ChangeAmount(mod->m_amount - currentAbsorb, false);
         if ((*i)->GetHolder()->DropAuraCharge())
         {
-            mod->m_amount = 0;
+            (*i)->ChangeAmount(0, false);
         }
         // Need remove it later
         if (mod->m_amount <= 0)
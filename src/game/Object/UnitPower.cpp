@@ -324,6 +324,7 @@ void Unit::ApplyAuraProcTriggerDamage(Aura* aura, bool apply)
     {
         tAuraProcTriggerDamage.remove(aura);
     }
+    InvalidateAuraModifierTotals(SPELL_AURA_PROC_TRIGGER_DAMAGE);
 }
 
 /**
@@ -372,6 +372,7 @@ void Unit::UpdateVisibilityAndView()
             if (!owner || !IsVisibleForOrDetect(owner, this, false))
             {
                 alist.erase(it);
+                InvalidateAuraModifierTotals(*type);
                 RemoveAura(aura);
                 it = alist.begin();
             }
@@ -670,6 +670,19 @@ void WorldObject::UpdateObjectVisibility()
 void WorldObject::AddToClientUpdateList()
 {
     GetMap()->AddUpdateObject(this);
+    // a changed field is a changed object: whatever its cell decided about it is stale
+    GetMap()->WakeCell(this);
+}
+
+/**
+ * @brief Wakes the cell this object is updated in, if it is asleep.
+ */
+void WorldObject::WakeUpdateCell()
+{
+    if (IsInWorld())
+    {
+        GetMap()->WakeCell(this);
+    }
 }
 
 /**
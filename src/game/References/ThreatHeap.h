@@ -0,0 +1,269 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file ThreatHeap.h
+ * @brief Indexed binary max-heap of threat entries.
+ *
+ * ThreatContainer used to keep its references in a std::list and sort the whole
+ * list whenever anything on it had gained threat -- which, in a raid fight, is
+ * every tick. The heap keeps the most hated entry on top instead and repairs
+ * itself in O(log n) when one entry's threat changes. Every entry remembers its
+ * own slot, so changing or removing it does not search for it.
+ *
+ * Entries compare by threat, highest first, and on equal threat by the order in
+ * which they joined the heap, so the order never depends on how the heap happens
+ * to be laid out.
+ */
+
+#ifndef MANGOS_H_THREATHEAP
+#define MANGOS_H_THREATHEAP
+
+#include "Platform/Define.h"
+
+#include <algorithm>
+#include <vector>
+
+template<class T> class ThreatHeap;
+
+/// The bookkeeping a ThreatHeap keeps in each of its entries. There is one
+/// slot, so an entry is in one heap at a time: take it out of one before
+/// pushing it onto another.
+class ThreatHeapNode
+{
+    public:
+        ThreatHeapNode() : iHeapSlot(NOT_IN_HEAP), iHeapOrder(0) {}
+
+    private:
+        template<class T> friend class ThreatHeap;
+
+        static const uint32 NOT_IN_HEAP = 0xFFFFFFFF;
+
+        uint32 iHeapSlot;                                   ///< index in the heap vector
+        uint32 iHeapOrder;                                  ///< joining order, breaks threat ties
+};
+
+/**
+ * @brief Max-heap of T* by T::getThreat().
+ *
+ * @tparam T derives from ThreatHeapNode and has `float getThreat() const`
+ */
+template<class T>
+class ThreatHeap
+{
+    public:
+        ThreatHeap() : iNextOrder(0) {}
+
+        bool empty() const { return iHeap.empty(); }
+        size_t size() const { return iHeap.size(); }
+
+        /// The most hated entry; NULL when empty.
+        T* top() const { return iHeap.empty() ? NULL : iHeap.front(); }
+
+        /// True if `entry` is in this heap (and not in another one).
+        bool contains(T const* entry) const
+        {
+            uint32 slot = entry->iHeapSlot;
+            return slot < iHeap.size() && iHeap[slot] == entry;
+        }
+
+        void push(T* entry)
+        {
+            entry->iHeapSlot = iHeap.size();
+            entry->iHeapOrder = iNextOrder++;
+            iHeap.push_back(entry);
+            siftUp(entry->iHeapSlot);
+        }
+
+        void remove(T* entry)
+        {
+            if (!contains(entry))
+            {
+                return;
+            }
+
+            uint32 slot = entry->iHeapSlot;
+            entry->iHeapSlot = ThreatHeapNode::NOT_IN_HEAP;
+
+            T* last = iHeap.back();
+            iHeap.pop_back();
+            if (last != entry)
+            {
+                place(last, slot);
+                reposition(last);
+            }
+        }
+
+        /// Restore the heap after the threat of `entry` changed.
+        void reposition(T* entry)
+        {
+            if (contains(entry))
+            {
+                siftDown(siftUp(entry->iHeapSlot));
+            }
+        }
+
+        void clear()
+        {
+            for (T* entry : iHeap)
+            {
+                entry->iHeapSlot = ThreatHeapNode::NOT_IN_HEAP;
+            }
+            iHeap.clear();
+        }
+
+        /// The entries in heap order -- unsorted, for visiting each once.
+        std::vector<T*> const& entries() const { return iHeap; }
+
+        /// Fill `sorted` with every entry, most hated first.
+        void sortInto(std::vector<T*>& sorted) const
+        {
+            sorted.assign(iHeap.begin(), iHeap.end());
+            std::sort(sorted.begin(), sorted.end(), &ThreatHeap::before);
+        }
+
+        /**
+         * @brief Visits the entries most hated first, paying only for what it visits.
+         *
+         * Finding the k most hated entries costs O(k log k), however long the heap
+         * is. The heap must not change while a walk is in progress, and a heap has
+         * one walk at a time.
+         */
+        class Walk
+        {
+            public:
+                explicit Walk(ThreatHeap const& heap) : iOwner(heap) { restart(); }
+
+                /// Start again from the most hated entry.
+                void restart()
+                {
+                    iOwner.iFrontier.clear();
+                    if (!iOwner.iHeap.empty())
+                    {
+                        iOwner.iFrontier.push_back(0);
+                    }
+                }
+
+                /// The next entry in descending order; NULL after the last.
+                T* next()
+                {
+                    std::vector<uint32>& frontier = iOwner.iFrontier;
+                    if (frontier.empty())
+                    {
+                        return NULL;
+                    }
+
+                    std::pop_heap(frontier.begin(), frontier.end(), Later(iOwner.iHeap));
+                    uint32 slot = frontier.back();
+                    frontier.pop_back();
+
+                    // a parent comes before both its children, so they are the only
+                    // new candidates for the place after it
+                    for (uint32 child = 2 * slot + 1; child <= 2 * slot + 2 && child < iOwner.iHeap.size(); ++child)
+                    {
+                        frontier.push_back(child);
+                        std::push_heap(frontier.begin(), frontier.end(), Later(iOwner.iHeap));
+                    }
+
+                    return iOwner.iHeap[slot];
+                }
+
+            private:
+                ThreatHeap const& iOwner;
+        };
+
+    private:
+        /// Strict order of the heap: more threat first, then who joined first.
+        static bool before(T const* lhs, T const* rhs)
+        {
+            if (lhs->getThreat() != rhs->getThreat())
+            {
+                return lhs->getThreat() > rhs->getThreat();
+            }
+            return lhs->iHeapOrder < rhs->iHeapOrder;
+        }
+
+        /// std::push_heap ordering over slots that puts the slot to visit first on top.
+        struct Later
+        {
+            explicit Later(std::vector<T*> const& heap) : iHeap(heap) {}
+            bool operator()(uint32 lhs, uint32 rhs) const { return before(iHeap[rhs], iHeap[lhs]); }
+            std::vector<T*> const& iHeap;
+        };
+
+        void place(T* entry, uint32 slot)
+        {
+            iHeap[slot] = entry;
+            entry->iHeapSlot = slot;
+        }
+
+        uint32 siftUp(uint32 slot)
+        {
+            T* entry = iHeap[slot];
+            while (slot > 0)
+            {
+                uint32 parent = (slot - 1) / 2;
+                if (!before(entry, iHeap[parent]))
+                {
+                    break;
+                }
+                place(iHeap[parent], slot);
+                slot = parent;
+            }
+            place(entry, slot);
+            return slot;
+        }
+
+        void siftDown(uint32 slot)
+        {
+            T* entry = iHeap[slot];
+            uint32 size = iHeap.size();
+            for (;;)
+            {
+                uint32 child = 2 * slot + 1;
+                if (child >= size)
+                {
+                    break;
+                }
+                if (child + 1 < size && before(iHeap[child + 1], iHeap[child]))
+                {
+                    ++child;
+                }
+                if (!before(iHeap[child], entry))
+                {
+                    break;
+                }
+                place(iHeap[child], slot);
+                slot = child;
+            }
+            place(entry, slot);
+        }
+
+        std::vector<T*> iHeap;
+        mutable std::vector<uint32> iFrontier;              ///< scratch of the current Walk
+        uint32 iNextOrder;
+};
+
+#endif
@@ -34,7 +34,7 @@
  * Key components:
  * - ThreatCalcHelper: Calculates threat values with modifiers
  * - HostileReference: Individual threat relationship between units
- * - ThreatContainer: Sorted list of threatening units
+ * - ThreatContainer: Heap of threatening units, most hated on top
  * - ThreatManager: Main threat management for a unit
  *
  * @see ThreatManager for the main manager class
@@ -43,7 +43,6 @@
  */
 
 #include "Utilities/Errors.h"
-#include <list>
 #include "ThreatManager.h"
 #include "Unit.h"
 #include "Creature.h"
@@ -327,12 +326,79 @@ Unit* HostileReference::getSourceUnit()
  */
 void ThreatContainer::clearReferences()
 {
-    for (ThreatList::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
+    ThreatList refs = iThreatHeap.entries();
+    iThreatHeap.clear();
+    iByGuid.clear();
+    iThreatList.clear();
+    iDirty = false;
+
+    for (ThreatList::const_iterator i = refs.begin(); i != refs.end(); ++i)
     {
         (*i)->unlink();
         delete(*i);
     }
-    iThreatList.clear();
+}
+
+/**
+ * @brief Add reference
+ * @param pHostileReference Reference to add
+ */
+void ThreatContainer::addReference(HostileReference* pHostileReference)
+{
+    iThreatHeap.push(pHostileReference);
+    iByGuid[pHostileReference->getUnitGuid().GetRawValue()] = pHostileReference;
+    iDirty = true;
+}
+
+/**
+ * @brief Remove reference
+ * @param pRef Reference to remove
+ */
+void ThreatContainer::remove(HostileReference* pRef)
+{
+    if (!iThreatHeap.contains(pRef))
+    {
+        return;
+    }
+
+    iThreatHeap.remove(pRef);
+
+    std::unordered_map<uint64, HostileReference*>::iterator itr = iByGuid.find(pRef->getUnitGuid().GetRawValue());
+    if (itr != iByGuid.end() && itr->second == pRef)
+    {
+        iByGuid.erase(itr);
+    }
+    iDirty = true;
+}
+
+/**
+ * @brief Reorder a reference whose threat has changed
+ * @param pRef Reference whose threat has changed
+ */
+void ThreatContainer::threatChanged(HostileReference* pRef)
+{
+    if (iThreatHeap.contains(pRef))
+    {
+        iThreatHeap.reposition(pRef);
+        iDirty = true;
+    }
+}
+
+/**
+ * @brief Get threat list
+ * @return References sorted by threat, most hated first
+ *
+ * Rebuilds the sorted copy from the heap if anything changed since it was last
+ * asked for.
+ */
+ThreatList const& ThreatContainer::getThreatList() const
+{
+    if (iDirty)
+    {
+        iThreatHeap.sortInto(iThreatList);
+        iDirty = false;
+    }
+    return iThreatList;
 }
 
 /**
@@ -340,22 +406,12 @@ void ThreatContainer::clearReferences()
  * @param pVictim Target unit to find
  * @return HostileReference or NULL if not found
  *
- * Searches for a hostile reference to the specified unit.
+ * Looks up the hostile reference to the specified unit.
  */
 HostileReference* ThreatContainer::getReferenceByTarget(Unit* pVictim)
 {
-    HostileReference* result = NULL;
-    ObjectGuid guid = pVictim->GetObjectGuid();
-    for (ThreatList::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-    {
-        if ((*i)->getUnitGuid() == guid)
-        {
-            result = (*i);
-            break;
-        }
-    }
-
-    return result;
+    std::unordered_map<uint64, HostileReference*>::const_iterator itr = iByGuid.find(pVictim->GetObjectGuid().GetRawValue());
+    return itr != iByGuid.end() ? itr->second : NULL;
 }
 
 /**
@@ -404,34 +460,6 @@ void ThreatContainer::modifyThreatPercent(Unit* pVictim, int32 pPercent)
 
 //============================================================
 
-/**
- * @brief Hostile reference sort predicate
- * @param lhs First reference
- * @param rhs Second reference
- * @return True if lhs has higher threat
- *
- * Sort predicate for ordering hostile references by threat (descending).
- */
-bool HostileReferenceSortPredicate(const HostileReference* lhs, const HostileReference* rhs)
-{
-    // std::list::sort ordering predicate must be: (Pred(x,y)&&Pred(y,x))==false
-    return lhs->getThreat() > rhs->getThreat();             // reverse sorting
-}
-
-/**
- * @brief Update threat container
- *
- * Sorts the threat list if it has been modified (dirty flag set).
- */
-void ThreatContainer::update()
-{
-    if (iDirty && iThreatList.size() > 1)
-    {
-        iThreatList.sort(HostileReferenceSortPredicate);
-    }
-    iDirty = false;
-}
-
 /**
  * @brief Select next victim to attack
  * @param pAttacker Creature selecting victim
@@ -441,6 +469,9 @@ void ThreatContainer::update()
  * Selects the next victim based on threat values and the
  * 110%/130% threat rules. Handles second choice targets and
  * melee/ranged threat thresholds.
+ *
+ * The references are visited most hated first straight from the heap; usually
+ * the answer is at or near the top, and the rest is never ordered.
  */
 HostileReference* ThreatContainer::selectNextVictim(Creature* pAttacker, HostileReference* pCurrentVictim)
 {
@@ -449,12 +480,12 @@ HostileReference* ThreatContainer::selectNextVictim(Creature* pAttacker, Hostile
     bool onlySecondChoiceTargetsFound = false;
     bool checkedCurrentVictim = false;
 
-    ThreatList::const_iterator lastRef = iThreatList.end();
-    --lastRef;
+    ThreatHeap<HostileReference>::Walk walk(iThreatHeap);
 
-    for (ThreatList::const_iterator iter = iThreatList.begin(); iter != iThreatList.end() && !found;)
+    for (HostileReference* pNextRef = walk.next(); pNextRef && !found;)
     {
-        pCurrentRef = (*iter);
+        pCurrentRef = pNextRef;
+        pNextRef = walk.next();
 
         Unit* pTarget = pCurrentRef->getTarget();
         MANGOS_ASSERT(pTarget);                             // if the ref has status online the target must be there!
@@ -464,15 +495,12 @@ HostileReference* ThreatContainer::selectNextVictim(Creature* pAttacker, Hostile
         //     This prevents dropping valid targets due to 1.1 or 1.3 threat rule vs invalid current target
         if (!onlySecondChoiceTargetsFound && pAttacker->IsSecondChoiceTarget(pTarget, pCurrentRef == pCurrentVictim))
         {
-            if (iter != lastRef)
-            {
-                ++iter;
-            }
-            else
+            if (!pNextRef)
             {
                 // if we reached to this point, everyone in the threatlist is a second choice target. In such a situation the target with the highest threat should be attacked.
                 onlySecondChoiceTargetsFound = true;
-                iter = iThreatList.begin();
+                walk.restart();
+                pNextRef = walk.next();
             }
 
             // current victim is a second choice target, so don't compare threat with it below
@@ -533,7 +561,6 @@ HostileReference* ThreatContainer::selectNextVictim(Creature* pAttacker, Hostile
                 break;
             }
         }
-        ++iter;
     }
     if (!found)
     {
@@ -697,7 +724,6 @@ void ThreatManager::modifyThreatPercent(Unit* pVictim, int32 pPercent)
  */
 Unit* ThreatManager::getHostileTarget()
 {
-    iThreatContainer.update();
     HostileReference* nextVictim = iThreatContainer.selectNextVictim((Creature*) getOwner(), getCurrentVictim());
     setCurrentVictim(nextVictim);
     return getCurrentVictim() != NULL ? getCurrentVictim()->getTarget() : NULL;
@@ -822,6 +848,8 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStat
             {
                 setDirty(true);                              // the order in the threat list might have changed
             }
+            iThreatContainer.threatChanged(hostileReference);
+            iThreatOfflineContainer.threatChanged(hostileReference);
             break;
         case UEV_THREAT_REF_ONLINE_STATUS:
             if (!hostileReference->isOnline())
@@ -842,9 +870,10 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStat
                 {
                     setDirty(true);
                 }
+                // out of the offline heap first: both heaps keep their slot in the reference
+                iThreatOfflineContainer.remove(hostileReference);
                 iThreatContainer.addReference(hostileReference);
                 iUpdateNeed = true;
-                iThreatOfflineContainer.remove(hostileReference);
             }
             break;
         case UEV_THREAT_REF_REMOVE_FROM_LIST:
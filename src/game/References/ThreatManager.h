@@ -33,7 +33,9 @@
 #include "UnitEvents.h"
 #include "Timer.h"
 #include "ObjectGuid.h"
-#include <list>
+#include "ThreatHeap.h"
+#include <unordered_map>
+#include <vector>
 
 //==============================================================
 
@@ -72,7 +74,7 @@ class ThreatCalcHelper
  *
  * Manages a hostile reference between a Unit and a ThreatManager.
  */
-class HostileReference : public Reference<Unit, ThreatManager>
+class HostileReference : public Reference<Unit, ThreatManager>, public ThreatHeapNode
 {
     public:
         /**
@@ -243,18 +245,25 @@ class HostileReference : public Reference<Unit, ThreatManager>
 //==============================================================
 class ThreatManager;
 
-typedef std::list<HostileReference*> ThreatList;
+/// Most hated first.
+typedef std::vector<HostileReference*> ThreatList;
 
 /**
  * @brief Threat container class
  *
- * Manages a list of hostile references and provides threat-related operations.
+ * Keeps hostile references in a ThreatHeap, so the most hated one is always on
+ * top and a change of threat costs O(log n) rather than a sort of the whole
+ * list. The sorted list that getThreatList() returns is built from the heap on
+ * demand -- it is needed for the client's threat display once a second, not on
+ * every tick.
  */
 class ThreatContainer
 {
     private:
-        ThreatList iThreatList; ///< Threat list
-        bool iDirty; ///< Dirty flag (needs sorting)
+        ThreatHeap<HostileReference> iThreatHeap; ///< All references, most hated on top
+        std::unordered_map<uint64, HostileReference*> iByGuid; ///< Reference per target guid
+        mutable ThreatList iThreatList; ///< Sorted copy of the heap handed out by getThreatList()
+        mutable bool iDirty; ///< Dirty flag (iThreatList needs rebuilding)
 
     protected:
         friend class ThreatManager;
@@ -263,13 +272,13 @@ class ThreatContainer
          * @brief Remove reference
          * @param pRef Reference to remove
          */
-        void remove(HostileReference* pRef) { iThreatList.remove(pRef); }
+        void remove(HostileReference* pRef);
 
         /**
          * @brief Add reference
          * @param pHostileReference Reference to add
          */
-        void addReference(HostileReference* pHostileReference) { iThreatList.push_back(pHostileReference); }
+        void addReference(HostileReference* pHostileReference);
 
         /**
          * @brief Clear all references
@@ -277,11 +286,13 @@ class ThreatContainer
         void clearReferences();
 
         /**
-         * @brief Update container
+         * @brief Reorder a reference whose threat has changed
          *
-         * Sort the list if necessary.
+         * Does nothing if the reference is not in this container.
+         *
+         * @param pRef Reference whose threat has changed
          */
-        void update();
+        void threatChanged(HostileReference* pRef);
 
     public:
         /**
@@ -289,6 +300,9 @@ class ThreatContainer
          */
         ThreatContainer() { iDirty = false; }
 
+        ThreatContainer(const ThreatContainer&) = delete;
+        ThreatContainer& operator=(const ThreatContainer&) = delete;
+
         /**
          * @brief Destructor
          */
@@ -333,13 +347,13 @@ class ThreatContainer
          * @brief Check if empty
          * @return True if empty
          */
-        bool empty() const { return(iThreatList.empty()); }
+        bool empty() const { return(iThreatHeap.empty()); }
 
         /**
          * @brief Get most hated reference
          * @return Most hated reference
          */
-        HostileReference* getMostHated() { return iThreatList.empty() ? NULL : iThreatList.front(); }
+        HostileReference* getMostHated() { return iThreatHeap.top(); }
 
         /**
          * @brief Get reference by target
@@ -350,9 +364,13 @@ class ThreatContainer
 
         /**
          * @brief Get threat list
+         *
+         * The list is a snapshot, sorted by threat, most hated first. References
+         * added or removed later show up the next time it is asked for.
+         *
          * @return Threat list
          */
-        ThreatList const& getThreatList() const { return iThreatList; }
+        ThreatList const& getThreatList() const;
 };
 
 //=================================================
@@ -66,12 +66,15 @@ enum SessionStatus
  * same function as we received it in, this is unusual, or it can be in:
  * - \ref World::UpdateSessions if it's not thread safe
  * - \ref Map::Update if it is thread safe
+ * - either, or a worker thread while the player is not in a map, if it touches nothing
+ *   but its own session
  */
 enum PacketProcessing
 {
     PROCESS_INPLACE = 0,   ///< process packet whenever we receive it - mostly for non-handled or non-implemented packets
     PROCESS_THREADUNSAFE,  ///< packet is not thread-safe - process it in \ref World::UpdateSessions
-    PROCESS_THREADSAFE     ///< packet is thread-safe - process it in \ref Map::Update
+    PROCESS_THREADSAFE,    ///< packet is thread-safe - process it in \ref Map::Update
+    PROCESS_SESSION        ///< packet touches only its own session - like PROCESS_THREADSAFE, and out of a map it may run alongside other sessions
 };
 
 class WorldPacket;
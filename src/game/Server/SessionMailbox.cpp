@@ -25,8 +25,20 @@
 
 #include <memory>
 #include <mutex>
+#include <thread>
 #include "SessionMailbox.h"
 
+SessionMailbox::SessionMailbox()
+    : m_tail(0), m_head(0), m_fromSpill(false), m_overflowed(false),
+      m_closed(false), m_producers(0), m_consuming(false)
+{
+    for (size_t i = 0; i < RING_SIZE; ++i)
+    {
+        m_ring[i].sequence.store(i, std::memory_order_relaxed);
+        m_ring[i].packet = nullptr;
+    }
+}
+
 SessionMailbox::~SessionMailbox()
 {
     Close();
@@ -37,40 +49,176 @@ bool SessionMailbox::Enqueue(std::unique_ptr<WorldPacket> packet)
     if (!packet)
         return false;
 
-    std::lock_guard<std::mutex> guard(m_stateLock);
-    if (m_closed)
+    // Close() sets m_closed and then waits for m_producers to drop to zero, so
+    // either this sees the close or Close() sees this post and waits for it.
+    m_producers.fetch_add(1);
+    if (m_closed.load())
+    {
+        m_producers.fetch_sub(1);
         return false;
+    }
 
-    WorldPacket* accepted = packet.get();
-    m_packets.add(accepted);
-    (void)packet.release();
+    WorldPacket* accepted = packet.release();
+
+    bool queued = false;
+    if (!m_overflowed.load(std::memory_order_acquire))
+    {
+        size_t position;
+        if (Claim(position))
+        {
+            Publish(position, accepted);
+            queued = true;
+        }
+    }
+
+    if (!queued)
+    {
+        std::lock_guard<std::mutex> guard(m_overflowLock);
+        m_overflowed.store(true, std::memory_order_release);
+        m_overflow.push_back(accepted);
+    }
+
+    m_producers.fetch_sub(1, std::memory_order_release);
     return true;
 }
 
+bool SessionMailbox::Claim(size_t& position)
+{
+    position = m_tail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Slot& slot = m_ring[position % RING_SIZE];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == position)
+        {
+            if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                return true;
+        }
+        else if (sequence < position + 1)
+        {
+            // the slot still holds the packet from one lap ago: full
+            return false;
+        }
+        else
+        {
+            position = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void SessionMailbox::Publish(size_t position, WorldPacket* packet)
+{
+    Slot& slot = m_ring[position % RING_SIZE];
+    slot.packet = packet;
+    slot.sequence.store(position + 1, std::memory_order_release);
+}
+
 bool SessionMailbox::Next(WorldPacket*& packet)
 {
-    std::lock_guard<std::mutex> guard(m_stateLock);
-    if (m_closed)
+    if (!AcquireConsumer())
         return false;
-    return m_packets.next(packet);
+
+    bool taken = Peek(packet);
+    if (taken)
+        Pop();
+
+    ReleaseConsumer();
+    return taken;
 }
 
-void SessionMailbox::Close()
+bool SessionMailbox::AcquireConsumer()
+{
+    // Only ever contended by Close(), which keeps it.
+    if (m_consuming.exchange(true, std::memory_order_acquire))
+        return false;
+
+    if (m_closed.load())
+    {
+        ReleaseConsumer();
+        return false;
+    }
+
+    return true;
+}
+
+void SessionMailbox::ReleaseConsumer()
+{
+    m_consuming.store(false, std::memory_order_release);
+}
+
+bool SessionMailbox::Peek(WorldPacket*& packet)
 {
+    if (!m_spill.empty())
     {
-        std::lock_guard<std::mutex> guard(m_stateLock);
-        if (m_closed)
-            return;
-        m_closed = true;
+        packet = m_spill.front();
+        m_fromSpill = true;
+        return true;
     }
 
+    Slot& slot = m_ring[m_head % RING_SIZE];
+    if (slot.sequence.load(std::memory_order_acquire) == m_head + 1)
+    {
+        packet = slot.packet;
+        m_fromSpill = false;
+        return true;
+    }
+
+    // A producer has claimed the slot at the head and not filled it yet. The
+    // ring is not empty: what it is posting may come before anything spilled.
+    if (m_tail.load(std::memory_order_acquire) != m_head)
+        return false;
+
+    // The ring is empty; what was spilled while it was full comes next.
+    if (!m_overflowed.load(std::memory_order_acquire))
+        return false;
+
+    {
+        std::lock_guard<std::mutex> guard(m_overflowLock);
+        m_spill.swap(m_overflow);
+        m_overflowed.store(false, std::memory_order_release);
+    }
+
+    if (m_spill.empty())
+        return false;
+
+    packet = m_spill.front();
+    m_fromSpill = true;
+    return true;
+}
+
+void SessionMailbox::Pop()
+{
+    if (m_fromSpill)
+    {
+        m_spill.pop_front();
+        return;
+    }
+
+    m_ring[m_head % RING_SIZE].sequence.store(m_head + RING_SIZE, std::memory_order_release);
+    ++m_head;
+}
+
+void SessionMailbox::Close()
+{
+    if (m_closed.exchange(true))
+        return;
+
+    while (m_producers.load() != 0)
+        std::this_thread::yield();
+
+    // Taken for good: from here on Next() finds the consumer side busy.
+    while (m_consuming.exchange(true, std::memory_order_acquire))
+        std::this_thread::yield();
+
     WorldPacket* packet = nullptr;
-    while (m_packets.next(packet))
+    while (Peek(packet))
+    {
+        Pop();
         delete packet;
+    }
 }
 
 bool SessionMailbox::IsClosed() const
 {
-    std::lock_guard<std::mutex> guard(m_stateLock);
-    return m_closed;
+    return m_closed.load();
 }
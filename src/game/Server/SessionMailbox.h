@@ -23,40 +23,113 @@
  * and lore are copyrighted by Blizzard Entertainment, Inc.
  */
 
+/**
+ * @file SessionMailbox.h
+ * @brief Hands a session's inbound packets from the network to whoever updates it.
+ *
+ * The network side posts packets, the world or map thread that updates the
+ * session takes them. Both ends are lock-free in the common case: packets go
+ * through a bounded ring whose slots carry a sequence number (any number of
+ * producers, one consumer at a time). A producer that finds the ring full
+ * spills into a locked overflow queue instead of waiting; the consumer drains
+ * the ring -- down to slots claimed and not yet filled -- before the overflow,
+ * and producers keep spilling until it has, so
+ * each producer's packets still come out in the order it posted them.
+ *
+ * Close() refuses further packets, waits for posts already under way, takes
+ * the consumer side and deletes whatever was left.
+ */
+
 #ifndef MANGOS_H_SESSIONMAILBOX
 #define MANGOS_H_SESSIONMAILBOX
 
-#include "LockedQueue/LockedQueue.h"
 #include "WorldPacket.h"
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
 
 class SessionMailbox
 {
     public:
-        SessionMailbox() = default;
+        /// Packets the ring holds before producers spill into the overflow queue.
+        static const size_t RING_SIZE = 256;
+
+        SessionMailbox();
         ~SessionMailbox();
 
+        SessionMailbox(const SessionMailbox&) = delete;
+        SessionMailbox& operator=(const SessionMailbox&) = delete;
+
         bool Enqueue(std::unique_ptr<WorldPacket> packet);
         bool Next(WorldPacket*& packet);
 
+        /// Take the oldest packet only if `checker.Process()` accepts it; otherwise leave it queued.
         template<class Checker>
         bool Next(WorldPacket*& packet, Checker& checker)
         {
-            std::lock_guard<std::mutex> guard(m_stateLock);
-            if (m_closed)
+            if (!AcquireConsumer())
+                return false;
+
+            bool taken = Peek(packet) && checker.Process(packet);
+            if (taken)
+                Pop();
+
+            ReleaseConsumer();
+            return taken;
+        }
+
+        /// Whether Next(packet, checker) would take a packet now; takes nothing.
+        template<class Checker>
+        bool HasNext(Checker& checker)
+        {
+            if (!AcquireConsumer())
                 return false;
-            return m_packets.next(packet, checker);
+
+            WorldPacket* packet = nullptr;
+            bool ready = Peek(packet) && checker.Process(packet);
+
+            ReleaseConsumer();
+            return ready;
         }
 
         void Close();
         bool IsClosed() const;
 
     private:
-        mutable std::mutex m_stateLock;
-        bool m_closed = false;
-        MaNGOS::LockedQueue<WorldPacket*> m_packets;
+        struct Slot
+        {
+            std::atomic<size_t> sequence;                   // == position: free, == position + 1: holds a packet
+            WorldPacket* packet;
+        };
+
+        friend class SessionMailboxProbe;                   // tests hold a slot claimed between the two steps
+
+        // producer side: take the position at the tail, then fill its slot
+        bool Claim(size_t& position);
+        void Publish(size_t position, WorldPacket* packet);
+
+        bool AcquireConsumer();
+        void ReleaseConsumer();
+
+        // consumer side only
+        bool Peek(WorldPacket*& packet);
+        void Pop();
+
+        Slot m_ring[RING_SIZE];
+        alignas(64) std::atomic<size_t> m_tail;             // next position a producer claims
+        alignas(64) size_t m_head;                          // next position the consumer reads
+        std::deque<WorldPacket*> m_spill;                   // overflow taken by the consumer, read before the ring
+        bool m_fromSpill;                                   // what the last Peek() returned
+
+        std::mutex m_overflowLock;
+        std::deque<WorldPacket*> m_overflow;
+        std::atomic<bool> m_overflowed;                     // producers must spill until the consumer takes the overflow
+
+        std::atomic<bool> m_closed;
+        std::atomic<uint32> m_producers;                    // Enqueue() calls under way
+        std::atomic<bool> m_consuming;                      // held by Next(), and by Close() for good
 };
 
 #endif
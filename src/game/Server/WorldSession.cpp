@@ -59,6 +59,7 @@
 #include <memory>
 #include "Database/DatabaseEnv.h"
 #include "Log.h"
+#include "Trace.h"
 #include "OpcodeTable.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -164,6 +165,18 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     return !MapSessionFilterHelper(m_pSession, opHandle);
 }
 
+/**
+ * @brief Process packet in a session-local context
+ * @param packet Packet to process
+ * @return True if packet should be processed
+ *
+ * Accepts only packets whose handlers touch nothing but their own session.
+ */
+bool SessionLocalFilter::Process(WorldPacket* packet)
+{
+    return opcodeTable[packet->GetOpcode()].packetProcessing == PROCESS_SESSION;
+}
+
 /// WorldSession constructor
 WorldSession::WorldSession(uint32 id, std::shared_ptr<proto::IClientLink> link,
                            std::shared_ptr<SessionMailbox> mailbox,
@@ -332,130 +345,14 @@ void WorldSession::LogUnprocessedTail(WorldPacket* packet)
 /// Update the WorldSession (triggered by World update)
 bool WorldSession::Update(PacketFilter& updater)
 {
+    TRACE_SCOPE("session update");
+
     ///- Retrieve packets from the receive queue and call the appropriate handlers
     /// not process packets if socket already closed
     WorldPacket* packet = NULL;
     while (m_Socket && !m_Socket->IsClosed() && m_mailbox->Next(packet, updater))
     {
-        /*#if 1
-        sLog.outError( "MOEP: %s (0x%.4X)",
-                        LookupOpcodeName(packet->GetOpcode()),
-                        packet->GetOpcode());
-        #endif*/
-
-        OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
-        try
-        {
-            switch (opHandle.status)
-            {
-                case STATUS_LOGGEDIN:
-                    if (!_player)
-                    {
-                        // skip STATUS_LOGGEDIN opcode unexpected errors if player logout sometime ago - this can be network lag delayed packets
-                        if (!m_playerRecentlyLogout)
-                        {
-                            LogUnexpectedOpcode(packet, "the player has not logged in yet");
-                        }
-                    }
-                    else if (_player->IsInWorld())
-                    {
-                        ExecuteOpcode(opHandle, packet);
-                    }
-
-                    // lag can cause STATUS_LOGGEDIN opcodes to arrive after the player started a transfer
-
-#ifdef ENABLE_PLAYERBOTS
-                    if (_player && _player->GetPlayerbotMgr())
-                    {
-                        _player->GetPlayerbotMgr()->HandleMasterIncomingPacket(*packet);
-                    }
-#endif
-                    break;
-                case STATUS_LOGGEDIN_OR_RECENTLY_LOGGEDOUT:
-                    if (!_player && !m_playerRecentlyLogout)
-                    {
-                        LogUnexpectedOpcode(packet, "the player has not logged in yet and not recently logout");
-                    }
-                    else
-                        // not expected _player or must checked in packet hanlder
-                    {
-                        ExecuteOpcode(opHandle, packet);
-                    }
-                    break;
-                case STATUS_TRANSFER:
-                    if (!_player)
-                    {
-                        LogUnexpectedOpcode(packet, "the player has not logged in yet");
-                    }
-                    else if (_player->IsInWorld())
-                    {
-                        LogUnexpectedOpcode(packet, "the player is still in world");
-                    }
-                    else
-                    {
-                        ExecuteOpcode(opHandle, packet);
-                    }
-                    break;
-                case STATUS_AUTHED:
-                    // Prevent skipping the queue -- but a queued client's own heartbeats
-                    // are STATUS_AUTHED too, and dropping them times it out.
-                    if (m_inQueue &&
-                        packet->GetOpcode() != CMSG_PING &&
-                        packet->GetOpcode() != CMSG_KEEP_ALIVE)
-                    {
-                        LogUnexpectedOpcode(packet, "the player not pass queue yet");
-                        break;
-                    }
-
-                    // A heartbeat is not activity, so it must not close the
-                    // recently-logged-out window. Same opcodes as the gate above by
-                    // coincidence, not by rule.
-                    if (packet->GetOpcode() != CMSG_SET_ACTIVE_VOICE_CHANNEL &&
-                        packet->GetOpcode() != CMSG_PING &&
-                        packet->GetOpcode() != CMSG_KEEP_ALIVE)
-                    {
-                        m_playerRecentlyLogout = false;
-                    }
-
-                    ExecuteOpcode(opHandle, packet);
-                    break;
-                case STATUS_NEVER:
-                    sLog.outError("SESSION: received not allowed opcode %s (0x%.4X)",
-                                  LookupOpcodeName(packet->GetOpcode()),
-                                  packet->GetOpcode());
-                    break;
-                case STATUS_UNHANDLED:
-                    DEBUG_LOG("SESSION: received not handled opcode %s (0x%.4X)",
-                              LookupOpcodeName(packet->GetOpcode()),
-                              packet->GetOpcode());
-                    break;
-                default:
-                    sLog.outError("SESSION: received wrong-status-req opcode %s (0x%.4X)",
-                                  LookupOpcodeName(packet->GetOpcode()),
-                                  packet->GetOpcode());
-                    break;
-            }
-        }
-        catch (ByteBufferException&)
-        {
-            sLog.outError("WorldSession::Update ByteBufferException occured while parsing a packet (opcode: %u) from client %s, accountid=%i.",
-                          packet->GetOpcode(), GetRemoteAddress().c_str(), GetAccountId());
-            if (sLog.HasLogLevelOrHigher(LOG_LVL_DEBUG))
-            {
-                DEBUG_LOG("Dumping error causing packet:");
-                packet->hexlike();
-            }
-
-            if (sWorld.getConfig(CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET))
-            {
-                DETAIL_LOG("Disconnecting session [account id %u / address %s] for badly formatted packet.",
-                           GetAccountId(), GetRemoteAddress().c_str());
-
-                KickPlayer();
-            }
-        }
-
-        delete packet;
+        ProcessPacket(packet);
     }
 
 #ifdef ENABLE_PLAYERBOTS
@@ -498,6 +395,159 @@ bool WorldSession::Update(PacketFilter& updater)
     return true;
 }
 
+/// Handle one received packet according to its opcode's session status, then free it
+void WorldSession::ProcessPacket(WorldPacket* packet)
+{
+    OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
+    try
+    {
+        switch (opHandle.status)
+        {
+            case STATUS_LOGGEDIN:
+                if (!_player)
+                {
+                    // skip STATUS_LOGGEDIN opcode unexpected errors if player logout sometime ago - this can be network lag delayed packets
+                    if (!m_playerRecentlyLogout)
+                    {
+                        LogUnexpectedOpcode(packet, "the player has not logged in yet");
+                    }
+                }
+                else if (_player->IsInWorld())
+                {
+                    ExecuteOpcode(opHandle, packet);
+                }
+
+                // lag can cause STATUS_LOGGEDIN opcodes to arrive after the player started a transfer
+
+#ifdef ENABLE_PLAYERBOTS
+                if (_player && _player->GetPlayerbotMgr())
+                {
+                    _player->GetPlayerbotMgr()->HandleMasterIncomingPacket(*packet);
+                }
+#endif
+                break;
+            case STATUS_LOGGEDIN_OR_RECENTLY_LOGGEDOUT:
+                if (!_player && !m_playerRecentlyLogout)
+                {
+                    LogUnexpectedOpcode(packet, "the player has not logged in yet and not recently logout");
+                }
+                else
+                    // not expected _player or must checked in packet hanlder
+                {
+                    ExecuteOpcode(opHandle, packet);
+                }
+                break;
+            case STATUS_TRANSFER:
+                if (!_player)
+                {
+                    LogUnexpectedOpcode(packet, "the player has not logged in yet");
+                }
+                else if (_player->IsInWorld())
+                {
+                    LogUnexpectedOpcode(packet, "the player is still in world");
+                }
+                else
+                {
+                    ExecuteOpcode(opHandle, packet);
+                }
+                break;
+            case STATUS_AUTHED:
+                // Prevent skipping the queue -- but a queued client's own heartbeats
+                // are STATUS_AUTHED too, and dropping them times it out.
+                if (m_inQueue &&
+                    packet->GetOpcode() != CMSG_PING &&
+                    packet->GetOpcode() != CMSG_KEEP_ALIVE)
+                {
+                    LogUnexpectedOpcode(packet, "the player not pass queue yet");
+                    break;
+                }
+
+                // A heartbeat is not activity, so it must not close the
+                // recently-logged-out window. Same opcodes as the gate above by
+                // coincidence, not by rule.
+                if (packet->GetOpcode() != CMSG_SET_ACTIVE_VOICE_CHANNEL &&
+                    packet->GetOpcode() != CMSG_PING &&
+                    packet->GetOpcode() != CMSG_KEEP_ALIVE)
+                {
+                    m_playerRecentlyLogout = false;
+                }
+
+                ExecuteOpcode(opHandle, packet);
+                break;
+            case STATUS_NEVER:
+                sLog.outError("SESSION: received not allowed opcode %s (0x%.4X)",
+                              LookupOpcodeName(packet->GetOpcode()),
+                              packet->GetOpcode());
+                break;
+            case STATUS_UNHANDLED:
+                DEBUG_LOG("SESSION: received not handled opcode %s (0x%.4X)",
+                          LookupOpcodeName(packet->GetOpcode()),
+                          packet->GetOpcode());
+                break;
+            default:
+                sLog.outError("SESSION: received wrong-status-req opcode %s (0x%.4X)",
+                              LookupOpcodeName(packet->GetOpcode()),
+                              packet->GetOpcode());
+                break;
+        }
+    }
+    catch (ByteBufferException&)
+    {
+        sLog.outError("WorldSession::Update ByteBufferException occured while parsing a packet (opcode: %u) from client %s, accountid=%i.",
+                      packet->GetOpcode(), GetRemoteAddress().c_str(), GetAccountId());
+        if (sLog.HasLogLevelOrHigher(LOG_LVL_DEBUG))
+        {
+            DEBUG_LOG("Dumping error causing packet:");
+            packet->hexlike();
+        }
+
+        if (sWorld.getConfig(CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET))
+        {
+            DETAIL_LOG("Disconnecting session [account id %u / address %s] for badly formatted packet.",
+                       GetAccountId(), GetRemoteAddress().c_str());
+
+            KickPlayer();
+        }
+    }
+
+    delete packet;
+}
+
+void WorldSession::UpdateSessionLocal()
+{
+    SessionLocalFilter filter(this);
+
+    WorldPacket* packet = NULL;
+    while (m_Socket && !m_Socket->IsClosed() && m_mailbox->Next(packet, filter))
+    {
+        ProcessPacket(packet);
+    }
+}
+
+bool WorldSession::NeedsWorldUpdate()
+{
+    if (!_player || !_player->IsInWorld())
+    {
+        return true;
+    }
+
+    // socket cleanup and the logout countdown are Update()'s to do
+    if (!m_Socket || m_Socket->IsClosed() || _logoutTime)
+    {
+        return true;
+    }
+
+#ifdef ENABLE_PLAYERBOTS
+    if (_player->GetPlayerbotMgr())
+    {
+        return true;
+    }
+#endif
+
+    WorldSessionFilter filter(this);
+    return m_mailbox->HasNext(filter);
+}
+
 #ifdef ENABLE_PLAYERBOTS
 void WorldSession::HandleBotPackets()
 {
@@ -51,6 +51,7 @@
 
 struct ItemPrototype;
 struct AuctionEntry;
+class AuctionSorter;
 struct AuctionHouseEntry;
 struct DeclinedName;
 
@@ -310,6 +311,42 @@ class WorldSessionFilter : public PacketFilter
         bool Process(WorldPacket* packet) override;
 };
 
+/**
+ * @brief Session-local packet filter class
+ *
+ * Class used to filter only packets that touch nothing but their own session
+ * (PROCESS_SESSION). Used by World::UpdateSessions() to handle sessions that
+ * are not in a map on the map worker threads, several at once.
+ */
+class SessionLocalFilter : public PacketFilter
+{
+    public:
+        /**
+         * @brief Constructor
+         * @param pSession World session
+         */
+        explicit SessionLocalFilter(WorldSession* pSession) : PacketFilter(pSession) {}
+
+        /**
+         * @brief Process packet
+         * @param packet World packet to process
+         * @return True if the packet is session-local
+         */
+        bool Process(WorldPacket* packet) override;
+
+        /**
+         * @brief Process logout
+         *
+         * Logout touches the map and the world; it stays on the world thread.
+         *
+         * @return False
+         */
+        bool ProcessLogout() const override
+        {
+            return false;
+        }
+};
+
 /**
  * @brief World session class
  *
@@ -464,6 +501,23 @@ class WorldSession
 
         bool Update(PacketFilter& updater);
 
+        /**
+         * @brief Handle the leading session-local packets, and nothing else.
+         *
+         * Safe to call for many sessions at once, off the world thread, while
+         * the player is not in a map: see SessionLocalFilter.
+         */
+        void UpdateSessionLocal();
+
+        /**
+         * @brief Whether World::UpdateSessions() has anything to do here.
+         *
+         * False only for a player in a map whose next packet belongs to the map,
+         * with no logout or socket teardown due -- the common case, which the
+         * world thread then skips without calling Update().
+         */
+        bool NeedsWorldUpdate();
+
         /// Handle the authentication waiting queue (to be completed)
         void SendAuthWaitQue(uint32 position);
 
@@ -537,8 +591,8 @@ class WorldSession
         void SendAuctionRemovedNotification(AuctionEntry* auction);
         static void SendAuctionOutbiddedMail(AuctionEntry* auction);
         void SendAuctionCancelledToBidderMail(AuctionEntry* auction);
-        void BuildListAuctionItems(std::vector<AuctionEntry*> const& auctions, WorldPacket& data, std::wstring const& searchedname, uint32 listfrom, uint32 levelmin,
-                                   uint32 levelmax, uint32 usable, uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality, uint32& count, uint32& totalcount, bool isFull);
+        void BuildListAuctionItems(std::vector<AuctionEntry*>& auctions, AuctionSorter const& sorter, WorldPacket& data, uint32 listfrom,
+                                   uint32 usable, uint32& count, uint32& totalcount, bool isFull);
 
         AuctionHouseEntry const* GetCheckedAuctionHouseForAuctioneer(ObjectGuid guid);
 
@@ -1122,6 +1176,7 @@ class WorldSession
         bool VerifyMovementInfo(MovementInfo const& movementInfo) const;
         void HandleMoverRelocation(MovementInfo& movementInfo);
 
+        void ProcessPacket(WorldPacket* packet);
         void ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket* packet);
 
         // logging helper
@@ -0,0 +1,157 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file TickStats.cpp
+ * @brief Per map and instance sums of the phase times of World::Update and Map::Update.
+ *
+ * @see TickStats.h
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include "TickStats.h"
+
+#include "Log.h"
+
+/// Entries written to the log when a window closes: the world and the busiest maps.
+#define TICK_STATS_LOGGED_ENTRIES 6
+
+/**
+ * @var sTickStats
+ * @brief Global tick statistics, fed by the world and every map.
+ */
+TickStatsRegistry sTickStats;
+
+/**
+ * @brief Add a recorder's times to the current window
+ * @param mapId Map the times belong to, TICK_STATS_WORLD for the world
+ * @param instanceId Instance of the map
+ * @param recorder Times recorded since the last hand over; cleared
+ */
+void TickStatsRegistry::HandOver(uint32 mapId, uint32 instanceId, TickStatsRecorder& recorder)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+
+        TickStatsEntry& entry = m_current[(uint64(mapId) << 32) | instanceId];
+        entry.mapId = mapId;
+        entry.instanceId = instanceId;
+        for (uint32 i = 0; i < MAX_TICK_PHASE; ++i)
+        {
+            entry.phases[i].Merge(recorder.phases[i]);
+        }
+    }
+
+    for (uint32 i = 0; i < MAX_TICK_PHASE; ++i)
+    {
+        recorder.phases[i].Reset();
+    }
+    recorder.sinceHandOver = 0;
+}
+
+/**
+ * @brief Close the current window and log where its time went
+ * @param windowLength Length of the window, in milliseconds
+ *
+ * Logs the world and the busiest map instances: updates, average and 99th
+ * percentile update time, and the phase that took the largest share.
+ */
+void TickStatsRegistry::Rotate(uint32 windowLength)
+{
+    std::vector<TickStatsEntry> window;
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+
+        m_last.clear();
+        for (EntryMap::const_iterator itr = m_current.begin(); itr != m_current.end(); ++itr)
+        {
+            m_last.push_back(itr->second);
+        }
+        m_current.clear();
+
+        std::sort(m_last.begin(), m_last.end(), [](TickStatsEntry const& a, TickStatsEntry const& b)
+        {
+            return a.GetTotal() > b.GetTotal();
+        });
+        m_lastWindowLength = windowLength;
+
+        for (size_t i = 0; i < m_last.size() && window.size() < TICK_STATS_LOGGED_ENTRIES; ++i)
+        {
+            window.push_back(m_last[i]);
+        }
+    }
+
+    if (window.empty())
+    {
+        return;
+    }
+
+    sLog.outString("Tick time over the last %u s:", windowLength / 1000);
+    for (std::vector<TickStatsEntry>::const_iterator itr = window.begin(); itr != window.end(); ++itr)
+    {
+        bool world = itr->mapId == TICK_STATS_WORLD;
+        TickPhase total = world ? TICK_PHASE_WORLD_TOTAL : TICK_PHASE_MAP_TOTAL;
+        TickHistogram const& updates = itr->phases[total];
+
+        // The phase with the largest share of the update
+        uint32 first = world ? TICK_PHASE_WORLD_TIMERS : TICK_PHASE_MAP_SESSIONS;
+        uint32 top = first;
+        for (uint32 i = first; i < uint32(total); ++i)
+        {
+            if (itr->phases[i].GetTotal() > itr->phases[top].GetTotal())
+            {
+                top = i;
+            }
+        }
+        uint32 share = updates.GetTotal() ? uint32(itr->phases[top].GetTotal() * 100 / updates.GetTotal()) : 0;
+
+        char where[32];
+        if (world)
+        {
+            snprintf(where, sizeof(where), "world");
+        }
+        else
+        {
+            snprintf(where, sizeof(where), "map %u instance %u", itr->mapId, itr->instanceId);
+        }
+
+        sLog.outString("  %s: " UI64FMTD " updates, avg %u us, p99 <= %u us, max %u us, most in %s (%u%%)",
+                       where, updates.GetCount(), updates.GetAverage(), updates.GetPercentile(99), updates.GetMax(),
+                       GetTickPhaseName(TickPhase(top)), share);
+    }
+}
+
+/**
+ * @brief Get the last full window
+ * @param seconds Receives the length of the window, in seconds
+ * @return Every map instance that updated in the window, busiest first
+ */
+std::vector<TickStatsEntry> TickStatsRegistry::GetLastWindow(uint32& seconds) const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    seconds = m_lastWindowLength / 1000;
+    return m_last;
+}
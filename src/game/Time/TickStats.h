@@ -0,0 +1,318 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file TickStats.h
+ * @brief Where the tick goes: time per phase of World::Update and Map::Update.
+ *
+ * Each map keeps its own recorder and times the phases of its update with a lap
+ * timer, so the hot path takes no lock and shares nothing with other map threads.
+ * About once a second a map hands what it gathered to sTickStats, which sums it
+ * per map and instance over a window and keeps the last full window for the
+ * periodic log and the `.server tickstats` command.
+ */
+
+#ifndef TICKSTATS_H
+#define TICKSTATS_H
+
+#include "Platform/Define.h"
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief The phases of an update that are timed.
+ */
+enum TickPhase
+{
+    // Map::Update
+    TICK_PHASE_MAP_SESSIONS,            ///< Packets of the sessions of the players on the map
+    TICK_PHASE_MAP_PLAYERS,             ///< Player::Update
+    TICK_PHASE_MAP_CELLS,               ///< Visits of the active cells around players and active objects
+    TICK_PHASE_MAP_OBJECT_UPDATES,      ///< SendObjectUpdates
+    TICK_PHASE_MAP_GRIDS,               ///< Grid states and pending cell unloads
+    TICK_PHASE_MAP_SCRIPTS,             ///< ScriptsProcess
+    TICK_PHASE_MAP_ELUNA,               ///< Eluna map hooks
+    TICK_PHASE_MAP_INSTANCE_DATA,       ///< InstanceData::Update
+    TICK_PHASE_MAP_TRANSPORTS,          ///< Weather and the vessels sailing the map
+    TICK_PHASE_MAP_TOTAL,               ///< The whole Map::Update
+
+    // World::Update
+    TICK_PHASE_WORLD_TIMERS,            ///< Game time, auctions, quest resets and the other timed jobs
+    TICK_PHASE_WORLD_BOTS,              ///< Random bot manager
+    TICK_PHASE_WORLD_SESSIONS,          ///< Sessions not handled by a map
+    TICK_PHASE_WORLD_MAPS,              ///< MapManager::Update, waiting for every map
+    TICK_PHASE_WORLD_BATTLEGROUNDS,     ///< Battleground and outdoor PvP managers
+    TICK_PHASE_WORLD_ELUNA,             ///< Eluna world hooks
+    TICK_PHASE_WORLD_DB_CALLBACKS,      ///< Callbacks of asynchronous queries
+    TICK_PHASE_WORLD_CLEANUP,           ///< Remove lists, instance resets, CLI commands, terrain
+    TICK_PHASE_WORLD_TOTAL,             ///< The whole World::Update
+
+    MAX_TICK_PHASE
+};
+
+/// Map id the world's own phases are filed under.
+#define TICK_STATS_WORLD              0xFFFFFFFF
+/// How often a map hands its times to sTickStats, in milliseconds.
+#define TICK_STATS_HAND_OVER_INTERVAL 1000
+#define TICK_HISTOGRAM_BUCKETS        16
+
+/**
+ * @brief Short name of a phase, for logs and commands.
+ */
+inline char const* GetTickPhaseName(TickPhase phase)
+{
+    static char const* const names[MAX_TICK_PHASE] =
+    {
+        "sessions", "players", "cells", "object updates", "grids", "scripts", "eluna", "instance data", "transports", "map total",
+        "timers", "bots", "sessions", "maps", "battlegrounds", "eluna", "db callbacks", "cleanup", "world total"
+    };
+    return phase < MAX_TICK_PHASE ? names[phase] : "unknown";
+}
+
+/**
+ * @brief Histogram of durations in microseconds, in power of two buckets.
+ *
+ * Bucket 0 holds everything under 16 us, bucket n everything under 16 << n us,
+ * the last bucket everything above. Percentiles are read as the upper bound of
+ * the bucket they fall in, which is good enough to tell 2 ms from 20 ms.
+ */
+class TickHistogram
+{
+    public:
+        TickHistogram() { Reset(); }
+
+        void Add(uint32 micros)
+        {
+            ++m_buckets[GetBucket(micros)];
+            ++m_count;
+            m_total += micros;
+            if (micros > m_max)
+            {
+                m_max = micros;
+            }
+        }
+
+        void Merge(TickHistogram const& other)
+        {
+            for (uint32 i = 0; i < TICK_HISTOGRAM_BUCKETS; ++i)
+            {
+                m_buckets[i] += other.m_buckets[i];
+            }
+            m_count += other.m_count;
+            m_total += other.m_total;
+            if (other.m_max > m_max)
+            {
+                m_max = other.m_max;
+            }
+        }
+
+        void Reset()
+        {
+            m_buckets.fill(0);
+            m_count = 0;
+            m_total = 0;
+            m_max = 0;
+        }
+
+        /**
+         * @brief Upper bound of the given percentile, in microseconds.
+         *
+         * @param percent 1 to 100
+         * @return uint32 The limit of the bucket the percentile falls in; the
+         *         largest sample if that is the last bucket or lower than the limit.
+         */
+        uint32 GetPercentile(uint32 percent) const
+        {
+            if (!m_count)
+            {
+                return 0;
+            }
+
+            uint64 wanted = (m_count * percent + 99) / 100;
+            uint64 seen = 0;
+            for (uint32 i = 0; i < TICK_HISTOGRAM_BUCKETS - 1; ++i)
+            {
+                seen += m_buckets[i];
+                if (seen >= wanted)
+                {
+                    return GetBucketLimit(i) < m_max ? GetBucketLimit(i) : m_max;
+                }
+            }
+            return m_max;
+        }
+
+        uint64 GetCount() const { return m_count; }
+        uint64 GetTotal() const { return m_total; }
+        uint32 GetMax() const { return m_max; }
+        uint32 GetAverage() const { return m_count ? uint32(m_total / m_count) : 0; }
+        uint64 GetBucketCount(uint32 bucket) const { return m_buckets[bucket]; }
+
+        static uint32 GetBucket(uint32 micros)
+        {
+            uint32 bucket = 0;
+            for (uint32 limit = 16; micros >= limit && bucket < TICK_HISTOGRAM_BUCKETS - 1; limit <<= 1)
+            {
+                ++bucket;
+            }
+            return bucket;
+        }
+
+        /// Exclusive upper limit of a bucket, in microseconds.
+        static uint32 GetBucketLimit(uint32 bucket) { return 16u << bucket; }
+
+    private:
+        std::array<uint64, TICK_HISTOGRAM_BUCKETS> m_buckets;
+        uint64 m_count;
+        uint64 m_total;
+        uint32 m_max;
+};
+
+/**
+ * @brief Phase times of one map (or of the world) not yet handed to sTickStats.
+ *
+ * Only touched by the thread updating its owner.
+ */
+struct TickStatsRecorder
+{
+    TickStatsRecorder() : sinceHandOver(0) {}
+
+    std::array<TickHistogram, MAX_TICK_PHASE> phases;
+    uint32 sinceHandOver;                           ///< ms of updates recorded since the last hand over
+};
+
+/**
+ * @brief Times the phases of one update, one after the other.
+ *
+ * Lap() charges the time since the previous lap (or since construction) to a phase.
+ * A phase charged more than once in an update is summed, so the histograms hold one
+ * sample per phase per update. Finish() files the samples and the total.
+ */
+class TickLapTimer
+{
+    public:
+        explicit TickLapTimer(TickStatsRecorder& recorder) : m_recorder(recorder), m_start(Clock::now()), m_lap(m_start)
+        {
+            m_micros.fill(0);
+            m_charged.fill(false);
+        }
+
+        void Lap(TickPhase phase)
+        {
+            Clock::time_point now = Clock::now();
+            m_micros[phase] += uint32(std::chrono::duration_cast<std::chrono::microseconds>(now - m_lap).count());
+            m_charged[phase] = true;
+            m_lap = now;
+        }
+
+        void Finish(TickPhase total)
+        {
+            m_micros[total] = uint32(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - m_start).count());
+            m_charged[total] = true;
+            for (uint32 i = 0; i < MAX_TICK_PHASE; ++i)
+            {
+                if (m_charged[i])
+                {
+                    m_recorder.phases[i].Add(m_micros[i]);
+                }
+            }
+        }
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        TickStatsRecorder& m_recorder;
+        Clock::time_point m_start;
+        Clock::time_point m_lap;
+        std::array<uint32, MAX_TICK_PHASE> m_micros;
+        std::array<bool, MAX_TICK_PHASE> m_charged;
+};
+
+/**
+ * @brief Phase times of one map instance over a window.
+ */
+struct TickStatsEntry
+{
+    TickStatsEntry() : mapId(0), instanceId(0) {}
+
+    uint32 mapId;                                   ///< TICK_STATS_WORLD for the world's own phases
+    uint32 instanceId;
+    std::array<TickHistogram, MAX_TICK_PHASE> phases;
+
+    /// Time spent in the whole update over the window, in microseconds.
+    uint64 GetTotal() const
+    {
+        return phases[mapId == TICK_STATS_WORLD ? TICK_PHASE_WORLD_TOTAL : TICK_PHASE_MAP_TOTAL].GetTotal();
+    }
+};
+
+/**
+ * @brief Phase times of every map instance, summed over fixed windows.
+ *
+ * Fed by every map thread; everything goes through one lock, taken about once a
+ * second per map.
+ */
+class TickStatsRegistry
+{
+    public:
+        TickStatsRegistry() : m_lastWindowLength(0) {}
+
+        /**
+         * @brief Adds a recorder's times to the current window and clears it.
+         */
+        void HandOver(uint32 mapId, uint32 instanceId, TickStatsRecorder& recorder);
+
+        /**
+         * @brief Closes the current window, logs its busiest maps and opens a new one.
+         *
+         * @param windowLength Length of the window being closed, in milliseconds.
+         */
+        void Rotate(uint32 windowLength);
+
+        /**
+         * @brief The last full window, busiest first.
+         *
+         * @param seconds Receives the length of the window.
+         */
+        std::vector<TickStatsEntry> GetLastWindow(uint32& seconds) const;
+
+    private:
+        typedef std::map<uint64, TickStatsEntry> EntryMap;
+
+        mutable std::mutex m_lock;
+        EntryMap m_current;
+        std::vector<TickStatsEntry> m_last;             ///< Sorted busiest first
+        uint32 m_lastWindowLength;                      ///< In milliseconds
+};
+
+/**
+ * @brief Global tick statistics.
+ */
+extern TickStatsRegistry sTickStats;
+
+#endif
@@ -45,6 +45,62 @@ AchievementCriteriaEntryList const& AchievementGlobalMgr::GetAchievementCriteria
     return m_AchievementCriteriasByType[type];
 }
 
+AchievementCriteriaEntryList const& AchievementGlobalMgr::GetAchievementCriteriaByTypeAndKey(AchievementCriteriaTypes type, uint32 miscvalue1)
+{
+    // 0 is the login/recheck case, which every criteria of the type has to see
+    if (!miscvalue1 || !m_AchievementCriteriaTypeKeyed[type])
+    {
+        return m_AchievementCriteriasByType[type];
+    }
+
+    static AchievementCriteriaEntryList const none;
+    AchievementCriteriaListByKey::const_iterator itr = m_AchievementCriteriasByTypeAndKey[type].find(miscvalue1);
+    return itr != m_AchievementCriteriasByTypeAndKey[type].end() ? itr->second : none;
+}
+
+/**
+ * @brief The value a non-zero miscvalue1 of UpdateAchievementCriteria must equal for the criteria to count.
+ *
+ * Only types whose check in UpdateAchievementCriteria skips the criteria on a
+ * mismatch before doing anything else are listed; the others see every update.
+ *
+ * @return false if the criteria's type has no such key
+ */
+bool AchievementGlobalMgr::GetAchievementCriteriaKey(AchievementCriteriaEntry const* criteria, uint32& key)
+{
+    switch (criteria->requiredType)
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:           key = criteria->kill_creature.creatureID;               return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:       key = criteria->reach_skill_level.skillID;              return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:       key = criteria->learn_skill_level.skillID;              return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE: key = criteria->complete_quests_in_zone.zoneID;         return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:      key = criteria->killed_by_creature.creatureEntry;       return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:          key = criteria->complete_quest.questID;                 return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:        key = criteria->be_spell_target.spellID;                return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:             key = criteria->cast_spell.spellID;                     return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:             key = criteria->learn_spell.spellID;                    return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_TYPE:               key = criteria->loot_type.lootType;                     return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:               key = criteria->own_item.itemID;                        return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:                key = criteria->use_item.itemID;                        return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:         key = criteria->gain_reputation.factionID;              return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:                key = criteria->do_emote.emoteID;                       return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:              key = criteria->equip_item.itemID;                      return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:          key = criteria->use_gameobject.goEntry;                 return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:      key = criteria->fish_in_gameobject.goEntry;             return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:  key = criteria->learn_skillline_spell.skillLine;        return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:        key = criteria->learn_skill_line.skillLine;             return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:                key = criteria->hk_class.classID;                       return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:                 key = criteria->hk_race.raceID;                         return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_TEAM_RATING:     key = criteria->highest_team_rating.teamtype;           return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_PERSONAL_RATING: key = criteria->highest_personal_rating.teamtype;       return true;
+        default:
+            return false;
+    }
+}
+
 AchievementCriteriaEntryList const* AchievementGlobalMgr::GetAchievementCriteriaByAchievement(uint32 id)
 {
     AchievementCriteriaListByAchievement::const_iterator itr = m_AchievementCriteriaListByAchievement.find(id);
@@ -134,6 +190,13 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
 
         m_AchievementCriteriasByType[criteria->requiredType].push_back(criteria);
         m_AchievementCriteriaListByAchievement[criteria->referredAchievement].push_back(criteria);
+
+        uint32 key;
+        m_AchievementCriteriaTypeKeyed[criteria->requiredType] = GetAchievementCriteriaKey(criteria, key);
+        if (m_AchievementCriteriaTypeKeyed[criteria->requiredType])
+        {
+            m_AchievementCriteriasByTypeAndKey[criteria->requiredType][key].push_back(criteria);
+        }
         ++count;
     }
 
@@ -106,6 +106,7 @@ void AchievementMgr::Reset()
 
     m_completedAchievements.clear();
     m_criteriaProgress.clear();
+    m_completedCriteria.clear();
     DeleteFromDB(m_player->GetObjectGuid());
 
     // re-fill data
@@ -306,6 +307,8 @@ void AchievementMgr::LoadFromDB(QueryResult* achievementResult, QueryResult* cri
                     progress.changed = true;
                 }
             }
+
+            UpdateCompletedCriteriaBit(criteria, achievement);
         }
         while (criteriaResult->NextRow());
         delete criteriaResult;
@@ -469,6 +472,7 @@ void AchievementMgr::StartTimedAchievementCriteria(AchievementCriteriaTypes type
 
         progress->changed = true;
         progress->counter = 0;
+        ClearCompletedCriteriaBit(achievementCriteria->ID);
 
         // Start with given startTime or now
         progress->date = startTime ? startTime : time(NULL);
@@ -521,6 +525,7 @@ void AchievementMgr::DoFailedTimedAchievementCriterias()
 
             // Remove failed progress
             m_criteriaProgress.erase(pro_iter);
+            ClearCompletedCriteriaBit(criteria->ID);
         }
 
         m_criteriaFailTimes.erase(iter++);
@@ -539,11 +544,17 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
         return;
     }
 
-    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr.GetAchievementCriteriaByType(type);
+    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr.GetAchievementCriteriaByTypeAndKey(type, miscvalue1);
     for (AchievementCriteriaEntryList::const_iterator itr = achievementCriteriaList.begin(); itr != achievementCriteriaList.end(); ++itr)
     {
         AchievementCriteriaEntry const* achievementCriteria = *itr;
 
+        // already completed, known without a lookup
+        if (HasCompletedCriteriaBit(achievementCriteria->ID))
+        {
+            continue;
+        }
+
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
         // Checked in LoadAchievementCriteriaList
 
@@ -1878,6 +1889,33 @@ bool AchievementMgr::IsCompletedCriteria(AchievementCriteriaEntry const* achieve
     return progress->counter >= maxcounter || (achievement->Flags & ACHIEVEMENT_FLAG_REQ_COUNT && progress->counter);
 }
 
+void AchievementMgr::UpdateCompletedCriteriaBit(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement)
+{
+    bool completed = !(achievement->Flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL)) &&
+                     IsCompletedCriteria(criteria, achievement);
+
+    if (!completed)
+    {
+        ClearCompletedCriteriaBit(criteria->ID);
+        return;
+    }
+
+    if (criteria->ID >= m_completedCriteria.size())
+    {
+        m_completedCriteria.resize(sAchievementCriteriaStore.GetNumRows());
+    }
+
+    m_completedCriteria[criteria->ID] = true;
+}
+
+void AchievementMgr::ClearCompletedCriteriaBit(uint32 criteriaId)
+{
+    if (criteriaId < m_completedCriteria.size())
+    {
+        m_completedCriteria[criteriaId] = false;
+    }
+}
+
 void AchievementMgr::CompletedCriteriaFor(AchievementEntry const* achievement)
 {
     // counter can never complete
@@ -2053,6 +2091,7 @@ void AchievementMgr::SetCriteriaProgress(AchievementCriteriaEntry const* criteri
 
     progress->counter = newValue;
     progress->changed = true;
+    UpdateCompletedCriteriaBit(criteria, achievement);
 
     // update client side value
     SendCriteriaUpdate(criteria->ID, progress);
@@ -38,6 +38,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 
 struct AchievementEntry;
 struct AchievementCriteriaEntry;
@@ -46,6 +47,7 @@ typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
 
 typedef std::map<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAchievement;
+typedef std::unordered_map<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByKey;
 typedef std::map<uint32, AchievementEntryList>         AchievementListByReferencedId;
 typedef std::map<uint32, time_t>                       AchievementCriteriaFailTimeMap;
 
@@ -311,8 +313,23 @@ class AchievementMgr
         bool IsCompletedAchievement(AchievementEntry const* entry);
         void CompleteAchievementsWithRefs(AchievementEntry const* entry);
 
+        /// Recompute the m_completedCriteria bit of `criteria` after its progress changed.
+        void UpdateCompletedCriteriaBit(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement);
+        void ClearCompletedCriteriaBit(uint32 criteriaId);
+        bool HasCompletedCriteriaBit(uint32 criteriaId) const
+        {
+            return criteriaId < m_completedCriteria.size() && m_completedCriteria[criteriaId];
+        }
+
         Player* m_player;
         CriteriaProgressMap m_criteriaProgress;
+        /**
+         * Criteria ids whose progress has reached IsCompletedCriteria, so that
+         * UpdateAchievementCriteria passes over them without looking anything up.
+         * Realm-first criteria are never set: they stop being complete when someone
+         * else on the realm gets there first.
+         */
+        std::vector<bool> m_completedCriteria;
         CompletedAchievementMap m_completedAchievements;
         AchievementCriteriaFailTimeMap m_criteriaFailTimes;
 };
@@ -320,7 +337,23 @@ class AchievementMgr
 class AchievementGlobalMgr
 {
     public:
+        AchievementGlobalMgr()
+        {
+            for (uint32 i = 0; i < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++i)
+            {
+                m_AchievementCriteriaTypeKeyed[i] = false;
+            }
+        }
+
         AchievementCriteriaEntryList const& GetAchievementCriteriaByType(AchievementCriteriaTypes type);
+        /**
+         * @brief The criteria of `type` an update with `miscvalue1` can touch.
+         *
+         * For types whose miscvalue1 names the one thing a criteria tracks (a
+         * creature entry, item, spell, quest, ...), only the criteria for that
+         * thing; for every other type, or a miscvalue1 of 0, all of them.
+         */
+        AchievementCriteriaEntryList const& GetAchievementCriteriaByTypeAndKey(AchievementCriteriaTypes type, uint32 miscvalue1);
         AchievementCriteriaEntryList const* GetAchievementCriteriaByAchievement(uint32 id);
         AchievementEntryList const* GetAchievementByReferencedId(uint32 id) const;
         AchievementReward const* GetAchievementReward(AchievementEntry const* achievement, uint8 gender) const;
@@ -342,8 +375,13 @@ class AchievementGlobalMgr
     private:
         AchievementCriteriaRequirementMap m_criteriaRequirementMap;
 
+        static bool GetAchievementCriteriaKey(AchievementCriteriaEntry const* criteria, uint32& key);
+
         // store achievement criterias by type to speed up lookup
         AchievementCriteriaEntryList m_AchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        // and by type and key, for the types GetAchievementCriteriaKey knows the key of
+        AchievementCriteriaListByKey m_AchievementCriteriasByTypeAndKey[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        bool m_AchievementCriteriaTypeKeyed[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
         // store achievement criterias by achievement to speed up lookup
         AchievementCriteriaListByAchievement m_AchievementCriteriaListByAchievement;
         // store achievements by referenced achievement id to speed up lookup
@@ -777,19 +777,6 @@ void WorldSession::HandleAuctionListItems(WorldPacket& recv_data)
     // always return pointer
     AuctionHouseObject* auctionHouse = sAuctionMgr.GetAuctionsMap(auctionHouseEntry);
 
-    // Sort
-    AuctionHouseObject::AuctionEntryMap const& aucs = auctionHouse->GetAuctions();
-    std::vector<AuctionEntry*> auctions;
-    auctions.reserve(aucs.size());
-
-    for (AuctionHouseObject::AuctionEntryMap::const_iterator itr = aucs.begin(); itr != aucs.end(); ++itr)
-    {
-        auctions.push_back(itr->second);
-    }
-
-    AuctionSorter sorter(Sort, GetPlayer());
-    std::sort(auctions.begin(), auctions.end(), sorter);
-
     // remove fake death
     if (GetPlayer()->hasUnitState(UNIT_STAT_DIED))
     {
@@ -813,8 +800,34 @@ void WorldSession::HandleAuctionListItems(WorldPacket& recv_data)
 
     wstrToLower(wsearchedname);
 
-    BuildListAuctionItems(auctions, data, wsearchedname, listfrom, levelmin, levelmax, usable,
-                          auctionSlotID, auctionMainCategory, auctionSubCategory, quality, count, totalcount, isFull);
+    std::vector<AuctionEntry*> auctions;
+    if (isFull)
+    {
+        AuctionHouseObject::AuctionEntryMap const& aucs = auctionHouse->GetAuctions();
+        auctions.reserve(aucs.size());
+
+        for (AuctionHouseObject::AuctionEntryMap::const_iterator itr = aucs.begin(); itr != aucs.end(); ++itr)
+        {
+            auctions.push_back(itr->second);
+        }
+    }
+    else
+    {
+        AuctionBrowseFilter filter;
+        filter.name = wsearchedname;
+        filter.locale = GetSessionDbLocaleIndex();
+        filter.levelMin = levelmin;
+        filter.levelMax = levelmax;
+        filter.inventoryType = auctionSlotID;
+        filter.itemClass = auctionMainCategory;
+        filter.itemSubClass = auctionSubCategory;
+        filter.quality = quality;
+
+        auctionHouse->GetBrowseCandidates(filter, auctions);
+    }
+
+    AuctionSorter sorter(Sort, GetPlayer());
+    BuildListAuctionItems(auctions, sorter, data, listfrom, usable, count, totalcount, isFull);
 
     data.put<uint32>(0, count);
     data << uint32(totalcount);
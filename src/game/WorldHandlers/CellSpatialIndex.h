@@ -0,0 +1,193 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file CellSpatialIndex.h
+ * @brief Packed positions of the units standing in one grid cell.
+ *
+ * An area search used to walk the cell's object lists and ask every object in
+ * them for its placement -- a pointer chase and a cache miss per object, most
+ * of them only to learn that the object was out of range. The index keeps the
+ * same positions in plain arrays, one per coordinate, so the distance test runs
+ * down contiguous floats, four at a time where SSE2 is available, and yields
+ * the slots of the candidates before any object is touched.
+ *
+ * The test is a prefilter. It measures from the centre to each entry and
+ * allows for the entry's own extent, so it never drops anything a precise test
+ * against the same range would keep; the caller still makes that test.
+ *
+ * Removal moves the last entry into the freed slot, so slots are dense and do
+ * not stay put: whoever keeps a slot must be told when its entry was moved.
+ */
+
+#ifndef MANGOS_H_CELLSPATIALINDEX
+#define MANGOS_H_CELLSPATIALINDEX
+
+#include "Platform/Define.h"
+
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+template<class T>
+class CellSpatialIndex
+{
+    public:
+        static const uint32 NOT_INDEXED = 0xFFFFFFFF;
+
+        bool empty() const { return iObjects.empty(); }
+        size_t size() const { return iObjects.size(); }
+
+        T* at(uint32 slot) const { return iObjects[slot]; }
+
+        /// Add an entry; returns its slot.
+        uint32 insert(T* obj, float x, float y, float z, float extent, uint32 typeMask)
+        {
+            iX.push_back(x);
+            iY.push_back(y);
+            iZ.push_back(z);
+            iExtent.push_back(extent);
+            iTypeMask.push_back(typeMask);
+            iObjects.push_back(obj);
+            return uint32(iObjects.size() - 1);
+        }
+
+        void move(uint32 slot, float x, float y, float z, float extent)
+        {
+            iX[slot] = x;
+            iY[slot] = y;
+            iZ[slot] = z;
+            iExtent[slot] = extent;
+        }
+
+        /**
+         * @brief Drops the entry in `slot`.
+         *
+         * @return the object whose entry now occupies `slot`, or NULL if the
+         *         dropped entry was the last one
+         */
+        T* remove(uint32 slot)
+        {
+            uint32 last = uint32(iObjects.size() - 1);
+            T* moved = NULL;
+            if (slot != last)
+            {
+                iX[slot] = iX[last];
+                iY[slot] = iY[last];
+                iZ[slot] = iZ[last];
+                iExtent[slot] = iExtent[last];
+                iTypeMask[slot] = iTypeMask[last];
+                iObjects[slot] = iObjects[last];
+                moved = iObjects[slot];
+            }
+
+            iX.pop_back();
+            iY.pop_back();
+            iZ.pop_back();
+            iExtent.pop_back();
+            iTypeMask.pop_back();
+            iObjects.pop_back();
+            return moved;
+        }
+
+        /**
+         * @brief Appends the objects that may lie within `range` of a point.
+         *
+         * An entry is a candidate if any of `typeMask` is in its own mask and the
+         * point is no further than `range` plus the entry's extent from it, in
+         * three dimensions or, with `is3D` false, on the ground plane.
+         */
+        void select(float cx, float cy, float cz, float range, uint32 typeMask, bool is3D, std::vector<T*>& out) const
+        {
+            const uint32 count = uint32(iObjects.size());
+            const float dzScale = is3D ? 1.0f : 0.0f;
+            uint32 i = 0;
+
+#if defined(__SSE2__)
+            const __m128 centerX = _mm_set1_ps(cx);
+            const __m128 centerY = _mm_set1_ps(cy);
+            const __m128 centerZ = _mm_set1_ps(cz);
+            const __m128 reach = _mm_set1_ps(range);
+            const __m128 zScale = _mm_set1_ps(dzScale);
+            const __m128i wanted = _mm_set1_epi32(int32(typeMask));
+            const __m128i none = _mm_setzero_si128();
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 dx = _mm_sub_ps(_mm_loadu_ps(&iX[i]), centerX);
+                __m128 dy = _mm_sub_ps(_mm_loadu_ps(&iY[i]), centerY);
+                __m128 dz = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&iZ[i]), centerZ), zScale);
+                __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+                __m128 limit = _mm_add_ps(reach, _mm_loadu_ps(&iExtent[i]));
+                __m128 inRange = _mm_cmple_ps(distSq, _mm_mul_ps(limit, limit));
+
+                __m128i types = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&iTypeMask[i])), wanted);
+                __m128 wrongType = _mm_castsi128_ps(_mm_cmpeq_epi32(types, none));
+
+                int hits = _mm_movemask_ps(_mm_andnot_ps(wrongType, inRange));
+                while (hits)
+                {
+                    int lane = 0;
+                    while (!(hits & (1 << lane)))
+                    {
+                        ++lane;
+                    }
+                    hits &= ~(1 << lane);
+                    out.push_back(iObjects[i + lane]);
+                }
+            }
+#endif
+
+            for (; i < count; ++i)
+            {
+                if (!(iTypeMask[i] & typeMask))
+                {
+                    continue;
+                }
+
+                float dx = iX[i] - cx;
+                float dy = iY[i] - cy;
+                float dz = (iZ[i] - cz) * dzScale;
+                float limit = range + iExtent[i];
+                if (dx * dx + dy * dy + dz * dz <= limit * limit)
+                {
+                    out.push_back(iObjects[i]);
+                }
+            }
+        }
+
+    private:
+        std::vector<float> iX;
+        std::vector<float> iY;
+        std::vector<float> iZ;
+        std::vector<float> iExtent;
+        std::vector<uint32> iTypeMask;
+        std::vector<T*> iObjects;
+};
+
+#endif
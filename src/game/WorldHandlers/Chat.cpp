@@ -281,6 +281,7 @@ ChatCommand* ChatHandler::getCommandTable()
         { "anim",           SEC_GAMEMASTER,     false, &ChatHandler::HandleDebugAnimCommand,                "", NULL },
         { "arena",          SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugArenaCommand,               "", NULL },
         { "bg",             SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugBattlegroundCommand,        "", NULL },
+        { "dbscripts",      SEC_GAMEMASTER,     false, &ChatHandler::HandleDebugDbScriptsCommand,           "", NULL },
         { "getitemstate",   SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugGetItemStateCommand,        "", NULL },
         { "lootrecipient",  SEC_GAMEMASTER,     false, &ChatHandler::HandleDebugGetLootRecipientCommand,    "", NULL },
         { "losdebug",       SEC_GAMEMASTER,     false, &ChatHandler::HandleDebugLosCommand,                 "", NULL },
@@ -355,6 +356,7 @@ ChatCommand* ChatHandler::getCommandTable()
         { "info",           SEC_GAMEMASTER,     false, &ChatHandler::HandleGridInfoCommand,            "", NULL },
         { "anchors",        SEC_GAMEMASTER,     false, &ChatHandler::HandleGridAnchorsCommand,         "", NULL },
         { "lwstats",        SEC_GAMEMASTER,     false, &ChatHandler::HandleGridLwStatsCommand,         "", NULL },
+        { "ticks",          SEC_GAMEMASTER,     false, &ChatHandler::HandleGridTicksCommand,           "", NULL },
         { NULL,             0,                  false, NULL,                                           "", NULL }
     };
 
@@ -727,6 +729,14 @@ ChatCommand* ChatHandler::getCommandTable()
         { NULL,             0,                  false, NULL,                                           "", NULL }
     };
 
+    static ChatCommand serverTraceCommandTable[] =
+    {
+        { "dump",           SEC_CONSOLE,        true,  &ChatHandler::HandleServerTraceDumpCommand,     "", NULL },
+        { "off",            SEC_CONSOLE,        true,  &ChatHandler::HandleServerTraceOffCommand,      "", NULL },
+        { "on",             SEC_CONSOLE,        true,  &ChatHandler::HandleServerTraceOnCommand,       "", NULL },
+        { NULL,             0,                  false, NULL,                                           "", NULL }
+    };
+
     static ChatCommand serverSetCommandTable[] =
     {
         { "motd",           SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerSetMotdCommand,       "", NULL },
@@ -736,6 +746,7 @@ ChatCommand* ChatHandler::getCommandTable()
     static ChatCommand serverCommandTable[] =
     {
         { "corpses",        SEC_GAMEMASTER,     true,  &ChatHandler::HandleServerCorpsesCommand,       "", NULL },
+        { "dbstats",        SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerDbStatsCommand,       "", NULL },
         { "exit",           SEC_CONSOLE,        true,  &ChatHandler::HandleServerExitCommand,          "", NULL },
         { "idlerestart",    SEC_ADMINISTRATOR,  true,  NULL,                                           "", serverIdleRestartCommandTable },
         { "idleshutdown",   SEC_ADMINISTRATOR,  true,  NULL,                                           "", serverIdleShutdownCommandTable },
@@ -746,6 +757,8 @@ ChatCommand* ChatHandler::getCommandTable()
         { "restart",        SEC_ADMINISTRATOR,  true,  NULL,                                           "", serverRestartCommandTable },
         { "shutdown",       SEC_ADMINISTRATOR,  true,  NULL,                                           "", serverShutdownCommandTable },
         { "set",            SEC_ADMINISTRATOR,  true,  NULL,                                           "", serverSetCommandTable },
+        { "tickstats",      SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleServerTickStatsCommand,     "", NULL },
+        { "trace",          SEC_CONSOLE,        true,  NULL,                                           "", serverTraceCommandTable },
         { NULL,             0,                  false, NULL,                                           "", NULL }
     };
 
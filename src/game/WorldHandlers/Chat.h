@@ -264,6 +264,7 @@ class ChatHandler
         bool HandleDebugAnimCommand(char* args);
         bool HandleDebugArenaCommand(char* args);
         bool HandleDebugBattlegroundCommand(char* args);
+        bool HandleDebugDbScriptsCommand(char* args);
         bool HandleDebugGetItemStateCommand(char* args);
         bool HandleDebugGetItemValueCommand(char* args);
         bool HandleDebugGetLootRecipientCommand(char* args);
@@ -579,6 +580,11 @@ class ChatHandler
         bool HandleSendMassMoneyCommand(char* args);
 
         bool HandleServerCorpsesCommand(char* args);
+        bool HandleServerDbStatsCommand(char* args);
+        bool HandleServerTickStatsCommand(char* args);
+        bool HandleServerTraceDumpCommand(char* args);
+        bool HandleServerTraceOffCommand(char* args);
+        bool HandleServerTraceOnCommand(char* args);
         bool HandleServerExitCommand(char* args);
         bool HandleServerIdleRestartCommand(char* args);
         bool HandleServerIdleShutDownCommand(char* args);
@@ -709,6 +715,7 @@ class ChatHandler
         bool HandleGridInfoCommand(char* args);
         bool HandleGridAnchorsCommand(char* args);
         bool HandleGridLwStatsCommand(char* args);
+        bool HandleGridTicksCommand(char* args);
 
         //! Development Commands
         bool HandleSaveAllCommand(char* args);
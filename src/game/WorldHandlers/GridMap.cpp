@@ -220,6 +220,14 @@ void TerrainInfo::Unload(const uint32 x, const uint32 y)
     }
 }
 
+void TerrainInfo::Prefetch(const uint32 x, const uint32 y) const
+{
+    MANGOS_ASSERT(x < MAX_NUMBER_OF_GRIDS);
+    MANGOS_ASSERT(y < MAX_NUMBER_OF_GRIDS);
+
+    m_terrain.Prefetch(int(x), int(y));
+}
+
 void TerrainInfo::CleanUpGrids(const uint32 diff)
 {
     m_terrain.Update(diff);
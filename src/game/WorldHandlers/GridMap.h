@@ -236,6 +236,10 @@ class TerrainInfo : public Referencable<AtomicLong>
         // Ages the tile cache and reclaims what no active grid holds.
         void CleanUpGrids(const uint32 diff);
 
+        // Reads the tile of grid (x,y) ahead of Load(), from any thread. The navmesh
+        // tile is left to Load(): the mmap manager is not safe off the map thread.
+        void Prefetch(const uint32 x, const uint32 y) const;
+
     protected:
         friend class Map;
         bool Load(const uint32 x, const uint32 y);
@@ -285,6 +285,7 @@ void ObjectUpdater::Visit(GridRefManager<T>& m)
     // type whose Update() can call Map::CreatureRelocation / RemoveFromGrid.
     for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
+        i_quiescentFor = std::min(i_quiescentFor, iter->getSource()->GetQuiescentTime());
         WorldObject::UpdateHelper helper(iter->getSource());
         helper.Update(i_timeDiff);
     }
@@ -124,7 +124,8 @@ namespace MaNGOS
     struct ObjectUpdater
     {
         uint32 i_timeDiff;
-        explicit ObjectUpdater(const uint32& diff) : i_timeDiff(diff) {}
+        uint32 i_quiescentFor;                              // least GetQuiescentTime() of the objects visited since the caller reset it
+        explicit ObjectUpdater(const uint32& diff) : i_timeDiff(diff), i_quiescentFor(UINT32_MAX) {}
         template<class T> void Visit(GridRefManager<T>& m);
         void Visit(PlayerMapType&) {}
         void Visit(CorpseMapType&) {}
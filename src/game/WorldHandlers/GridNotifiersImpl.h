@@ -60,6 +60,8 @@ inline void MaNGOS::ObjectUpdater::Visit(CreatureMapType& m)
     {
         Creature* c = iter->getSource();
         ++iter;                       // capture successor before Update may relocate c
+        // asked before the update: c may be on its way to the remove list afterwards
+        i_quiescentFor = std::min(i_quiescentFor, c->GetQuiescentTime());
         WorldObject::UpdateHelper helper(c);
         helper.Update(i_timeDiff);
     }
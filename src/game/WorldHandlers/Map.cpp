@@ -54,6 +54,7 @@
 #include "Player.h"
 #include "GridNotifiers.h"
 #include "Log.h"
+#include "Trace.h"
 #include "GridStates.h"
 #include "CellImpl.h"
 #include "InstanceData.h"
@@ -141,6 +142,9 @@ Map::~Map()
     // unload instance specific navigation data
     MMAP::MMapFactory::createOrGetMMapManager()->unloadMapInstance(m_TerrainData->GetMapId(), GetInstanceId());
 
+    // no prepare job may still be reading through our terrain pointer
+    sMapMgr.GetGridPreloader().forget(m_TerrainData);
+
     // release reference count
     if (m_TerrainData->Release())
     {
@@ -322,6 +326,7 @@ template<class T>
 void Map::AddToGrid(T* obj, NGridType* grid, Cell const& cell)
 {
     (*grid)(cell.CellX(), cell.CellY()).template AddGridObject<T>(obj);
+    WakeCell(cell.cellPair().x_coord, cell.cellPair().y_coord);
 }
 
 /**
@@ -343,6 +348,7 @@ void Map::AddToGrid(Player* obj, NGridType* grid, Cell const& cell)
 {
     (*grid)(cell.CellX(), cell.CellY()).AddWorldObject(obj);
     grid->incPlayerCount();
+    AddSpatialEntry(obj, cell);
 }
 
 /**
@@ -403,6 +409,10 @@ void Map::AddToGrid(Creature* obj, NGridType* grid, Cell const& cell)
         (*grid)(cell.CellX(), cell.CellY()).AddGridObject<Creature>(obj);
         obj->SetCurrentCell(cell);
     }
+    AddSpatialEntry(obj, cell);
+
+    // arriving by spawn or by walking in, it has not been asked about its cell yet
+    WakeCell(cell.cellPair().x_coord, cell.cellPair().y_coord);
 }
 
 /**
@@ -445,6 +455,7 @@ template<>
 void Map::RemoveFromGrid(Player* obj, NGridType* grid, Cell const& cell)
 {
     (*grid)(cell.CellX(), cell.CellY()).RemoveWorldObject(obj);
+    RemoveSpatialEntry(obj);
     grid->decPlayerCount();
     if (grid->getPlayerCount() == 0)
     {
@@ -508,6 +519,7 @@ void Map::RemoveFromGrid(Creature* obj, NGridType* grid, Cell const& cell)
     {
         (*grid)(cell.CellX(), cell.CellY()).RemoveGridObject<Creature>(obj);
     }
+    RemoveSpatialEntry(obj);
 }
 
 /**
@@ -604,6 +616,8 @@ bool Map::EnsureGridLoaded(const Cell& cell)
     MANGOS_ASSERT(grid != NULL);
     if (!isGridObjectDataLoaded(cell.GridX(), cell.GridY()))
     {
+        TRACE_SCOPE("grid load");
+
         bool wasEnvelope = (grid->loadedCellCount() > 0);
         grid->markGridObjectDataLoading(); // re-entrancy guard (upstream semantics)
         ObjectGridLoader loader(*grid, this, cell);
@@ -682,6 +696,76 @@ bool Map::EnsureCellEnvelopeLoaded(const Cell& centerCell)
     return didWork;
 }
 
+/// How far past the visibility distance a moving player's grids are prepared.
+static const float GRID_PRELOAD_LOOKAHEAD = 2 * SIZE_OF_GRID_CELL;
+
+/**
+ * @brief Hands the grids a player at (x,y) is about to see to the GridPreloader.
+ *
+ * Any grid within visibility distance is loaded by the next visibility update, so
+ * the ones worth preparing are those just beyond it. Each grid is asked for once
+ * until it is unloaded again. The display ids are collected here, on the map
+ * thread, because the spawn tables change under game events; the reads they lead
+ * to are the preloader's.
+ */
+void Map::PrepareGridsAhead(float x, float y)
+{
+    GridPreloader& preloader = sMapMgr.GetGridPreloader();
+    if (!preloader.activated())
+    {
+        return;
+    }
+
+    CellArea area = Cell::CalculateCellArea(x, y, GetVisibilityDistance() + GRID_PRELOAD_LOOKAHEAD);
+    uint32 lowX = std::min(area.low_bound.x_coord, area.high_bound.x_coord) / MAX_NUMBER_OF_CELLS;
+    uint32 highX = std::max(area.low_bound.x_coord, area.high_bound.x_coord) / MAX_NUMBER_OF_CELLS;
+    uint32 lowY = std::min(area.low_bound.y_coord, area.high_bound.y_coord) / MAX_NUMBER_OF_CELLS;
+    uint32 highY = std::max(area.low_bound.y_coord, area.high_bound.y_coord) / MAX_NUMBER_OF_CELLS;
+
+    for (uint32 gridX = lowX; gridX <= highX && gridX < MAX_NUMBER_OF_GRIDS; ++gridX)
+    {
+        for (uint32 gridY = lowY; gridY <= highY && gridY < MAX_NUMBER_OF_GRIDS; ++gridY)
+        {
+            uint32 index = gridX * MAX_NUMBER_OF_GRIDS + gridY;
+            if (m_preparedGrids.test(index) || loaded(GridPair(gridX, gridY)))
+            {
+                continue;
+            }
+            m_preparedGrids.set(index);
+
+            std::vector<uint32> displayIds;
+            for (uint32 cellX = gridX * MAX_NUMBER_OF_CELLS; cellX < (gridX + 1) * MAX_NUMBER_OF_CELLS; ++cellX)
+            {
+                for (uint32 cellY = gridY * MAX_NUMBER_OF_CELLS; cellY < (gridY + 1) * MAX_NUMBER_OF_CELLS; ++cellY)
+                {
+                    uint32 cellId = cellY * TOTAL_NUMBER_OF_CELLS_PER_MAP + cellX;
+                    CellObjectGuids const* guids = sObjectMgr.GetCellObjectGuidsReadOnly(i_id, cellId, i_spawnMode);
+                    if (!guids)
+                    {
+                        continue;
+                    }
+
+                    for (CellGuidSet::const_iterator itr = guids->gameobjects.begin(); itr != guids->gameobjects.end(); ++itr)
+                    {
+                        GameObjectData const* data = sObjectMgr.GetGOData(*itr);
+                        GameObjectInfo const* goinfo = data ? ObjectMgr::GetGameObjectInfo(data->id) : NULL;
+                        if (goinfo)
+                        {
+                            displayIds.push_back(goinfo->displayId);
+                        }
+                    }
+                }
+            }
+
+            std::sort(displayIds.begin(), displayIds.end());
+            displayIds.erase(std::unique(displayIds.begin(), displayIds.end()), displayIds.end());
+
+            // terrain is indexed from the other corner, as in EnsureGridCreated
+            preloader.schedule(m_TerrainData, (MAX_NUMBER_OF_GRIDS - 1) - gridX, (MAX_NUMBER_OF_GRIDS - 1) - gridY, std::move(displayIds));
+        }
+    }
+}
+
 /**
  * @brief Forces the grid at the provided coordinates to load and stay locked.
  *
@@ -933,6 +1017,161 @@ bool Map::loaded(const GridPair& p) const
     return (getNGrid(p.x_coord, p.y_coord) && isGridObjectDataLoaded(p.x_coord, p.y_coord));
 }
 
+/**
+ * @brief Wakes the cell holding an object, so that Update ticks it next time.
+ *
+ * @param obj The object that changed.
+ */
+void Map::WakeCell(WorldObject const* obj)
+{
+    if (m_sleepingCells.empty() && m_visitingCell == NO_VISITING_CELL)
+    {
+        return;
+    }
+
+    CellPair p = MaNGOS::ComputeCellPair(obj->Where().X(), obj->Where().Y());
+    if (p.x_coord < TOTAL_NUMBER_OF_CELLS_PER_MAP && p.y_coord < TOTAL_NUMBER_OF_CELLS_PER_MAP)
+    {
+        WakeCell(p.x_coord, p.y_coord);
+    }
+}
+
+/**
+ * @brief Wakes a cell, so that Update ticks it next time.
+ *
+ * Called for the cell Update is ticking right now, it keeps the cell from going to
+ * sleep afterwards: something in it changed after its objects were asked.
+ *
+ * @param cellX The cell column on the map.
+ * @param cellY The cell row on the map.
+ */
+void Map::WakeCell(uint32 cellX, uint32 cellY)
+{
+    uint32 cell_id = (cellY * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cellX;
+    if (cell_id == m_visitingCell)
+    {
+        m_visitingCellWoken = true;
+    }
+    else if (!m_sleepingCells.empty())
+    {
+        m_sleepingCells.erase(cell_id);
+    }
+}
+
+/**
+ * @brief Enters a unit into the spatial index of the cell it was just added to.
+ *
+ * @param unit The unit; its placement must already be in that cell, or about to be.
+ * @param cell The cell inside the grid.
+ */
+void Map::AddSpatialEntry(Unit* unit, Cell const& cell)
+{
+    RemoveSpatialEntry(unit);
+
+    CellPair p = cell.cellPair();
+    uint32 cell_id = (p.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + p.x_coord;
+    uint32 typeMask = unit->GetTypeId() == TYPEID_PLAYER ? uint32(TYPEMASK_UNIT | TYPEMASK_PLAYER) : uint32(TYPEMASK_UNIT);
+
+    Geometry::Placement const& pos = unit->Where();
+    uint32 slot = m_spatialIndex[cell_id].insert(unit, pos.X(), pos.Y(), pos.Z(), pos.Extent(), typeMask);
+    unit->SetSpatialEntry(cell_id, slot);
+}
+
+/**
+ * @brief Takes a unit out of the spatial index, if it is in one.
+ *
+ * @param unit The unit leaving its cell or the world.
+ */
+void Map::RemoveSpatialEntry(Unit* unit)
+{
+    uint32 cell_id = unit->GetSpatialCell();
+    if (cell_id == CellSpatialIndex<Unit>::NOT_INDEXED)
+    {
+        return;
+    }
+
+    uint32 slot = unit->GetSpatialSlot();
+    unit->SetSpatialEntry(CellSpatialIndex<Unit>::NOT_INDEXED, CellSpatialIndex<Unit>::NOT_INDEXED);
+
+    SpatialIndexMap::iterator itr = m_spatialIndex.find(cell_id);
+    if (itr == m_spatialIndex.end())
+    {
+        return;
+    }
+
+    // the last entry was moved into the freed slot
+    if (Unit* moved = itr->second.remove(slot))
+    {
+        moved->SetSpatialEntry(cell_id, slot);
+    }
+
+    if (itr->second.empty())
+    {
+        m_spatialIndex.erase(itr);
+    }
+}
+
+/**
+ * @brief Copies a unit's current placement into its spatial index entry.
+ *
+ * A unit moving across a cell border is re-entered by AddToGrid; this covers the
+ * moves inside one cell, and the position a creature takes after it was added.
+ *
+ * @param unit The unit that moved.
+ */
+void Map::RefreshSpatialEntry(Unit* unit)
+{
+    uint32 cell_id = unit->GetSpatialCell();
+    if (cell_id == CellSpatialIndex<Unit>::NOT_INDEXED)
+    {
+        return;
+    }
+
+    SpatialIndexMap::iterator itr = m_spatialIndex.find(cell_id);
+    if (itr != m_spatialIndex.end())
+    {
+        Geometry::Placement const& pos = unit->Where();
+        itr->second.move(unit->GetSpatialSlot(), pos.X(), pos.Y(), pos.Z(), pos.Extent());
+    }
+}
+
+/**
+ * @brief Collects the units that may be within range of a point.
+ *
+ * Looks at the same cells Cell::Visit would for the range and appends every unit
+ * whose indexed position, allowing for its extent, is within `range` of the point
+ * in three dimensions. Only cells with units in them are looked at, and no unit
+ * is touched that fails the test.
+ *
+ * @param x The X coordinate of the centre.
+ * @param y The Y coordinate of the centre.
+ * @param z The Z coordinate of the centre.
+ * @param range The search radius, including any extent of the searcher.
+ * @param typeMask TYPEMASK_UNIT for every unit, TYPEMASK_PLAYER for players only.
+ * @param out Receives the candidates.
+ */
+void Map::SelectUnitCandidates(float x, float y, float z, float range, uint32 typeMask, std::vector<Unit*>& out) const
+{
+    if (m_spatialIndex.empty())
+    {
+        return;
+    }
+
+    // the cell range is limited as Cell::Visit limits it
+    CellArea area = Cell::CalculateCellArea(x, y, std::min(range, 333.0f));
+    for (uint32 cellX = area.low_bound.x_coord; cellX <= area.high_bound.x_coord; ++cellX)
+    {
+        for (uint32 cellY = area.low_bound.y_coord; cellY <= area.high_bound.y_coord; ++cellY)
+        {
+            SpatialIndexMap::const_iterator itr = m_spatialIndex.find((cellY * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cellX);
+            if (itr != m_spatialIndex.end())
+            {
+                itr->second.select(x, y, z, range, typeMask, true, out);
+            }
+        }
+    }
+}
+
 /**
  * @brief Updates map sessions, active objects, scripts, and grid states for one tick.
  *
@@ -940,6 +1179,9 @@ bool Map::loaded(const GridPair& p) const
  */
 void Map::Update(const uint32& t_diff)
 {
+    TRACE_SCOPE("map update");
+    TickLapTimer lap(m_tickStats);
+
     /// update worldsessions for existing players
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
@@ -952,6 +1194,7 @@ void Map::Update(const uint32& t_diff)
             pSession->Update(updater);
         }
     }
+    lap.Lap(TICK_PHASE_MAP_SESSIONS);
 
     /// update players at tick
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
@@ -963,6 +1206,7 @@ void Map::Update(const uint32& t_diff)
             helper.Update(t_diff);
         }
     }
+    lap.Lap(TICK_PHASE_MAP_PLAYERS);
 
     /// update active cells around players and active objects
     resetMarkedCells();
@@ -973,6 +1217,58 @@ void Map::Update(const uint32& t_diff)
     // for pets
     TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
 
+    // A cell whose objects all said they could go without updates sleeps for as long
+    // as the least of them allowed, capped so that a disturbance nothing reported is
+    // still picked up. Anything that changes one of them wakes the cell early.
+    uint32 const maxSleep = sWorld.getConfig(CONFIG_UINT32_MAP_IDLE_CELL_SLEEP);
+    m_cellClock += t_diff;
+    if (!maxSleep)
+    {
+        m_sleepingCells.clear();
+    }
+
+    auto updateCell = [&](uint32 x, uint32 y)
+    {
+        uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
+
+        if (!m_sleepingCells.empty())
+        {
+            std::unordered_map<uint32, uint32>::iterator sleeping = m_sleepingCells.find(cell_id);
+            if (sleeping != m_sleepingCells.end())
+            {
+                // still asleep while the wake-up time is ahead, and never further than one
+                // sleep ahead (the clock wraps, and the limit may have been lowered)
+                uint32 left = sleeping->second - m_cellClock;
+                if (left && left <= maxSleep)
+                {
+                    ++m_cellTickStats.skipped;
+                    return;
+                }
+
+                m_sleepingCells.erase(sleeping);
+            }
+        }
+
+        CellPair pair(x, y);
+        Cell cell(pair);
+        cell.SetNoCreate();
+
+        m_visitingCell = cell_id;
+        m_visitingCellWoken = false;
+        updater.i_quiescentFor = UINT32_MAX;
+
+        Visit(cell, grid_object_update);
+        Visit(cell, world_object_update);
+
+        if (maxSleep && !m_visitingCellWoken && updater.i_quiescentFor)
+        {
+            m_sleepingCells[cell_id] = m_cellClock + std::min(updater.i_quiescentFor, maxSleep);
+        }
+
+        m_visitingCell = NO_VISITING_CELL;
+        ++m_cellTickStats.visited;
+    };
+
     // the player iterator is stored in the map object
     // to make sure calls to Map::Remove don't invalidate it
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
@@ -997,11 +1293,7 @@ void Map::Update(const uint32& t_diff)
                 if (!isCellMarked(cell_id))
                 {
                     markCell(cell_id);
-                    CellPair pair(x, y);
-                    Cell cell(pair);
-                    cell.SetNoCreate();
-                    Visit(cell, grid_object_update);
-                    Visit(cell, world_object_update);
+                    updateCell(x, y);
                 }
             }
         }
@@ -1037,19 +1329,18 @@ void Map::Update(const uint32& t_diff)
                     if (!isCellMarked(cell_id))
                     {
                         markCell(cell_id);
-                        CellPair pair(x, y);
-                        Cell cell(pair);
-                        cell.SetNoCreate();
-                        Visit(cell, grid_object_update);
-                        Visit(cell, world_object_update);
+                        updateCell(x, y);
                     }
                 }
             }
         }
     }
 
+    lap.Lap(TICK_PHASE_MAP_CELLS);
+
     // Send world objects and item update field changes
     SendObjectUpdates();
+    lap.Lap(TICK_PHASE_MAP_OBJECT_UPDATES);
 
     // Don't unload grids if it's battleground, since we may have manually added GOs,creatures, those doesn't load from DB at grid re-load !
     // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
@@ -1066,11 +1357,13 @@ void Map::Update(const uint32& t_diff)
     }
 
     ProcessPendingCellUnloads();
+    lap.Lap(TICK_PHASE_MAP_GRIDS);
 
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty())
     {
         ScriptsProcess();
+        lap.Lap(TICK_PHASE_MAP_SCRIPTS);
     }
 
 #ifdef ENABLE_ELUNA
@@ -1083,11 +1376,13 @@ void Map::Update(const uint32& t_diff)
 
         e->OnMapUpdate(this, t_diff);
     }
+    lap.Lap(TICK_PHASE_MAP_ELUNA);
 #endif /* ENABLE_ELUNA */
 
     if (i_data)
     {
         i_data->Update(t_diff);
+        lap.Lap(TICK_PHASE_MAP_INSTANCE_DATA);
     }
 
     m_weatherSystem->UpdateWeathers(t_diff);
@@ -1114,6 +1409,14 @@ void Map::Update(const uint32& t_diff)
             }
         }
     }
+    lap.Lap(TICK_PHASE_MAP_TRANSPORTS);
+    lap.Finish(TICK_PHASE_MAP_TOTAL);
+
+    m_tickStats.sinceHandOver += t_diff;
+    if (m_tickStats.sinceHandOver >= TICK_STATS_HAND_OVER_INTERVAL)
+    {
+        sTickStats.HandOver(GetId(), GetInstanceId(), m_tickStats);
+    }
 }
 
 /**
@@ -1346,6 +1649,8 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
 
         NGridType* newGrid = getNGrid(new_cell.GridX(), new_cell.GridY());
         player->GetViewPoint().Event_GridChanged(&(*newGrid)(new_cell.CellX(), new_cell.CellY()));
+
+        PrepareGridsAhead(x, y);
     }
 
     player->OnRelocated();
@@ -1789,6 +2094,7 @@ bool Map::UnloadGrid(const uint32& x, const uint32& y, bool pForce)
         m_bLoadedGrids[gx][gy] = false;
         m_TerrainData->Unload(gx, gy);
     }
+    m_preparedGrids.reset(x * MAX_NUMBER_OF_GRIDS + y);
 
     DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Unloading grid[%u,%u] for map %u finished", x, y, i_id);
     return true;
@@ -3000,15 +3306,19 @@ bool Map::ScriptsStart(DBScriptType type, uint32 id, Object* source, Object* tar
 
     if (execParams)                                         // Check if the execution should be uniquely
     {
-        for (ScriptScheduleMap::const_iterator searchItr = m_scriptSchedule.begin(); searchItr != m_scriptSchedule.end(); ++searchItr)
+        ObjectGuid uniqueSource = (execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_SOURCE) ? sourceGuid : ObjectGuid();
+        ObjectGuid uniqueTarget = (execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_TARGET) ? targetGuid : ObjectGuid();
+        auto sameScript = [&](ScriptAction const& step)
         {
-            if (searchItr->second.IsSameScript(type, id,
-                                               (execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_SOURCE) ? sourceGuid : ObjectGuid(),
-                                               (execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_TARGET) ? targetGuid : ObjectGuid(), ownerGuid))
-            {
-                DEBUG_FILTER_LOG(LOG_FILTER_DB_SCRIPTS, "DB-SCRIPTS: Process table `dbscripts [type=%d]` id %u. Skip script as script already started for source %s, target %s - ScriptsStartParams %u", type, id, sourceGuid.GetString().c_str(), targetGuid.GetString().c_str(), execParams);
-                return true;
-            }
+            return step.IsSameScript(type, id, uniqueSource, uniqueTarget, ownerGuid);
+        };
+
+        // the step being handled right now still counts as started
+        if ((m_runningScriptStep && sameScript(*m_runningScriptStep)) || m_scriptSchedule.Any(type, id, sameScript))
+        {
+            ++m_duplicateScriptStarts;
+            DEBUG_FILTER_LOG(LOG_FILTER_DB_SCRIPTS, "DB-SCRIPTS: Process table `dbscripts [type=%d]` id %u. Skip script as script already started for source %s, target %s - ScriptsStartParams %u", type, id, sourceGuid.GetString().c_str(), targetGuid.GetString().c_str(), execParams);
+            return true;
         }
     }
 
@@ -3018,7 +3328,7 @@ bool Map::ScriptsStart(DBScriptType type, uint32 id, Object* source, Object* tar
     {
         ScriptAction sa(type, this, sourceGuid, targetGuid, ownerGuid, &(*iter));
 
-        m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld.GetGameTime() + iter->delay), sa));
+        m_scriptSchedule.Schedule(time_t(sWorld.GetGameTime() + iter->delay), sa);
 
         sScriptMgr.IncreaseScheduledScriptsCount();
     }
@@ -3045,7 +3355,7 @@ void Map::ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* sou
 
     ScriptAction sa(DBS_INTERNAL, this, sourceGuid, targetGuid, ownerGuid, &script);
 
-    m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld.GetGameTime() + delay), sa));
+    m_scriptSchedule.Schedule(time_t(sWorld.GetGameTime() + delay), sa);
 
     sScriptMgr.IncreaseScheduledScriptsCount();
 }
@@ -3060,40 +3370,33 @@ void Map::ScriptsProcess()
         return;
     }
 
-    ///- Process overdue queued scripts
-    ScriptScheduleMap::iterator iter = m_scriptSchedule.begin();
-    // ok as multimap is a *sorted* associative container
-    while (!m_scriptSchedule.empty() && (iter->first <= sWorld.GetGameTime()))
+    ///- Process overdue queued scripts, in the order they fall due
+    while (std::optional<ScriptAction> step = m_scriptSchedule.Next(sWorld.GetGameTime()))
     {
-        if (iter->second.HandleScriptStep())
+        m_runningScriptStep = &*step;
+        bool terminate = step->HandleScriptStep();
+        m_runningScriptStep = NULL;
+
+        sScriptMgr.DecreaseScheduledScriptCount();
+
+        if (terminate)
         {
             // Terminate following script steps of this script
-            DBScriptType type = iter->second.GetType();
-            uint32 id = iter->second.GetId();
-            ObjectGuid sourceGuid = iter->second.GetSourceGuid();
-            ObjectGuid targetGuid = iter->second.GetTargetGuid();
-            ObjectGuid ownerGuid = iter->second.GetOwnerGuid();
+            DBScriptType type = step->GetType();
+            uint32 id = step->GetId();
+            ObjectGuid sourceGuid = step->GetSourceGuid();
+            ObjectGuid targetGuid = step->GetTargetGuid();
+            ObjectGuid ownerGuid = step->GetOwnerGuid();
 
-            for (ScriptScheduleMap::iterator rmItr = m_scriptSchedule.begin(); rmItr != m_scriptSchedule.end();)
+            uint32 cancelled = m_scriptSchedule.Cancel(type, id, [&](ScriptAction const& other)
             {
-                if (rmItr->second.IsSameScript(type, id, sourceGuid, targetGuid, ownerGuid))
-                {
-                    m_scriptSchedule.erase(rmItr++);
-                    sScriptMgr.DecreaseScheduledScriptCount();
-                }
-                else
-                {
-                    ++rmItr;
-                }
+                return other.IsSameScript(type, id, sourceGuid, targetGuid, ownerGuid);
+            });
+            if (cancelled)
+            {
+                sScriptMgr.DecreaseScheduledScriptCount(cancelled);
             }
         }
-        else
-        {
-            m_scriptSchedule.erase(iter);
-
-            sScriptMgr.DecreaseScheduledScriptCount();
-        }
-        iter = m_scriptSchedule.begin();
     }
 }
 
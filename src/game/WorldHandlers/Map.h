@@ -64,6 +64,7 @@
 #include "DBCStructure.h"
 #include "GridDefines.h"
 #include "Cell.h"
+#include "CellSpatialIndex.h"
 #include "Object.h"
 #include "Timer.h"
 #include "SharedDefines.h"
@@ -72,6 +73,8 @@
 #include "MapRefManager.h"
 #include "Utilities/TypeList.h"
 #include "ScriptMgr.h"
+#include "ScriptSchedule.h"
+#include "TickStats.h"
 #include "CreatureLinkingMgr.h"
 #include "DynamicCollision.h"
 #ifdef ENABLE_ELUNA
@@ -82,6 +85,7 @@
 #include <optional>
 #include <list>
 #include <set>
+#include <unordered_map>
 
 struct CreatureInfo;
 class Creature;
@@ -317,6 +321,10 @@ class Map : public GridRefManager<NGridType>
         bool ScriptsStart(DBScriptType type, uint32 id, Object* source, Object* target, ScriptExecutionParam execParams = SCRIPT_EXEC_PARAM_NONE);
         void ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* source, Object* target);
 
+        size_t GetScheduledScriptStepCount() const { return m_scriptSchedule.size(); }
+        ScriptSchedule<ScriptAction>::Stats const& GetScriptScheduleStats() const { return m_scriptSchedule.GetStats(); }
+        uint64 GetDuplicateScriptStartCount() const { return m_duplicateScriptStarts; }
+
         // must called with AddToWorld
         void AddToActive(WorldObject* obj);
         // must called with RemoveFromWorld
@@ -433,6 +441,29 @@ class Map : public GridRefManager<NGridType>
         CellEnvelopeStats const& GetCellEnvelopeStats() const { return m_cellEnvStats; }
         CellEnvelopeStats& CellEnvStats() { return m_cellEnvStats; }
 
+        struct CellTickStats
+        {
+            uint64 visited = 0;           // cells whose objects Update ticked
+            uint64 skipped = 0;           // cells Update left alone because they were asleep
+        };
+        CellTickStats const& GetCellTickStats() const { return m_cellTickStats; }
+        uint32 GetSleepingCellCount() const { return uint32(m_sleepingCells.size()); }
+
+        // Update skips a cell whose objects all said they had nothing to do (see
+        // WorldObject::GetQuiescentTime) until its time is up or this is called for
+        // any object in it
+        void WakeCell(WorldObject const* obj);
+        void WakeCell(uint32 cellX, uint32 cellY);
+
+        // Area searches read the units of a cell from packed positions (see
+        // CellSpatialIndex) instead of asking each unit where it is. The candidates
+        // are a superset; the caller still makes its own precise test.
+        void SelectUnitCandidates(float x, float y, float z, float range, uint32 typeMask, std::vector<Unit*>& out) const;
+        void AddSpatialEntry(Unit* unit, Cell const& cell);
+        // after the unit's placement changed without it changing cells
+        void RefreshSpatialEntry(Unit* unit);
+        void RemoveSpatialEntry(Unit* unit);
+
         // true if the grid is in ENVELOPE state (exists, not FULL, has loaded cells)
         bool IsGridEnvelope(uint32 gridX, uint32 gridY) const
         {
@@ -474,6 +505,7 @@ class Map : public GridRefManager<NGridType>
         void EnsureGridCreated(const GridPair&);
         bool EnsureGridLoaded(Cell const&);
         bool EnsureCellEnvelopeLoaded(const Cell& centerCell);
+        void PrepareGridsAhead(float x, float y);
         void UnloadCell(NGridType* grid, uint32 cellX, uint32 cellY);
         void ProcessPendingCellUnloads();
 
@@ -548,12 +580,30 @@ class Map : public GridRefManager<NGridType>
         TerrainInfo* const m_TerrainData;
         bool m_bLoadedGrids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
 
+        /// Grids handed to the GridPreloader since they were last unloaded, by x * MAX_NUMBER_OF_GRIDS + y.
+        std::bitset<MAX_NUMBER_OF_GRIDS* MAX_NUMBER_OF_GRIDS> m_preparedGrids;
+
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP* TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
 
+        static const uint32 NO_VISITING_CELL = TOTAL_NUMBER_OF_CELLS_PER_MAP * TOTAL_NUMBER_OF_CELLS_PER_MAP;
+
+        // asleep cells by cell id, with the m_cellClock reading at which each wakes
+        std::unordered_map<uint32, uint32> m_sleepingCells;
+        uint32 m_cellClock = 0;                             // ms of Update since the map was created
+        uint32 m_visitingCell = NO_VISITING_CELL;           // cell Update is ticking right now
+        bool m_visitingCellWoken = false;                   // WakeCell() hit it while it was ticked
+        CellTickStats m_cellTickStats;
+        TickStatsRecorder m_tickStats;                      // phase times of Update not yet handed to sTickStats
+
+        // the units standing in each cell, by cell id, for SelectUnitCandidates
+        typedef std::unordered_map<uint32, CellSpatialIndex<Unit> > SpatialIndexMap;
+        SpatialIndexMap m_spatialIndex;
+
         std::set<WorldObject*> i_objectsToRemove;
 
-        typedef std::multimap<time_t, ScriptAction> ScriptScheduleMap;
-        ScriptScheduleMap m_scriptSchedule;
+        ScriptSchedule<ScriptAction> m_scriptSchedule;
+        ScriptAction const* m_runningScriptStep = NULL;     // taken off the schedule, being handled
+        uint64 m_duplicateScriptStarts = 0;                 // ScriptsStart calls skipped as already running
 
         InstanceData* i_data;
 
@@ -117,6 +117,12 @@ MapManager::Initialize()
         abort();
     }
 
+    uint32 preload_threads = sWorld.getConfig(CONFIG_UINT32_GRID_PRELOAD_THREADS);
+    if (preload_threads > 0 && m_gridPreloader.activate(preload_threads) == -1)
+    {
+        abort();
+    }
+
     InitStateMachine();
 }
 
@@ -436,6 +442,9 @@ bool MapManager::IsValidMAP(uint32 mapid)
  */
 void MapManager::UnloadAll()
 {
+    // Nothing is worth reading in for maps about to go.
+    m_gridPreloader.deactivate();
+
     // Off the world entirely, while the maps that hold them are still alive. See
     // Transport::WithdrawFromWorld -- no grid unload ever reaches a vessel.
     for (TransportSet::iterator i = m_Transports.begin(); i != m_Transports.end(); ++i)
@@ -35,6 +35,7 @@
 #include "Map.h"
 #include "GridStates.h"
 #include "MapUpdater.h"
+#include "GridPreloader.h"
 
 #include <mutex>
 
@@ -83,6 +84,12 @@ class MapManager : public MaNGOS::Singleton<MapManager>
         void Initialize(void);
         void Update(uint32);
 
+        /// The map worker threads; idle outside Update(), so other tick phases may borrow them.
+        MapUpdater& GetUpdater() { return m_updater; }
+
+        /// Reads grids in ahead of the players walking into them.
+        GridPreloader& GetGridPreloader() { return m_gridPreloader; }
+
         void SetGridCleanUpDelay(uint32 t)
         {
             if (t < MIN_GRID_DELAY)
@@ -188,6 +195,7 @@ class MapManager : public MaNGOS::Singleton<MapManager>
         MapMapType i_maps;
         IntervalTimer i_timer;
         MapUpdater m_updater;
+        GridPreloader m_gridPreloader;
 
         // Plain, not recursive. Every path that used to reenter now goes
         // through a FindMapLocked-style helper instead; see MapManager.cpp.
@@ -198,22 +198,26 @@ class ObjectWorldLoader
  * @tparam T The object type.
  * @param obj The object being loaded.
  * @param cell_pair The destination cell coordinates.
+ * @param map The owning map.
  */
-template<class T> void addUnitState(T* /*obj*/, CellPair const& /*cell_pair*/)
+template<class T> void addUnitState(T* /*obj*/, CellPair const& /*cell_pair*/, Map* /*map*/)
 {
 }
 
 /**
- * @brief Assigns the current cell to a creature being loaded into a grid.
+ * @brief Assigns the current cell to a creature being loaded into a grid and
+ *        enters it into the cell's spatial index.
  *
  * @param obj The creature being loaded.
  * @param cell_pair The destination cell coordinates.
+ * @param map The owning map.
  */
-template<> void addUnitState(Creature* obj, CellPair const& cell_pair)
+template<> void addUnitState(Creature* obj, CellPair const& cell_pair, Map* map)
 {
     Cell cell(cell_pair);
 
     obj->SetCurrentCell(cell);
+    map->AddSpatialEntry(obj, cell);
 }
 
 template <class T>
@@ -246,7 +250,7 @@ void LoadHelper(CellGuidSet const& guid_set, CellPair& cell, GridRefManager<T>&
 
         grid.AddGridObject(obj);
 
-        addUnitState(obj, cell);
+        addUnitState(obj, cell, map);
         obj->SetMap(map);
         obj->AddToWorld();
         if (obj->IsActiveObject())
@@ -299,7 +303,7 @@ void LoadHelper(CellCorpseSet const& cell_corpses, CellPair& cell, CorpseMapType
 
         grid.AddWorldObject(obj);
 
-        addUnitState(obj, cell);
+        addUnitState(obj, cell, map);
         obj->SetMap(map);
         obj->AddToWorld();
         if (obj->IsActiveObject())
@@ -390,6 +394,9 @@ void ObjectGridLoader::LoadCell(uint32 cellX, uint32 cellY)
     i_cell.data.Part.cell_y = cellY;
 
     Load(i_grid(cellX, cellY));
+
+    // a cell that went to sleep empty while its grid was away must see its spawns
+    i_map->WakeCell(i_cell.cellPair().x_coord, i_cell.cellPair().y_coord);
 }
 
 /**
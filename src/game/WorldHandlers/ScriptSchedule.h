@@ -0,0 +1,260 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file ScriptSchedule.h
+ * @brief A map's queue of pending DB script steps.
+ *
+ * Steps are kept in buckets by the second they fall due, in the order they were
+ * scheduled, and also filed under the script (type and id) they belong to. So
+ * running what is due only looks at the front buckets, and a script that ends
+ * early -- or a check for whether it is already running -- only looks at the steps
+ * of that script, not at everything the map has queued.
+ *
+ * A step that is cancelled is marked dead where it stands and dropped when its
+ * bucket is reached, which makes cancelling a step O(1).
+ */
+
+#ifndef MANGOS_H_SCRIPTSCHEDULE
+#define MANGOS_H_SCRIPTSCHEDULE
+
+#include "Platform/Define.h"
+
+#include <ctime>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Time-bucketed queue of script steps.
+ *
+ * @tparam ACTION copyable, with `uint32 GetType() const` and `uint32 GetId() const`
+ *         naming the script it is a step of
+ */
+template<class ACTION>
+class ScriptSchedule
+{
+    public:
+        struct Stats
+        {
+            uint64 scheduled = 0;         // steps ever queued
+            uint64 run = 0;               // steps handed out by Next()
+            uint64 cancelled = 0;         // steps dropped by Cancel()
+            uint32 peak = 0;              // most steps queued at once
+        };
+
+        ScriptSchedule() : m_size(0) {}
+
+        bool empty() const { return m_size == 0; }
+        size_t size() const { return m_size; }
+        Stats const& GetStats() const { return m_stats; }
+
+        void Schedule(time_t due, ACTION const& action)
+        {
+            uint32 slot;
+            if (m_free.empty())
+            {
+                slot = uint32(m_steps.size());
+                m_steps.push_back(Step(action));
+            }
+            else
+            {
+                slot = m_free.back();
+                m_free.pop_back();
+                m_steps[slot].action = action;
+            }
+
+            std::vector<uint32>& filed = m_byScript[ScriptKey(action)];
+            m_steps[slot].filedAt = uint32(filed.size());
+            m_steps[slot].live = true;
+            filed.push_back(slot);
+
+            m_buckets[due].slots.push_back(slot);
+
+            ++m_size;
+            ++m_stats.scheduled;
+            if (m_size > m_stats.peak)
+            {
+                m_stats.peak = uint32(m_size);
+            }
+        }
+
+        /**
+         * @brief Takes the next step due at or before `now` off the queue.
+         *
+         * Steps come out in the order of their due time and, within one second, in
+         * the order they were scheduled. A step scheduled while the queue is being
+         * drained comes out in the same drain if it is already due.
+         *
+         * @return the step, or nothing if nothing is due
+         */
+        std::optional<ACTION> Next(time_t now)
+        {
+            while (!m_buckets.empty())
+            {
+                typename BucketMap::iterator bucket = m_buckets.begin();
+                if (bucket->first > now)
+                {
+                    return std::nullopt;
+                }
+
+                // the bucket may grow while it is drained; read it by index
+                Bucket& due = bucket->second;
+                while (due.read < due.slots.size())
+                {
+                    uint32 slot = due.slots[due.read++];
+                    Step& step = m_steps[slot];
+                    if (step.live)
+                    {
+                        std::optional<ACTION> action(step.action);
+
+                        typename ScriptMap::iterator filed = m_byScript.find(ScriptKey(step.action));
+                        Unfile(filed->second, slot);
+                        if (filed->second.empty())
+                        {
+                            m_byScript.erase(filed);
+                        }
+
+                        m_free.push_back(slot);
+                        --m_size;
+                        ++m_stats.run;
+                        return action;
+                    }
+
+                    // cancelled earlier: its slot can be used again now
+                    m_free.push_back(slot);
+                }
+
+                m_buckets.erase(bucket);
+            }
+
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Drops every queued step of script (type, id) that `match` accepts.
+         *
+         * @return how many steps were dropped
+         */
+        template<class PRED>
+        uint32 Cancel(uint32 type, uint32 id, PRED match)
+        {
+            typename ScriptMap::iterator filed = m_byScript.find(ScriptKey(type, id));
+            if (filed == m_byScript.end())
+            {
+                return 0;
+            }
+
+            uint32 cancelled = 0;
+            std::vector<uint32>& slots = filed->second;
+            for (uint32 i = 0; i < slots.size();)
+            {
+                uint32 slot = slots[i];
+                if (match(m_steps[slot].action))
+                {
+                    Unfile(slots, slot);                    // moves the last one into i
+                    --m_size;
+                    ++cancelled;
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+
+            if (slots.empty())
+            {
+                m_byScript.erase(filed);
+            }
+
+            m_stats.cancelled += cancelled;
+            return cancelled;
+        }
+
+        /// True if a queued step of script (type, id) is accepted by `match`.
+        template<class PRED>
+        bool Any(uint32 type, uint32 id, PRED match) const
+        {
+            typename ScriptMap::const_iterator filed = m_byScript.find(ScriptKey(type, id));
+            if (filed == m_byScript.end())
+            {
+                return false;
+            }
+
+            for (uint32 slot : filed->second)
+            {
+                if (match(m_steps[slot].action))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        struct Step
+        {
+            explicit Step(ACTION const& action_) : action(action_), filedAt(0), live(false) {}
+
+            ACTION action;
+            uint32 filedAt;                                 // index in its script's list
+            bool live;                                      // false once run or cancelled
+        };
+
+        struct Bucket
+        {
+            Bucket() : read(0) {}
+
+            std::vector<uint32> slots;                      // in scheduling order
+            size_t read;                                    // how far Next() has got
+        };
+
+        typedef std::map<time_t, Bucket> BucketMap;
+        typedef std::unordered_map<uint64, std::vector<uint32> > ScriptMap;
+
+        static uint64 ScriptKey(uint32 type, uint32 id) { return (uint64(type) << 32) | id; }
+        static uint64 ScriptKey(ACTION const& action) { return ScriptKey(uint32(action.GetType()), action.GetId()); }
+
+        /// Takes a live step off its script's list; the last one on the list takes its place.
+        void Unfile(std::vector<uint32>& slots, uint32 slot)
+        {
+            Step& step = m_steps[slot];
+            uint32 last = slots.back();
+            slots[step.filedAt] = last;
+            m_steps[last].filedAt = step.filedAt;
+            slots.pop_back();
+            step.live = false;
+        }
+
+        std::vector<Step> m_steps;
+        std::vector<uint32> m_free;                         // slots neither queued nor in a bucket
+        BucketMap m_buckets;                                // by due second
+        ScriptMap m_byScript;                               // live slots by (type, id)
+        size_t m_size;
+        Stats m_stats;
+};
+
+#endif
@@ -878,14 +878,18 @@ namespace MaNGOS
         float i_centerX;
         float i_centerY;
         float i_centerZ;
+        float i_centerExtent;
 
         float GetCenterX() const { return i_centerX; }
         float GetCenterY() const { return i_centerY; }
+        float GetCenterZ() const { return i_centerZ; }
+        /// How far the tests below reach past i_radius on the centre's side.
+        float GetCenterExtent() const { return i_centerExtent; }
 
         SpellNotifierCreatureAndPlayer(Spell& spell, Spell::UnitList& data, float radius, SpellNotifyPushType type,
                                        SpellTargets TargetType = SPELL_TARGETS_NOT_FRIENDLY, WorldObject* originalCaster = NULL)
             : i_data(&data), i_spell(spell), i_push_type(type), i_radius(radius), i_TargetType(TargetType),
-              i_originalCaster(originalCaster), i_castingObject(i_spell.GetCastingObject())
+              i_originalCaster(originalCaster), i_castingObject(i_spell.GetCastingObject()), i_centerZ(0.0f), i_centerExtent(0.0f)
         {
             if (!i_originalCaster)
             {
@@ -905,6 +909,8 @@ namespace MaNGOS
                     {
                         i_centerX = i_castingObject->Where().X();
                         i_centerY = i_castingObject->Where().Y();
+                        i_centerZ = i_castingObject->Where().Z();
+                        i_centerExtent = i_castingObject->Where().Extent();
                     }
                     break;
                 case PUSH_DEST_CENTER:
@@ -922,6 +928,8 @@ namespace MaNGOS
                     {
                         i_centerX = target->Where().X();
                         i_centerY = target->Where().Y();
+                        i_centerZ = target->Where().Z();
+                        i_centerExtent = target->Where().Extent();
                     }
                     break;
                 default:
@@ -930,6 +938,16 @@ namespace MaNGOS
         }
 
         template<class T> inline void Visit(GridRefManager<T>&  m)
+        {
+            for (typename GridRefManager<T>::iterator itr = m.begin(); itr != m.end(); ++itr)
+            {
+                Consider(itr->getSource());
+            }
+        }
+
+        /// Pushes `target` if it passes the tests; Visit asks this of every unit in a
+        /// cell, Spell::FillAreaTargets of the candidates Map::SelectUnitCandidates found.
+        void Consider(Unit* target)
         {
             MANGOS_ASSERT(i_data);
 
@@ -938,123 +956,120 @@ namespace MaNGOS
                 return;
             }
 
-            for (typename GridRefManager<T>::iterator itr = m.begin(); itr != m.end(); ++itr)
+            // there are still more spells which can be casted on dead, but
+            // they are no AOE and don't have such a nice SPELL_ATTR flag
+            if ((i_TargetType != SPELL_TARGETS_ALL && !target->IsTargetableForAttack(i_spell.m_spellInfo->HasAttribute(SPELL_ATTR_EX3_CAST_ON_DEAD)))
+                // mostly phase check
+                || !target->Where().ShareFrame(i_originalCaster->Where()))
+            {
+                return;
+            }
+
+            switch (i_TargetType)
             {
-                // there are still more spells which can be casted on dead, but
-                // they are no AOE and don't have such a nice SPELL_ATTR flag
-                if ((i_TargetType != SPELL_TARGETS_ALL && !itr->getSource()->IsTargetableForAttack(i_spell.m_spellInfo->HasAttribute(SPELL_ATTR_EX3_CAST_ON_DEAD)))
-                    // mostly phase check
-                    || !itr->getSource()->Where().ShareFrame(i_originalCaster->Where()))
+                case SPELL_TARGETS_HOSTILE:
+                    if (!i_originalCaster->IsHostileTo(target))
                     {
-                        continue;
+                        return;
                     }
-
-                switch (i_TargetType)
+                    break;
+                case SPELL_TARGETS_NOT_FRIENDLY:
+                    if (i_originalCaster->IsFriendlyTo(target))
+                    {
+                        return;
+                    }
+                    break;
+                case SPELL_TARGETS_NOT_HOSTILE:
+                    if (i_originalCaster->IsHostileTo(target))
+                    {
+                        return;
+                    }
+                    break;
+                case SPELL_TARGETS_FRIENDLY:
+                    if (!i_originalCaster->IsFriendlyTo(target))
+                    {
+                        return;
+                    }
+                    break;
+                case SPELL_TARGETS_AOE_DAMAGE:
                 {
-                    case SPELL_TARGETS_HOSTILE:
-                        if (!i_originalCaster->IsHostileTo(itr->getSource()))
-                        {
-                            continue;
-                        }
-                        break;
-                    case SPELL_TARGETS_NOT_FRIENDLY:
-                        if (i_originalCaster->IsFriendlyTo(itr->getSource()))
-                        {
-                            continue;
-                        }
-                        break;
-                    case SPELL_TARGETS_NOT_HOSTILE:
-                        if (i_originalCaster->IsHostileTo(itr->getSource()))
-                        {
-                            continue;
-                        }
-                        break;
-                    case SPELL_TARGETS_FRIENDLY:
-                        if (!i_originalCaster->IsFriendlyTo(itr->getSource()))
-                        {
-                            continue;
-                        }
-                        break;
-                    case SPELL_TARGETS_AOE_DAMAGE:
+                    if (target->GetTypeId() == TYPEID_UNIT && ((Creature*)target)->IsTotem())
                     {
-                        if (itr->getSource()->GetTypeId() == TYPEID_UNIT && ((Creature*)itr->getSource())->IsTotem())
-                        {
-                            continue;
-                        }
+                        return;
+                    }
 
-                        if (i_playerControlled)
+                    if (i_playerControlled)
+                    {
+                        if (i_originalCaster->IsFriendlyTo(target))
                         {
-                            if (i_originalCaster->IsFriendlyTo(itr->getSource()))
-                            {
-                                continue;
-                            }
+                            return;
                         }
-                        else
+                    }
+                    else
+                    {
+                        if (!i_originalCaster->IsHostileTo(target))
                         {
-                            if (!i_originalCaster->IsHostileTo(itr->getSource()))
-                            {
-                                continue;
-                            }
+                            return;
                         }
                     }
-                    break;
-                    case SPELL_TARGETS_ALL:
-                        break;
-                    default: continue;
                 }
+                break;
+                case SPELL_TARGETS_ALL:
+                    break;
+                default: return;
+            }
 
-                // we don't need to check InMap here, it's already done some lines above
-                switch (i_push_type)
-                {
-                    case PUSH_IN_FRONT:
-                        if (InFrontPhased(*i_castingObject, *((Unit*)(itr->getSource())), i_radius, 2 * M_PI_F / 3))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_IN_FRONT_90:
-                        if (InFrontPhased(*i_castingObject, *((Unit*)(itr->getSource())), i_radius, M_PI_F / 2))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_IN_FRONT_30:
-                        if (InFrontPhased(*i_castingObject, *((Unit*)(itr->getSource())), i_radius, M_PI_F / 6))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_IN_FRONT_15:
-                        if (InFrontPhased(*i_castingObject, *((Unit*)(itr->getSource())), i_radius, M_PI_F / 12))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_IN_BACK:
-                        if (InBackPhased(*i_castingObject, *((Unit*)(itr->getSource())), i_radius, 2 * M_PI_F / 3))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_SELF_CENTER:
-                        if (i_castingObject->Where().WithinDist(((Unit*)(itr->getSource()))->Where(), i_radius))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_DEST_CENTER:
-                        if (itr->getSource()->Where().WithinDist(Geometry::Vector3(i_centerX, i_centerY, i_centerZ), i_radius))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                    case PUSH_TARGET_CENTER:
-                        if (i_spell.m_targets.getUnitTarget() && i_spell.m_targets.getUnitTarget()->Where().WithinDist(((Unit*)(itr->getSource()))->Where(), i_radius))
-                        {
-                            i_data->push_back(itr->getSource());
-                        }
-                        break;
-                }
+            // we don't need to check InMap here, it's already done some lines above
+            switch (i_push_type)
+            {
+                case PUSH_IN_FRONT:
+                    if (InFrontPhased(*i_castingObject, *target, i_radius, 2 * M_PI_F / 3))
+                    {
+                        i_data->push_back(target);
+                    }
+                    break;
+                case PUSH_IN_FRONT_90:
+                    if (InFrontPhased(*i_castingObject, *target, i_radius, M_PI_F / 2))
+                    {
+                        i_data->push_back(target);
+                    }
+                    break;
+                case PUSH_IN_FRONT_30:
+                    if (InFrontPhased(*i_castingObject, *target, i_radius, M_PI_F / 6))
+                    {
+                        i_data->push_back(target);
+                    }
+                    break;
+                case PUSH_IN_FRONT_15:
+                    if (InFrontPhased(*i_castingObject, *target, i_radius, M_PI_F / 12))
+                    {
+                        i_data->push_back(target);
+                    }
+                    break;
+                case PUSH_IN_BACK:
+                    if (InBackPhased(*i_castingObject, *target, i_radius, 2 * M_PI_F / 3))
+                    {
+                        i_data->push_back(target);
+                    }
+                    break;
+                case PUSH_SELF_CENTER:
+                    if (i_castingObject->Where().WithinDist(target->Where(), i_radius))
+                    {
+                        i_data->push_back(target);
+                    }
+                    break;
+                case PUSH_DEST_CENTER:
+                    if (target->Where().WithinDist(Geometry::Vector3(i_centerX, i_centerY, i_centerZ), i_radius))
+                    {
+                        i_data->push_back(target);
+                    }
+                    break;
+                case PUSH_TARGET_CENTER:
+                    if (i_spell.m_targets.getUnitTarget() && i_spell.m_targets.getUnitTarget()->Where().WithinDist(target->Where(), i_radius))
+                    {
+                        i_data->push_back(target);
+                    }
+                    break;
             }
         }
 
@@ -144,7 +144,18 @@ typedef std::priority_queue<PrioritizeHealthUnitWraper, std::vector<PrioritizeHe
 void Spell::FillAreaTargets(UnitList& targetUnitMap, float radius, SpellNotifyPushType pushType, SpellTargets spellTargets, WorldObject* originalCaster /*=NULL*/)
 {
     MaNGOS::SpellNotifierCreatureAndPlayer notifier(*this, targetUnitMap, radius, pushType, spellTargets, originalCaster);
-    Cell::VisitAllObjects(notifier.GetCenterX(), notifier.GetCenterY(), m_caster->GetMap(), notifier, radius);
+
+    // The cells' spatial indexes say from packed positions which units can be in reach;
+    // only those are asked what the notifier asks. A hair over the reach, so that
+    // rounding cannot drop a unit the notifier's own distance test would keep.
+    std::vector<Unit*> candidates;
+    float reach = radius + notifier.GetCenterExtent() + 0.01f;
+    m_caster->GetMap()->SelectUnitCandidates(notifier.GetCenterX(), notifier.GetCenterY(), notifier.GetCenterZ(), reach, TYPEMASK_UNIT, candidates);
+
+    for (std::vector<Unit*>::const_iterator itr = candidates.begin(); itr != candidates.end(); ++itr)
+    {
+        notifier.Consider(*itr);
+    }
 }
 
 /**
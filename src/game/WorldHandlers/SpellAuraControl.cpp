@@ -996,7 +996,7 @@ void Aura::HandleModThreat(bool apply, bool Real)
 
     if (level_diff > 0)
     {
-        m_modifier.m_amount += multiplier * level_diff;
+        ChangeAmount(m_modifier.m_amount + (multiplier * level_diff), false);
     }
 
     if (target->GetTypeId() == TYPEID_PLAYER)
@@ -1190,7 +1190,7 @@ void Aura::HandleAuraModIncreaseFlightSpeed(bool apply, bool Real)
                         int32 mountSpeed = spellInfo->CalculateSimpleValue(SpellEffectIndex(i));
                         if (mountSpeed > m_modifier.m_amount)
                         {
-                            m_modifier.m_amount = mountSpeed;
+                            ChangeAmount(mountSpeed, false);
                             changedSpeed = true;
                             break;
                         }
@@ -754,7 +754,7 @@ void Aura::HandleSchoolAbsorb(bool apply, bool Real)
 
             DoneActualBenefit *= caster->CalculateLevelPenalty(GetSpellProto());
 
-            m_modifier.m_amount += (int32)DoneActualBenefit;
+            ChangeAmount(m_modifier.m_amount + (int32)DoneActualBenefit, false);
         }
     }
     else
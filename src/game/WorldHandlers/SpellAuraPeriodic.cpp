@@ -234,7 +234,7 @@ void Aura::HandlePeriodicEnergize(bool apply, bool Real)
             {
                 if (Unit* caster = GetCaster())
                 {
-                    m_modifier.m_amount = int32(caster->GetCreateMana() * GetBasePoints() / (200 * GetAuraMaxTicks()));
+                    ChangeAmount(int32(caster->GetCreateMana() * GetBasePoints() / (200 * GetAuraMaxTicks())), false);
                 }
                 break;
             }
@@ -248,16 +248,16 @@ void Aura::HandlePeriodicEnergize(bool apply, bool Real)
                         caster->CastSpell(caster, 54833, true, NULL, this);
                     }
 
-                    m_modifier.m_amount = int32(caster->GetCreateMana() * GetBasePoints() / (100 * GetAuraMaxTicks()));
+                    ChangeAmount(int32(caster->GetCreateMana() * GetBasePoints() / (100 * GetAuraMaxTicks())), false);
                 }
                 break;
             }
             case 48391:                                     // Owlkin Frenzy 2% base mana
-                m_modifier.m_amount = target->GetCreateMana() * 2 / 100;
+                ChangeAmount(target->GetCreateMana() * 2 / 100, false);
                 break;
             case 57669:                                     // Replenishment (0.2% from max)
             case 61782:                                     // Infinite Replenishment
-                m_modifier.m_amount = target->GetMaxPower(POWER_MANA) * 2 / 1000;
+                ChangeAmount(target->GetMaxPower(POWER_MANA) * 2 / 1000, false);
                 break;
             default:
                 break;
@@ -325,7 +325,7 @@ void Aura::HandleAuraPeriodicDummy(bool apply, bool Real)
             // Explosive Shot
             if (apply && !loading && caster)
             {
-                m_modifier.m_amount += int32(caster->GetTotalAttackPowerValue(RANGED_ATTACK) * 14 / 100);
+                ChangeAmount(m_modifier.m_amount + (int32(caster->GetTotalAttackPowerValue(RANGED_ATTACK) * 14 / 100)), false);
             }
             break;
         }
@@ -373,16 +373,16 @@ void Aura::HandlePeriodicHeal(bool apply, bool /*Real*/)
                 holy = 0;
             }
             holy = int32(holy * 377 / 1000);
-            m_modifier.m_amount += ap > holy ? ap : holy;
+            ChangeAmount(m_modifier.m_amount + (ap > holy ? ap : holy), false);
         }
         // Lifeblood
         else if (GetSpellProto()->SpellIconID == 3088 && GetSpellProto()->SpellVisualID[0] == 8145)
         {
             int32 healthBonus = int32(0.0032f * caster->GetMaxHealth());
-            m_modifier.m_amount += healthBonus;
+            ChangeAmount(m_modifier.m_amount + healthBonus, false);
         }
 
-        m_modifier.m_amount = caster->SpellHealingBonusDone(target, GetSpellProto(), m_modifier.m_amount, DOT, GetStackAmount());
+        ChangeAmount(caster->SpellHealingBonusDone(target, GetSpellProto(), m_modifier.m_amount, DOT, GetStackAmount()), false);
 
         // Rejuvenation
         if (GetSpellProto()->IsFitToFamily(SPELLFAMILY_DRUID, UI64LIT(0x0000000000000010)))
@@ -421,7 +421,7 @@ void Aura::HandleDamagePercentTaken(bool apply, bool Real)
             if (target->GetObjectGuid() == GetCasterGuid())
                 if (Aura* aur = target->GetAura(63225, EFFECT_INDEX_0))
                 {
-                    m_modifier.m_amount -= aur->GetModifier()->m_amount;
+                    ChangeAmount(m_modifier.m_amount - aur->GetModifier()->m_amount, false);
                 }
         }
     }
@@ -481,11 +481,11 @@ void Aura::HandlePeriodicDamage(bool apply, bool Real)
                     int32 mws = caster->GetAttackTime(BASE_ATTACK);
                     float mwb_min = caster->GetWeaponDamageRange(BASE_ATTACK, MINDAMAGE);
                     float mwb_max = caster->GetWeaponDamageRange(BASE_ATTACK, MAXDAMAGE);
-                    m_modifier.m_amount += int32(((mwb_min + mwb_max) / 2 + ap * mws / 14000) * 0.2f);
+                    ChangeAmount(m_modifier.m_amount + (int32(((mwb_min + mwb_max) / 2 + ap * mws / 14000) * 0.2f)), false);
                     // If used while target is above 75% health, Rend does 35% more damage
                     if (spellProto->CalculateSimpleValue(EFFECT_INDEX_1) != 0 &&
                             target->GetHealth() > target->GetMaxHealth() * spellProto->CalculateSimpleValue(EFFECT_INDEX_1) / 100)
-                        m_modifier.m_amount += m_modifier.m_amount * spellProto->CalculateSimpleValue(EFFECT_INDEX_2) / 100;
+                        ChangeAmount(m_modifier.m_amount + (m_modifier.m_amount * spellProto->CalculateSimpleValue(EFFECT_INDEX_2) / 100), false);
                 }
                 break;
             }
@@ -508,11 +508,11 @@ void Aura::HandlePeriodicDamage(bool apply, bool Real)
                     {
                         if ((*itr)->GetId() == 34241)
                         {
-                            m_modifier.m_amount += cp * (*itr)->GetModifier()->m_amount;
+                            ChangeAmount(m_modifier.m_amount + (cp * (*itr)->GetModifier()->m_amount), false);
                             break;
                         }
                     }
-                    m_modifier.m_amount += int32(caster->GetTotalAttackPowerValue(BASE_ATTACK) * cp / 100);
+                    ChangeAmount(m_modifier.m_amount + (int32(caster->GetTotalAttackPowerValue(BASE_ATTACK) * cp / 100)), false);
                 }
                 break;
             }
@@ -534,7 +534,7 @@ void Aura::HandlePeriodicDamage(bool apply, bool Real)
                     uint8 cp = ((Player*)caster)->GetComboPoints();
                     if (cp > 5) cp = 5;
                     {
-                        m_modifier.m_amount += int32(caster->GetTotalAttackPowerValue(BASE_ATTACK) * AP_per_combo[cp]);
+                        ChangeAmount(m_modifier.m_amount + (int32(caster->GetTotalAttackPowerValue(BASE_ATTACK) * AP_per_combo[cp])), false);
                     }
                 }
                 break;
@@ -551,7 +551,7 @@ void Aura::HandlePeriodicDamage(bool apply, bool Real)
                     {
                         holy = 0;
                     }
-                    m_modifier.m_amount += int32(GetStackAmount()) * (int32(ap * 0.025f) + int32(holy * 13 / 1000));
+                    ChangeAmount(m_modifier.m_amount + (int32(GetStackAmount()) * (int32(ap * 0.025f) + int32(holy * 13 / 1000))), false);
                 }
                 break;
             }
@@ -565,13 +565,13 @@ void Aura::HandlePeriodicDamage(bool apply, bool Real)
             uint32 dmgClass = spellProto->GetDmgClass();
             if (dmgClass == SPELL_DAMAGE_CLASS_NONE || dmgClass == SPELL_DAMAGE_CLASS_MAGIC)
             {
-                m_modifier.m_amount = caster->SpellDamageBonusDone(target, GetSpellProto(), m_modifier.m_amount, DOT, GetStackAmount());
+                ChangeAmount(caster->SpellDamageBonusDone(target, GetSpellProto(), m_modifier.m_amount, DOT, GetStackAmount()), false);
             }
             // MeleeDamagebonusDone for weapon based spells
             else
             {
                 WeaponAttackType attackType = GetWeaponAttackType(GetSpellProto());
-                m_modifier.m_amount = caster->MeleeDamageBonusDone(target, m_modifier.m_amount, attackType, GetSpellProto(), DOT, GetStackAmount());
+                ChangeAmount(caster->MeleeDamageBonusDone(target, m_modifier.m_amount, attackType, GetSpellProto(), DOT, GetStackAmount()), false);
             }
         }
     }
@@ -624,7 +624,7 @@ void Aura::HandlePeriodicLeech(bool apply, bool /*Real*/)
             return;
         }
 
-        m_modifier.m_amount = caster->SpellDamageBonusDone(GetTarget(), GetSpellProto(), m_modifier.m_amount, DOT, GetStackAmount());
+        ChangeAmount(caster->SpellDamageBonusDone(GetTarget(), GetSpellProto(), m_modifier.m_amount, DOT, GetStackAmount()), false);
     }
 }
 
@@ -666,7 +666,7 @@ void Aura::HandlePeriodicHealthFunnel(bool apply, bool /*Real*/)
             return;
         }
 
-        m_modifier.m_amount = caster->SpellDamageBonusDone(GetTarget(), GetSpellProto(), m_modifier.m_amount, DOT, GetStackAmount());
+        ChangeAmount(caster->SpellDamageBonusDone(GetTarget(), GetSpellProto(), m_modifier.m_amount, DOT, GetStackAmount()), false);
     }
 }
 
@@ -1155,7 +1155,7 @@ void Aura::HandleAuraModIncreaseHealth(bool apply, bool Real)
         case 61254:                                         // Will of Sartharion (Obsidian Sanctum)
             if (Real && apply)
             {
-                m_modifier.m_amount = target->GetMaxHealth() * m_modifier.m_amount / 100;
+                ChangeAmount(target->GetMaxHealth() * m_modifier.m_amount / 100, false);
             }
             // no break here
 
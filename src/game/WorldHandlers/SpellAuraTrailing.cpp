@@ -142,7 +142,7 @@ void Aura::HandleManaShield(bool apply, bool Real)
 
             DoneActualBenefit *= caster->CalculateLevelPenalty(GetSpellProto());
 
-            m_modifier.m_amount += (int32)DoneActualBenefit;
+            ChangeAmount(m_modifier.m_amount + (int32)DoneActualBenefit, false);
         }
     }
 }
@@ -712,6 +712,23 @@ void Aura::SetModifier(AuraType t, int32 a, uint32 pt, int32 miscValue)
     m_modifier.periodictime = pt;
 }
 
+/**
+ * @brief Changes the modifier amount in place.
+ *
+ * @param amount The new amount.
+ * @param update True to send the updated aura to the client.
+ */
+void Aura::ChangeAmount(int32 amount, bool update)
+{
+    m_modifier.m_amount = amount;
+    GetTarget()->InvalidateAuraModifierTotals(m_modifier.m_auraname);
+
+    if (update)
+    {
+        GetHolder()->SendAuraUpdate(false);
+    }
+}
+
 /**
  * @brief Updates periodic aura timing and triggers ticks when due.
  *
@@ -2157,7 +2174,7 @@ void Aura::TriggerSpell()
                         // Reset reapply counter at move
                         if (((Player*)triggerTarget)->isMoving())
                         {
-                            m_modifier.m_amount = 6;
+                            ChangeAmount(6, false);
                             return;
                         }
 
@@ -3805,7 +3822,7 @@ void Aura::PeriodicDummyTick()
                 // Search SPELL_AURA_MOD_POWER_REGEN aura for this spell and add bonus
                 if (Aura* aura = GetHolder()->GetAuraByEffectIndex(SpellEffectIndex(GetEffIndex() - 1)))
                 {
-                    aura->GetModifier()->m_amount = m_modifier.m_amount;
+                    aura->ChangeAmount(m_modifier.m_amount, false);
                     ((Player*)target)->UpdateManaRegen();
                     // Disable continue
                     m_isPeriodic = false;
@@ -3995,8 +4012,7 @@ void Aura::PeriodicDummyTick()
                 {
                     slow->ApplyModifier(false, true);
                     Modifier* mod = slow->GetModifier();
-                    mod->m_amount += m_modifier.m_amount;
-                    if (mod->m_amount > 0) mod->m_amount = 0;
+                    slow->ChangeAmount(std::min(mod->m_amount + m_modifier.m_amount, 0), false);
                     {
                         slow->ApplyModifier(true, true);
                     }
@@ -4654,7 +4670,7 @@ void SpellAuraHolder::SetStackAmount(uint32 stackAmount)
                 if (amount != aur->GetModifier()->m_amount)
                 {
                     aur->ApplyModifier(false, true);
-                    aur->GetModifier()->m_amount = amount;
+                    aur->ChangeAmount(amount, false);
                     aur->ApplyModifier(true, true);
                 }
             }
@@ -480,7 +480,7 @@ class  Aura
 
         void SetLoadedState(int32 damage, uint32 periodicTime)
         {
-            m_modifier.m_amount = damage;
+            ChangeAmount(damage, false);
             m_modifier.periodictime = periodicTime;
 
             if (uint32 maxticks = GetAuraMaxTicks())
@@ -510,14 +510,16 @@ class  Aura
             }
         }
         void ApplyModifier(bool apply, bool Real = false);
-        void ChangeAmount(int32 amount, bool update = true)
-        {
-            m_modifier.m_amount = amount;
-            if (update)
-            {
-                GetHolder()->SendAuraUpdate(false);
-            }
-        }
+        /**
+         * @brief Change the modifier amount of an aura that may already be applied.
+         *
+         * The target caches per-type totals of its modifiers, so after construction
+         * the amount must only ever be changed through here.
+         *
+         * @param amount the new amount
+         * @param update send the changed aura to the client
+         */
+        void ChangeAmount(int32 amount, bool update = true);
 
         void UpdateAura(uint32 diff) { SetInUse(true); Update(diff); SetInUse(false); }
 
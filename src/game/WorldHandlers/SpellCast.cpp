@@ -132,6 +132,7 @@ void Spell::SpellStart(SpellCastTargets const* targets, Aura* triggeredByAura)
     // create and add update event for this spell
     SpellEvent* Event = new SpellEvent(this);
     m_caster->m_Events.AddEvent(Event, m_caster->m_Events.CalculateTime(1));
+    m_caster->WakeUpdateCell();
 
     // Prevent casting at cast another spell (ServerSide check)
     if (m_caster->IsNonMeleeSpellCasted(false, true, true) && m_cast_count)
@@ -260,7 +260,7 @@ void Spell::DoAllEffectOnTarget(TargetInfo* target)
         {
             if (Aura* dummy = unitTarget->GetDummyAura(m_spellInfo->ID))
             {
-                dummy->GetModifier()->m_amount = damageInfo.damage;
+                dummy->ChangeAmount(damageInfo.damage, false);
             }
         }
 
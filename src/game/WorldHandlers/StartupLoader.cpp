@@ -0,0 +1,263 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file StartupLoader.cpp
+ * @brief Dependency-ordered, optionally parallel execution of startup loaders.
+ */
+
+#include "StartupLoader.h"
+
+#include "Database/DatabaseEnv.h"
+#include "Log.h"
+#include "Utilities/Errors.h"
+#include "ProgressBar.h"
+#include "Timer.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/// Stages listed by name in the startup report; the rest only at detail level.
+static const size_t REPORT_SLOWEST_STAGES = 10;
+
+void StartupLoader::Add(char const* name, Step step, std::initializer_list<char const*> after)
+{
+    Stage stage;
+    stage.name = name;
+    stage.step = step;
+    stage.ms = 0;
+
+    for (char const* prerequisite : after)
+    {
+        size_t index = Find(prerequisite);
+        // a typo here would silently drop an ordering the loaders rely on
+        MANGOS_ASSERT(index < m_stages.size());
+        stage.after.push_back(index);
+        m_stages[index].before.push_back(m_stages.size());
+    }
+
+    m_stages.push_back(stage);
+}
+
+size_t StartupLoader::Find(char const* name) const
+{
+    for (size_t i = 0; i < m_stages.size(); ++i)
+    {
+        if (m_stages[i].name == name)
+        {
+            return i;
+        }
+    }
+
+    return m_stages.size();
+}
+
+void StartupLoader::RunStage(Stage& stage)
+{
+    sLog.outString("Loading %s...", stage.name.c_str());
+
+    uint32 begin = getMSTime();
+    stage.step();
+    stage.ms = GetMSTimeDiffToNow(begin);
+}
+
+void StartupLoader::Run(uint32 threads, Database* db)
+{
+    m_threads = std::max<uint32>(1, std::min<uint32>(threads, m_stages.size()));
+
+    uint32 begin = getMSTime();
+
+    if (m_threads == 1)
+    {
+        for (Stage& stage : m_stages)
+        {
+            RunStage(stage);
+        }
+    }
+    else
+    {
+        RunParallel(m_threads, db);
+    }
+
+    m_wallMs = GetMSTimeDiffToNow(begin);
+}
+
+void StartupLoader::RunParallel(uint32 threads, Database* db)
+{
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<size_t> ready;
+    std::vector<size_t> waitingOn(m_stages.size());
+    size_t done = 0;
+
+    for (size_t i = 0; i < m_stages.size(); ++i)
+    {
+        waitingOn[i] = m_stages[i].after.size();
+        if (!waitingOn[i])
+        {
+            ready.push_back(i);
+        }
+    }
+
+    // Several bars redrawing the same console line at once are unreadable; the
+    // per-stage log lines and the report below say the same thing.
+    bool bars = BarGoLink::GetOutputState();
+    BarGoLink::SetOutputState(false);
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (uint32 t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&]
+        {
+            // loaders query the databases from here, so this is a client thread
+            DbThreadGuard dbThread(db);
+
+            std::unique_lock<std::mutex> guard(mutex);
+            for (;;)
+            {
+                changed.wait(guard, [&] { return !ready.empty() || done == m_stages.size(); });
+                if (ready.empty())
+                {
+                    return;
+                }
+
+                size_t index = ready.front();
+                ready.pop_front();
+
+                guard.unlock();
+                RunStage(m_stages[index]);
+                guard.lock();
+
+                ++done;
+                for (size_t next : m_stages[index].before)
+                {
+                    if (!--waitingOn[next])
+                    {
+                        ready.push_back(next);
+                    }
+                }
+                changed.notify_all();
+            }
+        });
+    }
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    BarGoLink::SetOutputState(bars);
+}
+
+std::vector<StartupLoader::StageTiming> StartupLoader::GetTimings() const
+{
+    std::vector<StageTiming> timings(m_stages.size());
+
+    // prerequisites always come first, so one forward pass settles every path
+    for (size_t i = 0; i < m_stages.size(); ++i)
+    {
+        uint32 longest = 0;
+        for (size_t prerequisite : m_stages[i].after)
+        {
+            longest = std::max(longest, timings[prerequisite].pathMs);
+        }
+
+        timings[i].name = m_stages[i].name;
+        timings[i].ms = m_stages[i].ms;
+        timings[i].pathMs = longest + m_stages[i].ms;
+    }
+
+    return timings;
+}
+
+void StartupLoader::LogReport() const
+{
+    if (m_stages.empty())
+    {
+        return;
+    }
+
+    std::vector<StageTiming> timings = GetTimings();
+
+    uint32 total = 0;
+    size_t last = 0;
+    for (size_t i = 0; i < timings.size(); ++i)
+    {
+        total += timings[i].ms;
+        if (timings[i].pathMs >= timings[last].pathMs)
+        {
+            last = i;
+        }
+    }
+
+    sLog.outString();
+    sLog.outString(">> Startup loaders: %u stages in %u ms on %u thread(s); %u ms of loading, critical path %u ms",
+                   uint32(timings.size()), m_wallMs, m_threads, total, timings[last].pathMs);
+
+    std::vector<size_t> order(timings.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return timings[a].ms > timings[b].ms; });
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        StageTiming const& stage = timings[order[i]];
+        if (i < REPORT_SLOWEST_STAGES)
+        {
+            sLog.outString("   %6u ms  %s", stage.ms, stage.name.c_str());
+        }
+        else
+        {
+            sLog.outDetail("   %6u ms  %s", stage.ms, stage.name.c_str());
+        }
+    }
+
+    // walk the critical path back from its end: at each step, the prerequisite
+    // whose own path accounts for the rest
+    std::string path = timings[last].name;
+    for (size_t at = last; !m_stages[at].after.empty();)
+    {
+        size_t longest = m_stages[at].after.front();
+        for (size_t prerequisite : m_stages[at].after)
+        {
+            if (timings[prerequisite].pathMs > timings[longest].pathMs)
+            {
+                longest = prerequisite;
+            }
+        }
+
+        path = timings[longest].name + " > " + path;
+        at = longest;
+    }
+
+    sLog.outString(">> Critical path: %s", path.c_str());
+    sLog.outString();
+}
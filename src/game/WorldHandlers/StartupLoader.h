@@ -0,0 +1,117 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file StartupLoader.h
+ * @brief Runs the static-data loaders of World::SetInitialWorldSettings as a graph.
+ *
+ * Each loader is declared as a stage together with the stages it must follow --
+ * the "must be after ..." comments of the old sequence, made checkable. Stages
+ * whose prerequisites are done run side by side on a small pool of threads, each
+ * of which is registered as a database client thread. With one thread the stages
+ * run on the caller, in the order they were declared: the old sequence exactly.
+ *
+ * A stage may only name stages declared before it, so the declaration order is
+ * always a valid serial order and the graph cannot have a cycle.
+ */
+
+#ifndef MANGOS_H_STARTUPLOADER
+#define MANGOS_H_STARTUPLOADER
+
+#include "Platform/Define.h"
+
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+class Database;
+
+class StartupLoader
+{
+    public:
+        typedef std::function<void()> Step;
+
+        /// Time spent in one stage, as reported after Run().
+        struct StageTiming
+        {
+            std::string name;
+            uint32 ms;                                      ///< time in the stage itself
+            uint32 pathMs;                                  ///< longest chain of prerequisites ending with it
+        };
+
+        StartupLoader() : m_wallMs(0), m_threads(1) {}
+
+        StartupLoader(const StartupLoader&) = delete;
+        StartupLoader& operator=(const StartupLoader&) = delete;
+
+        /**
+         * @brief Declare a stage.
+         *
+         * @param name shown in the log as "Loading <name>..." and in the timing report
+         * @param step the loader itself
+         * @param after stages that must be complete before this one starts; each
+         *              must already have been added
+         */
+        void Add(char const* name, Step step, std::initializer_list<char const*> after = {});
+
+        /**
+         * @brief Run every stage and wait for all of them.
+         *
+         * @param threads worker count; 0 or 1 runs the stages in declaration order
+         *                on the calling thread
+         * @param db registered as a client of on every worker thread (may be NULL)
+         */
+        void Run(uint32 threads, Database* db);
+
+        /// Per-stage timings of the last Run(), in declaration order.
+        std::vector<StageTiming> GetTimings() const;
+
+        /// Wall-clock time of the last Run().
+        uint32 GetWallTime() const { return m_wallMs; }
+
+        /// Log the summary, the slowest stages and the critical path of the last Run().
+        void LogReport() const;
+
+    private:
+        struct Stage
+        {
+            std::string name;
+            Step step;
+            std::vector<size_t> after;                      ///< prerequisites, by index
+            std::vector<size_t> before;                     ///< stages waiting for this one
+            uint32 ms;
+        };
+
+        size_t Find(char const* name) const;
+        void RunStage(Stage& stage);
+        void RunParallel(uint32 threads, Database* db);
+
+        std::vector<Stage> m_stages;
+        uint32 m_wallMs;
+        uint32 m_threads;
+};
+
+#endif
@@ -1312,7 +1312,7 @@ SpellAuraProcResult Unit::HandleDummyAuraProc(Unit* pVictim, uint32 damage, Aura
                 Modifier* mod = counter->GetModifier();
                 if (procEx & PROC_EX_CRITICAL_HIT)
                 {
-                    mod->m_amount *= 2;
+                    counter->ChangeAmount(mod->m_amount * 2, false);
                     if (mod->m_amount < 100) // not enough
                     {
                         return SPELL_AURA_PROC_OK;
@@ -1323,7 +1323,7 @@ SpellAuraProcResult Unit::HandleDummyAuraProc(Unit* pVictim, uint32 damage, Aura
                         CastSpell(this, 48108, true, castItem, triggeredByAura);
                     }
                 }
-                mod->m_amount = 25;
+                counter->ChangeAmount(25, false);
                 return SPELL_AURA_PROC_OK;
             }
             // Burnout
@@ -1498,7 +1498,7 @@ SpellAuraProcResult Unit::HandleDummyAuraProc(Unit* pVictim, uint32 damage, Aura
                 }
 
                 // Damage counting
-                mod->m_amount -= damage;
+                triggeredByAura->ChangeAmount(mod->m_amount - damage, false);
                 return SPELL_AURA_PROC_OK;
             }
             // Seed of Corruption (Mobs cast) - no die req
@@ -1519,7 +1519,7 @@ SpellAuraProcResult Unit::HandleDummyAuraProc(Unit* pVictim, uint32 damage, Aura
                     return SPELL_AURA_PROC_OK;              // no hidden cooldown
                 }
                 // Damage counting
-                mod->m_amount -= damage;
+                triggeredByAura->ChangeAmount(mod->m_amount - damage, false);
                 return SPELL_AURA_PROC_OK;
             }
             // Fel Synergy
@@ -2728,7 +2728,7 @@ SpellAuraProcResult Unit::HandleDummyAuraProc(Unit* pVictim, uint32 damage, Aura
                         if (Aura* eff = existing->GetAuraByEffectIndex(EFFECT_INDEX_0))
                         {
                             int32 newAmount = std::min(cap, eff->GetModifier()->m_amount + shieldAmount);
-                            eff->GetModifier()->m_amount = newAmount;
+                            eff->ChangeAmount(newAmount, false);
                             existing->RefreshHolder();
                         }
                         return SPELL_AURA_PROC_OK;
@@ -105,7 +105,10 @@
 #include "CommandMgr.h"
 #include "GitRevision.h"
 #include "UpdateTime.h"
+#include "Trace.h"
 #include "GameTime.h"
+#include "StartupLoader.h"
+#include "Database/SQLStorageSnapshot.h"
 #include <cstdarg>
 
 #ifdef ENABLE_ELUNA
@@ -177,6 +180,8 @@ World::World(): mail_timer(0), mail_timer_expires(0), m_NextMonthlyQuestReset(0)
     m_startTime = m_gameTime;
     m_maxActiveSessionCount = 0;
     m_maxQueuedSessionCount = 0;
+    m_packetBufferAllocations = 0;
+    m_packetBufferAllocationsLastTick = 0;
     m_NextCurrencyReset = 0;
     m_NextDailyQuestReset = 0;
     m_NextWeeklyQuestReset = 0;
@@ -242,6 +247,9 @@ void World::CleanupsBeforeStop()
 {
     KickAll();                                       // save and kick all players
     UpdateSessions(1);                               // real players unload required UpdateSessions call
+#ifdef ENABLE_PLAYERBOTS
+    sRandomPlayerbotMgr.FlushEventValues();          // random bot state is written behind; send what is left
+#endif
     sBattleGroundMgr.DeleteAllBattleGrounds();       // unload battleground templates before different singletons destroyed
 }
 
@@ -267,6 +275,9 @@ void World::SetInitialWorldSettings()
     world::terrain::FusedTerrain::SetTileDir(m_dataPath + "tiles");
     world::terrain::GoModelStore::Instance().SetDirectory(m_dataPath + "gomodels");
 
+    ///- Static world tables are replayed from their snapshots when unchanged since the last start
+    SQLStorageSnapshot::SetDirectory(getConfig(CONFIG_BOOL_STATIC_TABLE_SNAPSHOTS) ? m_dataPath + "snapshots" : "");
+
     ///- Check the existence of the map files for all races start areas.
     if (!MapManager::ExistMapAndVMap(0, -6240.32f, 331.033f) ||                     // Dwarf/ Gnome
         !MapManager::ExistMapAndVMap(0, -8949.95f, -132.493f) ||                // Human
@@ -358,172 +369,68 @@ void World::SetInitialWorldSettings()
     }
 #endif /* ENABLE_ELUNA */
 
-    sLog.outString("Loading Page Texts...");
-    sObjectMgr.LoadPageTexts();
-
-    sLog.outString("Loading Game Object Templates...");     // must be after LoadPageTexts
-    sObjectMgr.LoadGameobjectInfo();
-
-    sLog.outString("Loading GameObject models...");
-    sLog.outString();
-
-    sLog.outString("Loading Spell Chain Data...");
-    sSpellMgr.LoadSpellChains();
-
-    sLog.outString("Loading Spell Elixir types...");
-    sSpellMgr.LoadSpellElixirs();
-
-    sLog.outString("Loading Spell Learn Skills...");
-    sSpellMgr.LoadSpellLearnSkills();                       // must be after LoadSpellChains
-
-    sLog.outString("Loading Spell Learn Spells...");
-    sSpellMgr.LoadSpellLearnSpells();
-
-    sLog.outString("Loading Spell Proc Event conditions...");
-    sSpellMgr.LoadSpellProcEvents();
-
-    sLog.outString("Loading Spell Bonus Data...");
-    sSpellMgr.LoadSpellBonuses();                           // must be after LoadSpellChains
-
-    sLog.outString("Loading Spell Proc Item Enchant...");
-    sSpellMgr.LoadSpellProcItemEnchant();                   // must be after LoadSpellChains
-
-    sLog.outString("Loading Aggro Spells Definitions...");
-    sSpellMgr.LoadSpellThreats();
-
-    sLog.outString("Loading NPC Texts...");
-    sObjectMgr.LoadGossipText();
-
-    sLog.outString("Loading Item Random Enchantments Table...");
-    LoadRandomEnchantmentsTable();
-
-    sLog.outString("Loading Disables...");                  // must be before loading quests and items
-    DisableMgr::LoadDisables();
-
-    sLog.outString("Loading Items...");                     // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr.LoadItemPrototypes();
-
-    sLog.outString("Loading Item converts...");             // must be after LoadItemPrototypes
-    sObjectMgr.LoadItemConverts();
-
-    sLog.outString("Loading Item expire converts...");      // must be after LoadItemPrototypes
-    sObjectMgr.LoadItemExpireConverts();
-
-    sLog.outString("Loading Creature Model Based Info Data...");
-    sObjectMgr.LoadCreatureModelInfo();
-
-    sLog.outString("Loading Equipment templates...");
-    sObjectMgr.LoadEquipmentTemplates();
-
-    sLog.outString("Loading Creature Stats...");
-    sObjectMgr.LoadCreatureClassLvlStats();
-
-    sLog.outString("Loading Creature templates...");
-    sObjectMgr.LoadCreatureTemplates();
-
-    sLog.outString("Loading Creature template spells...");
-    sObjectMgr.LoadCreatureTemplateSpells();
-
-    sLog.outString("Loading Creature Model for race...");   // must be after creature templates
-    sObjectMgr.LoadCreatureModelRace();
-
-    sLog.outString("Loading SpellsScriptTarget...");
-    sSpellMgr.LoadSpellScriptTarget();                      // must be after LoadCreatureTemplates and LoadGameobjectInfo
-
-    sLog.outString("Loading Vehicle Accessory...");         // must be after creature templates
-    sObjectMgr.LoadVehicleAccessory();
-
-    sLog.outString("Loading ItemRequiredTarget...");
-    sObjectMgr.LoadItemRequiredTarget();
-
-    sLog.outString("Loading Reputation Reward Rates...");
-    sObjectMgr.LoadReputationRewardRate();
-
-    sLog.outString("Loading Creature Reputation OnKill Data...");
-    sObjectMgr.LoadReputationOnKill();
-
-    sLog.outString("Loading Reputation Spillover Data...");
-    sObjectMgr.LoadReputationSpilloverTemplate();
-
-    sLog.outString("Loading Points Of Interest Data...");
-    sObjectMgr.LoadPointsOfInterest();
-
-    sLog.outString("Loading Creature Data...");
-    sObjectMgr.LoadCreatures();
-
-    sLog.outString("Loading pet levelup spells...");
-    sSpellMgr.LoadPetLevelupSpellMap();
-
-    sLog.outString("Loading pet default spell additional to levelup spells...");
-    sSpellMgr.LoadPetDefaultSpells();
-
-    sLog.outString("Loading Creature Addon Data...");
-    sObjectMgr.LoadCreatureAddons();                        // must be after LoadCreatureTemplates() and LoadCreatures()
-    sLog.outString(">>> Creature Addon Data loaded");
-    sLog.outString();
-
-    sLog.outString("Loading Gameobject Data...");
-    sObjectMgr.LoadGameObjects();
-
-    sLog.outString("Loading Gameobject Addon Data...");
-    sObjectMgr.LoadGameObjectAddon();
-
-    sLog.outString("Loading CreatureLinking Data...");      // must be after Creatures
-    sCreatureLinkingMgr.LoadFromDB();
-
-    sLog.outString("Loading Objects Pooling Data...");
-    sPoolMgr.LoadFromDB();
-
-    sLog.outString("Loading Weather Data...");
-    sWeatherMgr.LoadWeatherZoneChances();
-
-    sLog.outString("Loading Quests...");
-    sObjectMgr.LoadQuests();                                // must be loaded after DBCs, creature_template, item_template, gameobject tables
-
-    sLog.outString("Loading Quest POI");
-    sObjectMgr.LoadQuestPOI();
-
-    sLog.outString("Loading Quests Relations...");
-    sObjectMgr.LoadQuestRelations();                        // must be after quest load
-    sLog.outString(">>> Quests Relations loaded");
-    sLog.outString();
-
-    sLog.outString("Checking Quest Disables...");
-    DisableMgr::CheckQuestDisables();                       // must be after loading quests
-
-    sLog.outString("Loading Game Event Data...");           // must be after sPoolMgr.LoadFromDB and quests to properly load pool events and quests for events
-    sGameEventMgr.LoadFromDB();
-    sLog.outString(">>> Game Event Data loaded");
-    sLog.outString();
-
-    // Load Conditions
-    sLog.outString("Loading Conditions...");
-    sObjectMgr.LoadConditions();
-
-    sLog.outString("Creating map persistent states for non-instanceable maps...");     // must be after PackInstances(), LoadCreatures(), sPoolMgr.LoadFromDB(), sGameEventMgr.LoadFromDB();
-    sMapPersistentStateMgr.InitWorldMaps();
-    sLog.outString();
-
-    sLog.outString("Loading Creature Respawn Data...");     // must be after LoadCreatures(), and sMapPersistentStateMgr.InitWorldMaps()
-    sMapPersistentStateMgr.LoadCreatureRespawnTimes();
-
-    sLog.outString("Loading Gameobject Respawn Data...");   // must be after LoadGameObjects(), and sMapPersistentStateMgr.InitWorldMaps()
-    sMapPersistentStateMgr.LoadGameobjectRespawnTimes();
-
-    sLog.outString("Loading UNIT_NPC_FLAG_SPELLCLICK Data...");
-    sObjectMgr.LoadNPCSpellClickSpells();
-
-    sLog.outString("Loading SpellArea Data...");            // must be after quest load
-    sSpellMgr.LoadSpellAreas();
-
-    sLog.outString("Loading AreaTrigger definitions...");
-    sObjectMgr.LoadAreaTriggerTeleports();                  // must be after item template load
-
-    sLog.outString("Loading Quest Area Triggers...");
-    sObjectMgr.LoadQuestAreaTriggers();                     // must be after LoadQuests
-
-    sLog.outString("Loading Tavern Area Triggers...");
-    sObjectMgr.LoadTavernAreaTriggers();
+    ///- Load the static world data. Each loader names the ones it must follow; loaders
+    ///  whose prerequisites are done run side by side (StartupLoaderThreads).
+    StartupLoader loader;
+
+    loader.Add("Page Texts",                    [] { sObjectMgr.LoadPageTexts(); });
+    loader.Add("Game Object Templates",         [] { sObjectMgr.LoadGameobjectInfo(); },              { "Page Texts" });
+    loader.Add("Spell Chain Data",              [] { sSpellMgr.LoadSpellChains(); });
+    loader.Add("Spell Elixir types",            [] { sSpellMgr.LoadSpellElixirs(); });
+    loader.Add("Spell Learn Skills",            [] { sSpellMgr.LoadSpellLearnSkills(); },             { "Spell Chain Data" });
+    loader.Add("Spell Learn Spells",            [] { sSpellMgr.LoadSpellLearnSpells(); },             { "Spell Chain Data" });
+    loader.Add("Spell Proc Event conditions",   [] { sSpellMgr.LoadSpellProcEvents(); },              { "Spell Chain Data" });
+    loader.Add("Spell Bonus Data",              [] { sSpellMgr.LoadSpellBonuses(); },                 { "Spell Chain Data" });
+    loader.Add("Spell Proc Item Enchant",       [] { sSpellMgr.LoadSpellProcItemEnchant(); },         { "Spell Chain Data" });
+    loader.Add("Aggro Spells Definitions",      [] { sSpellMgr.LoadSpellThreats(); },                 { "Spell Chain Data" });
+    loader.Add("NPC Texts",                     [] { sObjectMgr.LoadGossipText(); });
+    loader.Add("Item Random Enchantments Table", [] { LoadRandomEnchantmentsTable(); });
+    loader.Add("Disables",                      [] { DisableMgr::LoadDisables(); });
+    loader.Add("Items",                         [] { sObjectMgr.LoadItemPrototypes(); },              { "Item Random Enchantments Table", "Page Texts", "Disables" });
+    loader.Add("Item converts",                 [] { sObjectMgr.LoadItemConverts(); },                { "Items" });
+    loader.Add("Item expire converts",          [] { sObjectMgr.LoadItemExpireConverts(); },          { "Items" });
+    loader.Add("Creature Model Based Info Data", [] { sObjectMgr.LoadCreatureModelInfo(); });
+    loader.Add("Equipment templates",           [] { sObjectMgr.LoadEquipmentTemplates(); },          { "Items" });
+    loader.Add("Creature Stats",                [] { sObjectMgr.LoadCreatureClassLvlStats(); });
+    loader.Add("Creature templates",            [] { sObjectMgr.LoadCreatureTemplates(); },           { "Creature Model Based Info Data", "Equipment templates", "Creature Stats" });
+    loader.Add("Creature template spells",      [] { sObjectMgr.LoadCreatureTemplateSpells(); },      { "Creature templates" });
+    loader.Add("Creature Model for race",       [] { sObjectMgr.LoadCreatureModelRace(); },           { "Creature templates" });
+    loader.Add("SpellsScriptTarget",            [] { sSpellMgr.LoadSpellScriptTarget(); },            { "Creature templates", "Game Object Templates" });
+    loader.Add("Vehicle Accessory",             [] { sObjectMgr.LoadVehicleAccessory(); },            { "Creature templates" });
+    loader.Add("ItemRequiredTarget",            [] { sObjectMgr.LoadItemRequiredTarget(); },          { "Items", "Creature templates", "SpellsScriptTarget" });
+    loader.Add("Reputation Reward Rates",       [] { sObjectMgr.LoadReputationRewardRate(); });
+    loader.Add("Creature Reputation OnKill Data", [] { sObjectMgr.LoadReputationOnKill(); },          { "Creature templates" });
+    loader.Add("Reputation Spillover Data",     [] { sObjectMgr.LoadReputationSpilloverTemplate(); });
+    loader.Add("Points Of Interest Data",       [] { sObjectMgr.LoadPointsOfInterest(); });
+    loader.Add("Creature Data",                 [] { sObjectMgr.LoadCreatures(); },                   { "Creature templates", "Disables" });
+    loader.Add("pet levelup spells",            [] { sSpellMgr.LoadPetLevelupSpellMap(); },           { "Spell Chain Data" });
+    loader.Add("pet default spells",            [] { sSpellMgr.LoadPetDefaultSpells(); },             { "Creature templates", "Creature template spells", "pet levelup spells" });
+    loader.Add("Creature Addon Data",           [] { sObjectMgr.LoadCreatureAddons(); },              { "Creature Data" });
+    // creatures and gameobjects share the per-cell guid index, so they load one after the other
+    loader.Add("Gameobject Data",               [] { sObjectMgr.LoadGameObjects(); },                 { "Game Object Templates", "Creature Data" });
+    loader.Add("Gameobject Addon Data",         [] { sObjectMgr.LoadGameObjectAddon(); },             { "Gameobject Data" });
+    loader.Add("CreatureLinking Data",          [] { sCreatureLinkingMgr.LoadFromDB(); },             { "Creature Data" });
+    loader.Add("Objects Pooling Data",          [] { sPoolMgr.LoadFromDB(); },                        { "Creature Data", "Gameobject Data" });
+    loader.Add("Weather Data",                  [] { sWeatherMgr.LoadWeatherZoneChances(); });
+    loader.Add("Quests",                        [] { sObjectMgr.LoadQuests(); },                      { "Items", "Creature templates", "Game Object Templates", "Disables" });
+    loader.Add("Quest POI",                     [] { sObjectMgr.LoadQuestPOI(); },                    { "Quests" });
+    loader.Add("Quests Relations",              [] { sObjectMgr.LoadQuestRelations(); },              { "Quests" });
+    loader.Add("Quest Disables",                [] { DisableMgr::CheckQuestDisables(); },             { "Quests" });
+    loader.Add("Game Event Data",               [] { sGameEventMgr.LoadFromDB(); },                   { "Objects Pooling Data", "Quests Relations" });
+    loader.Add("Conditions",                    [] { sObjectMgr.LoadConditions(); },                  { "Quests", "Game Event Data" });
+    // must be after PackInstances(), which ran above
+    loader.Add("map persistent states for non-instanceable maps", [] { sMapPersistentStateMgr.InitWorldMaps(); }, { "Objects Pooling Data", "Game Event Data" });
+    // both may create persistent states for instances, so they do not overlap
+    loader.Add("Creature Respawn Data",         [] { sMapPersistentStateMgr.LoadCreatureRespawnTimes(); },   { "map persistent states for non-instanceable maps" });
+    loader.Add("Gameobject Respawn Data",       [] { sMapPersistentStateMgr.LoadGameobjectRespawnTimes(); }, { "Creature Respawn Data" });
+    loader.Add("UNIT_NPC_FLAG_SPELLCLICK Data", [] { sObjectMgr.LoadNPCSpellClickSpells(); },         { "Creature templates", "Conditions" });
+    loader.Add("SpellArea Data",                [] { sSpellMgr.LoadSpellAreas(); },                   { "Quests", "Conditions" });
+    loader.Add("AreaTrigger definitions",       [] { sObjectMgr.LoadAreaTriggerTeleports(); },        { "Items", "Quests", "Conditions" });
+    loader.Add("Quest Area Triggers",           [] { sObjectMgr.LoadQuestAreaTriggers(); },           { "Quests" });
+    loader.Add("Tavern Area Triggers",          [] { sObjectMgr.LoadTavernAreaTriggers(); });
+
+    loader.Run(getConfig(CONFIG_UINT32_STARTUP_LOADER_THREADS), &WorldDatabase);
+    loader.LogReport();
 
 #ifdef ENABLE_SD3
     sLog.outString("Loading all script bindings...");
@@ -762,6 +669,9 @@ void World::SetInitialWorldSettings()
     // for Dungeon Finder
     m_timers[WUPDATE_LFGMGR].SetInterval(30 * IN_MILLISECONDS); // every 30 sec
 
+    // window of the per map tick time statistics
+    m_timers[WUPDATE_TICKSTATS].SetInterval(MINUTE * IN_MILLISECONDS);
+
     // for AutoBroadcast
     sLog.outString("Starting AutoBroadcast System");
     if (m_broadcastEnable)
@@ -873,6 +783,11 @@ void World::SetInitialWorldSettings()
 
 #ifdef ENABLE_PLAYERBOTS
     sPlayerbotAIConfig.Initialize();
+    if (sPlayerbotAIConfig.enabled)
+    {
+        sRandomPlayerbotMgr.LoadEventValues();
+        sRandomPlayerbotMgr.PrepareTeleportCache();
+    }
 #endif
 
     showFooter();
@@ -1047,6 +962,9 @@ void World::DetectDBCLang()
 /// Update the World !
 void World::Update(uint32 diff)
 {
+    TRACE_SCOPE("world update");
+    TickLapTimer lap(m_tickStats);
+
     ///- Update the different timers
     for (int i = 0; i < WUPDATE_COUNT; ++i)
     {
@@ -1155,13 +1073,17 @@ void World::Update(uint32 diff)
         DEBUG_FILTER_LOG(LOG_FILTER_LFG, "WORLD: LFGMgr::Update tick");
     }
 
+    lap.Lap(TICK_PHASE_WORLD_TIMERS);
+
 #ifdef ENABLE_PLAYERBOTS
     sRandomPlayerbotMgr.UpdateAI(diff);
     sRandomPlayerbotMgr.UpdateSessions(diff);
+    lap.Lap(TICK_PHASE_WORLD_BOTS);
 #endif
 
     /// <li> Handle session updates
     UpdateSessions(diff);
+    lap.Lap(TICK_PHASE_WORLD_SESSIONS);
 
     /// <li> Update uptime table
     if (m_timers[WUPDATE_UPTIME].Passed())
@@ -1173,11 +1095,15 @@ void World::Update(uint32 diff)
         LoginDatabase.PExecute("UPDATE `uptime` SET `uptime` = %u, `maxplayers` = %u WHERE `realmid` = %u AND `starttime` = " UI64FMTD, tmpDiff, maxClientsNum, realmID, uint64(m_startTime));
     }
 
+    lap.Lap(TICK_PHASE_WORLD_TIMERS);
+
     /// <li> Handle all other objects
     ///- Update objects (maps, transport, creatures,...)
     sMapMgr.Update(diff);
+    lap.Lap(TICK_PHASE_WORLD_MAPS);
     sBattleGroundMgr.Update(diff);
     sOutdoorPvPMgr.Update(diff);
+    lap.Lap(TICK_PHASE_WORLD_BATTLEGROUNDS);
 
     ///- Used by Eluna
 #ifdef ENABLE_ELUNA
@@ -1186,6 +1112,7 @@ void World::Update(uint32 diff)
         e->UpdateEluna(diff);
         e->OnWorldUpdate(diff);
     }
+    lap.Lap(TICK_PHASE_WORLD_ELUNA);
 #endif /* ENABLE_ELUNA */
 
     ///- Delete all characters which have been deleted X days before
@@ -1195,8 +1122,11 @@ void World::Update(uint32 diff)
         Player::DeleteOldCharacters();
     }
 
+    lap.Lap(TICK_PHASE_WORLD_TIMERS);
+
     // execute callbacks from sql queries that were queued recently
     UpdateResultQueue();
+    lap.Lap(TICK_PHASE_WORLD_DB_CALLBACKS);
 
     ///- Erase corpses once every 20 minutes
     if (m_timers[WUPDATE_CORPSES].Passed())
@@ -1215,6 +1145,8 @@ void World::Update(uint32 diff)
         m_timers[WUPDATE_EVENTS].Reset();
     }
 
+    lap.Lap(TICK_PHASE_WORLD_TIMERS);
+
     /// </ul>
     ///- Move all creatures with "delayed move" and remove and delete all objects with "delayed remove"
     sMapMgr.RemoveAllObjectsInRemoveList();
@@ -1227,6 +1159,22 @@ void World::Update(uint32 diff)
 
     // cleanup unused GridMap objects as well as VMaps
     sTerrainMgr.Update(diff);
+
+    // in steady state every packet of the tick came out of the pool
+    uint64 packetBufferAllocations = PacketBufferPool::GetStats().systemAllocations;
+    m_packetBufferAllocationsLastTick = uint32(packetBufferAllocations - m_packetBufferAllocations);
+    m_packetBufferAllocations = packetBufferAllocations;
+
+    lap.Lap(TICK_PHASE_WORLD_CLEANUP);
+    lap.Finish(TICK_PHASE_WORLD_TOTAL);
+
+    ///- Close the window of the per map tick statistics
+    if (m_timers[WUPDATE_TICKSTATS].Passed())
+    {
+        m_timers[WUPDATE_TICKSTATS].Reset();
+        sTickStats.HandOver(TICK_STATS_WORLD, 0, m_tickStats);
+        sTickStats.Rotate(m_timers[WUPDATE_TICKSTATS].GetInterval());
+    }
 }
 
 namespace MaNGOS
@@ -1647,6 +1595,8 @@ void World::UpdateSessions(uint32 /*diff*/)
         m_sessionAddQueue.clear();
     }
 
+    UpdateSessionsOutsideMaps();
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = m_sessions.begin(), next; itr != m_sessions.end(); itr = next)
     {
@@ -1654,6 +1604,11 @@ void World::UpdateSessions(uint32 /*diff*/)
         ++next;
         ///- and remove not active sessions from the list
         WorldSession* pSession = itr->second;
+        if (!pSession->NeedsWorldUpdate())
+        {
+            continue;
+        }
+
         WorldSessionFilter updater(pSession);
 
         if (!pSession->Update(updater))
@@ -1665,6 +1620,55 @@ void World::UpdateSessions(uint32 /*diff*/)
     }
 }
 
+/// Sessions handed to one map worker at a time by UpdateSessionsOutsideMaps().
+static const size_t SESSION_UPDATE_BATCH = 64;
+
+/**
+ * @brief Handles the session-local packets of sessions outside a map on the map workers.
+ *
+ * Character screen, loading screen and login queue sessions are handled here in
+ * batches, in parallel; the serial pass in UpdateSessions() then only has their
+ * world packets left. Below one batch, or without map workers, the serial pass
+ * takes everything as before.
+ */
+void World::UpdateSessionsOutsideMaps()
+{
+    MapUpdater& workers = sMapMgr.GetUpdater();
+    if (!workers.activated())
+    {
+        return;
+    }
+
+    m_sessionsOutsideMaps.clear();
+    for (SessionMap::const_iterator itr = m_sessions.begin(); itr != m_sessions.end(); ++itr)
+    {
+        Player* player = itr->second->GetPlayer();
+        if (!player || !player->IsInWorld())
+        {
+            m_sessionsOutsideMaps.push_back(itr->second);
+        }
+    }
+
+    if (m_sessionsOutsideMaps.size() < SESSION_UPDATE_BATCH)
+    {
+        return;
+    }
+
+    for (size_t begin = 0; begin < m_sessionsOutsideMaps.size(); begin += SESSION_UPDATE_BATCH)
+    {
+        size_t end = std::min(begin + SESSION_UPDATE_BATCH, m_sessionsOutsideMaps.size());
+        workers.schedule([this, begin, end]
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                m_sessionsOutsideMaps[i]->UpdateSessionLocal();
+            }
+        });
+    }
+
+    workers.wait();
+}
+
 // This handles the issued and queued CLI/RA commands
 void World::ProcessCliCommands()
 {
@@ -44,6 +44,7 @@
 #include "Timer.h"
 #include "Policies/Singleton.h"
 #include "SharedDefines.h"
+#include "TickStats.h"
 
 #include <map>
 #include <set>
@@ -101,7 +102,8 @@ enum WorldTimers
     WUPDATE_AHBOT       = 5,
     WUPDATE_LFGMGR      = 6,
     WUPDATE_WEATHERS    = 7,
-    WUPDATE_COUNT       = 8
+    WUPDATE_TICKSTATS   = 8,
+    WUPDATE_COUNT       = 9
 };
 
 /// Configuration elements
@@ -234,6 +236,9 @@ enum eConfigUInt32Values
     CONFIG_UINT32_CHARDELETE_METHOD,
     CONFIG_UINT32_CHARDELETE_MIN_LEVEL,
     CONFIG_UINT32_NUMTHREADS,
+    CONFIG_UINT32_STARTUP_LOADER_THREADS,
+    CONFIG_UINT32_GRID_PRELOAD_THREADS,
+    CONFIG_UINT32_MAP_IDLE_CELL_SLEEP,
     CONFIG_UINT32_GUID_RESERVE_SIZE_CREATURE,
     CONFIG_UINT32_GUID_RESERVE_SIZE_GAMEOBJECT,
     CONFIG_UINT32_MIN_LEVEL_FOR_RAID,
@@ -435,6 +440,8 @@ enum eConfigBoolValues
 
     // LFG (Dungeon Finder)
     CONFIG_BOOL_LFG_ENABLE,
+
+    CONFIG_BOOL_STATIC_TABLE_SNAPSHOTS,
     CONFIG_BOOL_VALUE_COUNT
 };
 
@@ -558,6 +565,8 @@ class World
         /// Get the maximum number of parallel sessions on the server since last reboot
         uint32 GetMaxQueuedSessionCount() const { return m_maxQueuedSessionCount; }
         uint32 GetMaxActiveSessionCount() const { return m_maxActiveSessionCount; }
+        /// Packet buffers PacketBufferPool had to take from the system during the last tick
+        uint32 GetPacketBufferAllocationsLastTick() const { return m_packetBufferAllocationsLastTick; }
         Player* FindPlayerInZone(uint32 zone);
 
         /// Get the active session server limit (or security level limitations)
@@ -628,6 +637,7 @@ class World
         void Update(uint32 diff);
 
         void UpdateSessions(uint32 diff);
+        void UpdateSessionsOutsideMaps();
 
         /// Get a server configuration element (see #eConfigFloatValues)
         void setConfig(eConfigFloatValues index, float value) { m_configFloatValues[index] = value; }
@@ -780,9 +790,15 @@ class World
         uint32 mail_timer_expires;
 
         SessionMap m_sessions;
+        std::vector<WorldSession*> m_sessionsOutsideMaps;   // UpdateSessionsOutsideMaps() scratch, kept for its capacity
         uint32 m_maxActiveSessionCount;
         uint32 m_maxQueuedSessionCount;
 
+        uint64 m_packetBufferAllocations;                   // PacketBufferPool system allocations at the end of the last tick
+        uint32 m_packetBufferAllocationsLastTick;
+
+        TickStatsRecorder m_tickStats;                      // phase times of Update not yet handed to sTickStats
+
         uint64 m_configUint64Values[CONFIG_UINT64_VALUE_COUNT];
         int64 m_configInt64Values[CONFIG_INT64_VALUE_COUNT];
         uint32 m_configUint32Values[CONFIG_UINT32_VALUE_COUNT];
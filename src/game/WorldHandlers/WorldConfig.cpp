@@ -261,12 +261,24 @@ void World::LoadConfigSettings(bool reload)
 
     setConfig(CONFIG_UINT32_NUMTHREADS, "MapUpdateThreads", 2);
 
+    if (configNoReload(reload, CONFIG_UINT32_STARTUP_LOADER_THREADS, "StartupLoaderThreads", 4))
+    {
+        setConfig(CONFIG_UINT32_STARTUP_LOADER_THREADS, "StartupLoaderThreads", 4);
+    }
+
+    if (configNoReload(reload, CONFIG_UINT32_GRID_PRELOAD_THREADS, "GridPreloadThreads", 1))
+    {
+        setConfig(CONFIG_UINT32_GRID_PRELOAD_THREADS, "GridPreloadThreads", 1);
+    }
+
     setConfigMin(CONFIG_UINT32_INTERVAL_MAPUPDATE, "MapUpdateInterval", 100, MIN_MAP_UPDATE_DELAY);
     if (reload)
     {
         sMapMgr.SetMapUpdateInterval(getConfig(CONFIG_UINT32_INTERVAL_MAPUPDATE));
     }
 
+    setConfig(CONFIG_UINT32_MAP_IDLE_CELL_SLEEP, "MapUpdateIdleCellSleep", 2000);
+
     setConfig(CONFIG_UINT32_INTERVAL_CHANGEWEATHER, "ChangeWeatherInterval", 10 * MINUTE * IN_MILLISECONDS);
 
     if (configNoReload(reload, CONFIG_UINT32_PORT_WORLD, "WorldServerPort", DEFAULT_WORLDSERVER_PORT))
@@ -678,6 +690,8 @@ void World::LoadConfigSettings(bool reload)
         sLog.outString("Using DataDir %s", m_dataPath.c_str());
     }
 
+    setConfig(CONFIG_BOOL_STATIC_TABLE_SNAPSHOTS, "StaticTableSnapshots", true);
+
     setConfig(CONFIG_BOOL_VMAP_INDOOR_CHECK, "vmap.enableIndoorCheck", true);
     // vmap.enableLOS and vmap.enableHeight are gone rather than ignored. A fused tile
     // carries terrain and collision in one file, so there is nothing left that could be
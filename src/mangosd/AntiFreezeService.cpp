@@ -29,10 +29,13 @@
 
 #include "Log.h"
 #include "Timer.h"
+#include "Trace.h"
 #include "World.h"
 
 #include <chrono>
+#include <cstdio>
 #include <cstdlib>
+#include <ctime>
 
 AntiFreezeService::AntiFreezeService(uint32 maxStuckMs)
     : m_maxStuckMs(maxStuckMs),
@@ -115,6 +118,7 @@ void AntiFreezeService::Run()
             sLog.outError("World thread has not advanced for %u seconds -- "
                           "terminating so the server can be restarted.",
                           m_maxStuckMs / 1000);
+            DumpTrace();
             Log::WaitBeforeContinueIfNeed();
             std::abort();
         }
@@ -122,3 +126,26 @@ void AntiFreezeService::Run()
 
     sLog.outString("Anti-freeze watchdog stopped.");
 }
+
+void AntiFreezeService::DumpTrace()
+{
+    if (!Trace::IsEnabled())
+    {
+        return;
+    }
+
+    // Whatever the rings still hold: the last seconds of every thread, with the
+    // span the world thread is stuck in left open.
+    char name[64];
+    snprintf(name, sizeof(name), "freeze-%u.json", uint32(time(NULL)));
+    std::string path = sLog.GetLogsDir() + name;
+
+    int32 events = Trace::DumpChromeTrace(path, 0);
+    if (events < 0)
+    {
+        sLog.outError("Could not write the freeze trace to %s", path.c_str());
+        return;
+    }
+
+    sLog.outError("Trace of the freeze written to %s (%d events)", path.c_str(), events);
+}
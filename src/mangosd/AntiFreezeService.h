@@ -54,6 +54,9 @@
  *
  * Off by default (MaxCoreStuckTime = 0), so terminating only ever happens
  * because an operator explicitly asked for it.
+ *
+ * With Trace.Enable on, the watchdog first writes out the trace rings, which show
+ * what every thread did in the last seconds and what the world thread is stuck in.
  */
 class AntiFreezeService : public IService
 {
@@ -76,6 +79,9 @@ class AntiFreezeService : public IService
 
         void Run();
 
+        /// Writes the in-memory trace next to the logs, if tracing is on.
+        void DumpTrace();
+
         const uint32 m_maxStuckMs;
 
         std::thread             m_thread;
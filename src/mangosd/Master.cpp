@@ -39,6 +39,7 @@
 #include "Server/WorldNetwork.h"
 #include "SystemConfig.h"
 #include "Timer.h"
+#include "Trace.h"
 #include "World.h"
 
 #ifdef ENABLE_SOAP
@@ -229,6 +230,9 @@ void Master::StartServices()
     }
 #endif
 
+    // In-memory trace of the server threads, for `.server trace` and the watchdog.
+    Trace::SetEnabled(sConfig.GetBoolDefault("Trace.Enable", false));
+
     // Watchdog. Disabled unless MaxCoreStuckTime is set.
     m_services.push_back(std::unique_ptr<IService>(new AntiFreezeService(
         1000 * uint32(sConfig.GetIntDefault("MaxCoreStuckTime", 0)))));
@@ -311,6 +315,7 @@ void Master::WorldLoop()
 {
     sLog.outString("World updater started (%dms minimum update interval)",
                    WORLD_SLEEP_CONST);
+    Trace::SetThreadName("world");
 
     uint32 previous = getMSTime();
     uint32 lastStatus = 0;
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <atomic>
+
+/**
+ * @brief How often a bot's strategy engine runs, by how closely real players can observe it.
+ */
+enum BotTickTier
+{
+    BOT_TICK_FULL    = 0, ///< A real player can see the bot, leads it or is grouped with it: every update.
+    BOT_TICK_REDUCED = 1, ///< A real player is in the zone but out of sight, or the bot is fighting unobserved.
+    BOT_TICK_IDLE    = 2, ///< Nobody around: coarse ticks, enough for travel and leveling to go on.
+    BOT_TICK_TIERS   = 3
+};
+
+/**
+ * @brief What a bot's tick tier is decided from; gathered by PlayerbotAI::ReviewTickTier().
+ */
+struct BotTickObservers
+{
+    bool realPlayerInGroup;   ///< The bot's master or a member of its group is a real player.
+    bool realPlayerInSight;   ///< A real player on the same map is within visibility distance.
+    bool realPlayerInZone;    ///< A real player is somewhere in the bot's zone.
+    bool inCombat;            ///< The bot is fighting.
+    bool pendingPackets;      ///< The bot has packets (invites, trades, ...) waiting for its engine.
+
+    BotTickObservers() : realPlayerInGroup(false), realPlayerInSight(false), realPlayerInZone(false),
+        inCombat(false), pendingPackets(false) {}
+};
+
+/**
+ * @brief Picks the tier for a bot.
+ *
+ * Anything a real player can notice runs at full rate. A fight nobody watches is
+ * never dropped below the reduced rate, so it still ends in reasonable time.
+ *
+ * @param observers What is around the bot.
+ * @return BotTickTier The tier the bot should run at.
+ */
+inline BotTickTier SelectBotTickTier(BotTickObservers const& observers)
+{
+    if (observers.realPlayerInGroup || observers.realPlayerInSight || observers.pendingPackets)
+    {
+        return BOT_TICK_FULL;
+    }
+
+    if (observers.realPlayerInZone || observers.inCombat)
+    {
+        return BOT_TICK_REDUCED;
+    }
+
+    return BOT_TICK_IDLE;
+}
+
+/**
+ * @brief Per bot gate in front of the strategy engine.
+ *
+ * Every world update is fed in; the engine is let through at most once per interval
+ * of the bot's tier and is then handed all the time accumulated since its last run,
+ * so delays and cooldowns inside the AI keep counting down at the real rate.
+ */
+class BotTickGate
+{
+public:
+    BotTickGate() : m_tier(BOT_TICK_FULL), m_pending(0), m_sinceReview(0), m_reviewed(false) {}
+
+    /**
+     * @brief Accumulates update time and reports whether the tier is due for review.
+     *
+     * @param elapsed Time since the previous update, in milliseconds.
+     * @param period Time between reviews, in milliseconds.
+     * @return bool true on the first call and then once per period.
+     */
+    bool Review(uint32 elapsed, uint32 period)
+    {
+        m_sinceReview += elapsed;
+        if (m_reviewed && m_sinceReview < period)
+        {
+            return false;
+        }
+
+        m_reviewed = true;
+        m_sinceReview = 0;
+        return true;
+    }
+
+    /**
+     * @brief Accumulates update time and reports whether the engine may run.
+     *
+     * @param elapsed Time since the previous update, in milliseconds.
+     * @param interval Least time between runs at the current tier; 0 lets every update through.
+     * @return bool true if the engine should run now; collect the time with TakeElapsed().
+     */
+    bool Advance(uint32 elapsed, uint32 interval)
+    {
+        m_pending += elapsed;
+        return m_pending >= interval;
+    }
+
+    /**
+     * @brief Returns the time accumulated since the engine last ran and starts a new interval.
+     */
+    uint32 TakeElapsed()
+    {
+        uint32 pending = m_pending;
+        m_pending = 0;
+        return pending;
+    }
+
+    BotTickTier GetTier() const { return m_tier; }
+    void SetTier(BotTickTier tier) { m_tier = tier; }
+
+private:
+    BotTickTier m_tier;
+    uint32 m_pending;       ///< Update time not yet handed to the engine.
+    uint32 m_sinceReview;
+    bool m_reviewed;
+};
+
+/**
+ * @brief CPU time spent on bot updates, per tick tier.
+ *
+ * Fed from every map update thread, so the counters are atomics; they are only
+ * read for the periodic random bot statistics.
+ */
+class BotTickAccounting
+{
+public:
+    /// Totals for one tier since the last Reset().
+    struct Totals
+    {
+        uint64 runs;    ///< Updates let through to the AI.
+        uint64 skips;   ///< Updates held back by the tier's interval.
+        uint64 micros;  ///< Time spent in the updates let through.
+    };
+
+    BotTickAccounting() { Reset(); }
+
+    void RecordRun(BotTickTier tier, uint64 micros)
+    {
+        m_runs[tier].fetch_add(1, std::memory_order_relaxed);
+        m_micros[tier].fetch_add(micros, std::memory_order_relaxed);
+    }
+
+    void RecordSkip(BotTickTier tier)
+    {
+        m_skips[tier].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Totals Get(BotTickTier tier) const
+    {
+        Totals totals;
+        totals.runs = m_runs[tier].load(std::memory_order_relaxed);
+        totals.skips = m_skips[tier].load(std::memory_order_relaxed);
+        totals.micros = m_micros[tier].load(std::memory_order_relaxed);
+        return totals;
+    }
+
+    void Reset()
+    {
+        for (int i = 0; i < BOT_TICK_TIERS; ++i)
+        {
+            m_runs[i].store(0, std::memory_order_relaxed);
+            m_skips[i].store(0, std::memory_order_relaxed);
+            m_micros[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::atomic<uint64> m_runs[BOT_TICK_TIERS];
+    std::atomic<uint64> m_skips[BOT_TICK_TIERS];
+    std::atomic<uint64> m_micros[BOT_TICK_TIERS];
+};
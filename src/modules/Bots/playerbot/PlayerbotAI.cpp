@@ -24,6 +24,8 @@
 #include "GuildTaskMgr.h"
 #include "PlayerbotDbStore.h"
 
+#include <chrono>
+
 using namespace ai;
 using namespace std;
 
@@ -181,15 +183,43 @@ PlayerbotAI::~PlayerbotAI()
  */
 void PlayerbotAI::UpdateAI(uint32 elapsed)
 {
-    if (sPlayerbotAIConfig.randomBotActiveZoneOnly &&
-        !bot->GetGroup() && sRandomPlayerbotMgr.IsRandomBot(bot) &&
-        botOutgoingPacketHandlers.IsEmpty() &&
-        !sRandomPlayerbotMgr.HasRealPlayerInZone(bot->GetZoneId()))
+    if (m_tickGate.Review(elapsed, sPlayerbotAIConfig.tickTierReviewInterval))
+    {
+        m_tickGate.SetTier(ReviewTickTier());
+    }
+
+    BotTickTier tier = m_tickGate.GetTier();
+    if (tier == BOT_TICK_IDLE && sPlayerbotAIConfig.randomBotActiveZoneOnly && !bot->GetGroup())
     {
         SetNextCheckDelay(5000);
         return;
     }
 
+    // Hold the update back until the tier's interval is up, then hand the AI all of
+    // the time that passed so its own delays run down at the real rate
+    uint32 interval = 0;
+    if (sPlayerbotAIConfig.adaptiveTicks)
+    {
+        if (tier == BOT_TICK_REDUCED)
+        {
+            interval = sPlayerbotAIConfig.reducedTickInterval;
+        }
+        else if (tier == BOT_TICK_IDLE)
+        {
+            interval = sPlayerbotAIConfig.idleTickInterval;
+        }
+    }
+
+    BotTickAccounting& accounting = sRandomPlayerbotMgr.GetTickAccounting();
+    if (!m_tickGate.Advance(elapsed, interval))
+    {
+        accounting.RecordSkip(tier);
+        return;
+    }
+    elapsed = m_tickGate.TakeElapsed();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
     if (m_eatingUntil || m_drinkingUntil)
     {
         bool finished = !IsEating() && !IsDrinking();
@@ -225,6 +255,50 @@ void PlayerbotAI::UpdateAI(uint32 elapsed)
     }
 
     PlayerbotAIBase::UpdateAI(elapsed);
+
+    accounting.RecordRun(tier, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+/**
+ * Decides how often the bot's AI should run, from how closely real players can observe it.
+ * Bots that belong to a real player always run at full rate.
+ * @return The tick tier for the bot.
+ */
+BotTickTier PlayerbotAI::ReviewTickTier()
+{
+    if (!sPlayerbotAIConfig.adaptiveTicks && !sPlayerbotAIConfig.randomBotActiveZoneOnly)
+    {
+        return BOT_TICK_FULL;
+    }
+
+    if (!sRandomPlayerbotMgr.IsRandomBot(bot))
+    {
+        return BOT_TICK_FULL;
+    }
+
+    BotTickObservers observers;
+    observers.realPlayerInGroup = master && !master->GetPlayerbotAI();
+    if (!observers.realPlayerInGroup)
+    {
+        if (Group* group = bot->GetGroup())
+        {
+            for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
+            {
+                Player* member = ref->getSource();
+                if (member && !member->GetPlayerbotAI())
+                {
+                    observers.realPlayerInGroup = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    observers.pendingPackets = !botOutgoingPacketHandlers.IsEmpty();
+    observers.inCombat = bot->IsInCombat();
+    observers.realPlayerInZone = sRandomPlayerbotMgr.HasRealPlayerInZone(bot->GetZoneId());
+    observers.realPlayerInSight = sRandomPlayerbotMgr.HasRealPlayerInSight(bot);
+    return SelectBotTickTier(observers);
 }
 
 /**
@@ -8,6 +8,7 @@
 #include "strategy/ExternalEventHelper.h"
 #include "ChatFilter.h"
 #include "PlayerbotSecurity.h"
+#include "BotTickScheduler.h"
 #include <stack>
 #include "Unit.h"
 
@@ -191,6 +192,7 @@ public:
 private:
     void _fillGearScoreData(Player *player, Item* item, std::vector<uint32>* gearScore, uint32& twoHandScore);
     void ResyncObserversAfterTeleport();
+    BotTickTier ReviewTickTier();
 
 public:
     Player* GetBot() { return bot; }
@@ -201,6 +203,7 @@ public:
     bool IsOpposing(Player* player);
     static bool IsOpposing(uint8 race1, uint8 race2);
     PlayerbotSecurity* GetSecurity() { return &security; }
+    BotTickTier GetTickTier() const { return m_tickGate.GetTier(); }
 
     bool IsEating() const
     {
@@ -240,5 +243,6 @@ protected:
     pair<ChatMsg, time_t> currentChat;
     time_t m_eatingUntil;
     time_t m_drinkingUntil;
+    BotTickGate m_tickGate;
 };
 
@@ -2,6 +2,7 @@
 #include "PlayerbotAIConfig.h"
 #include "playerbot.h"
 #include "RandomPlayerbotFactory.h"
+#include "PlayerbotFactory.h"
 #include "AccountMgr.h"
 #include "SystemConfig.h"
 
@@ -72,6 +73,10 @@ PlayerbotAIConfig::PlayerbotAIConfig()
       randomBotLoginAtStartup(false),
       randomBotKeepGroups(false),
       randomBotActiveZoneOnly(false),
+      adaptiveTicks(false),
+      reducedTickInterval(0),
+      idleTickInterval(0),
+      tickTierReviewInterval(0),
       randomBotTeleLevel(0),
       feralBearTankChance(0),
       logInGroupOnly(false),
@@ -230,6 +235,10 @@ bool PlayerbotAIConfig::Initialize()
     randomBotLoginAtStartup = config.GetBoolDefault("AiPlayerbot.RandomBotLoginAtStartup", true);
     randomBotKeepGroups = config.GetBoolDefault("AiPlayerbot.RandomBotKeepGroups", false);
     randomBotActiveZoneOnly = config.GetBoolDefault("AiPlayerbot.RandomBotActiveZoneOnly", false);
+    adaptiveTicks = config.GetBoolDefault("AiPlayerbot.AdaptiveTicks", true);
+    reducedTickInterval = config.GetIntDefault("AiPlayerbot.ReducedTickInterval", 1000);
+    idleTickInterval = config.GetIntDefault("AiPlayerbot.IdleTickInterval", 10000);
+    tickTierReviewInterval = config.GetIntDefault("AiPlayerbot.TickTierReviewInterval", 2000);
     randomBotTeleLevel = config.GetIntDefault("AiPlayerbot.RandomBotTeleLevel", 3);
     openGoSpell = config.GetIntDefault("AiPlayerbot.OpenGoSpell", 6477);
 
@@ -291,6 +300,12 @@ bool PlayerbotAIConfig::Initialize()
 
     // Create random bots
     RandomPlayerbotFactory::CreateRandomBots();
+
+    // The curated gear tables are read once here, not when a bot is randomized
+    if (useCuratedGear)
+    {
+        PlayerbotFactory::LoadCuratedGear();
+    }
     sLog.outString("AI Playerbot configuration loaded");
 
     return true;
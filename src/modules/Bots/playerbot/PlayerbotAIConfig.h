@@ -85,6 +85,10 @@ public:
     bool randomBotLoginAtStartup; ///< Indicates if random bots should login at startup.
     bool randomBotKeepGroups; ///< Indicates if random bots should preserve groups across restarts.
     bool randomBotActiveZoneOnly; ///< If true, ungrouped random bots only tick when a real player is in their zone.
+    bool adaptiveTicks; ///< If true, random bots run their engine at a rate set by how close real players are.
+    uint32 reducedTickInterval; ///< Least ms between engine runs for bots with a real player in the zone but not in sight.
+    uint32 idleTickInterval; ///< Least ms between engine runs for bots with no real player in the zone.
+    uint32 tickTierReviewInterval; ///< ms between re-evaluations of a bot's tick tier.
     uint32 randomBotTeleLevel; ///< The teleport level for random bots.
     bool logInGroupOnly, logValuesPerTick;
     bool fleeingEnabled; ///< Indicates if fleeing is enabled for bots.
@@ -39,6 +39,7 @@ list<uint32> PlayerbotFactory::classQuestIds;
 
 // Curated gear cache: class -> spec -> tier -> slot -> itemId.
 map<uint8, map<string, map<string, map<string, uint32> > > > PlayerbotFactory::curatedGearSets;
+bool PlayerbotFactory::curatedGearLoaded = false;
 
 // Phase B/C/D: curated enchant/gem/glyph caches, mirroring curatedGearSets.
 bool PlayerbotFactory::curatedEnhancementsLoaded = false;
@@ -1210,6 +1211,48 @@ void PlayerbotFactory::ApplyCuratedGlyphs(const string& specKey)
     }
 }
 
+/**
+ * Loads the curated gear cache from ai_playerbot_gear, then the curated
+ * enchant/gem/glyph caches when they are enabled. No-op after the first
+ * call (curatedGearLoaded), even if the table is empty.
+ */
+void PlayerbotFactory::LoadCuratedGear()
+{
+    if (curatedGearLoaded)
+    {
+        return;
+    }
+    curatedGearLoaded = true;
+
+    QueryResult* results = CharacterDatabase.Query(
+        "SELECT `class`, `spec`, `tier`, `slot`, `item` FROM `ai_playerbot_gear`");
+    if (results)
+    {
+        do
+        {
+            Field* fields = results->Fetch();
+            uint8 cls = fields[0].GetUInt8();
+            string spec = fields[1].GetCppString();
+            string tier = fields[2].GetCppString();
+            string slot = fields[3].GetCppString();
+            uint32 item = fields[4].GetUInt32();
+            curatedGearSets[cls][spec][tier][slot] = item;
+        }
+        while (results->NextRow());
+        delete results;
+    }
+
+    if (curatedGearSets.empty())
+    {
+        sLog.outDetail("AI Playerbot: ai_playerbot_gear is empty, curated gear unavailable");
+    }
+
+    if (sPlayerbotAIConfig.useCuratedGearEnhancements)
+    {
+        LoadCuratedGearEnhancements();
+    }
+}
+
 /**
  * Equips the bot's curated (class/spec/tier) best-in-slot gear set.
  * @param filledSlots Out-param, receives every slot equipped from curated data.
@@ -1223,34 +1266,8 @@ bool PlayerbotFactory::InitCuratedGear(set<uint8>& filledSlots)
         return false;
     }
 
-    // Lazily load the curated gear cache once, mirroring the classQuestIds
-    // pattern used by InitQuests() below.
-    if (curatedGearSets.empty())
-    {
-        QueryResult* results = CharacterDatabase.Query(
-            "SELECT `class`, `spec`, `tier`, `slot`, `item` FROM `ai_playerbot_gear`");
-        if (results)
-        {
-            do
-            {
-                Field* fields = results->Fetch();
-                uint8 cls = fields[0].GetUInt8();
-                string spec = fields[1].GetCppString();
-                string tier = fields[2].GetCppString();
-                string slot = fields[3].GetCppString();
-                uint32 item = fields[4].GetUInt32();
-                curatedGearSets[cls][spec][tier][slot] = item;
-            }
-            while (results->NextRow());
-            delete results;
-        }
-
-        if (curatedGearSets.empty())
-        {
-            sLog.outDetail("AI Playerbot: ai_playerbot_gear is empty, curated gear unavailable");
-            return false;
-        }
-    }
+    // Loaded at startup; only a bot randomized before that queries the tables here
+    LoadCuratedGear();
 
     map<uint8, map<string, map<string, map<string, uint32> > > >::const_iterator clsItr =
         curatedGearSets.find((uint8)bot->getClass());
@@ -47,6 +47,14 @@ public:
      */
     static ObjectGuid GetRandomBot();
 
+    /**
+     * @brief Loads the curated gear caches from ai_playerbot_gear and, when
+     * AiPlayerbot.CuratedGearEnhancements is on, the enchant/gem/glyph tables.
+     * Called once at startup so randomizing a bot never queries the DB;
+     * no-op after the first call.
+     */
+    static void LoadCuratedGear();
+
     /**
      * @brief Cleans and randomizes the player bot.
      */
@@ -82,8 +90,8 @@ private:
     /**
      * @brief Equips the bot's curated (class/spec/tier) best-in-slot gear set,
      * when one exists in the ai_playerbot_gear cache and
-     * AiPlayerbot.UseCuratedGear is on. Lazily loads the static cache from
-     * ai_playerbot_gear on first use. When AiPlayerbot.CuratedGearEnhancements
+     * AiPlayerbot.UseCuratedGear is on. Loads the static cache with
+     * LoadCuratedGear() if startup did not. When AiPlayerbot.CuratedGearEnhancements
      * is also on, applies curated enchants/gems (Phase B/C) to each
      * curated-equipped item and curated glyphs (Phase D) for the bot's spec.
      * \arg \c filledSlots
@@ -358,10 +366,13 @@ private:
     static uint32 tradeSkills[]; ///< Array of trade skills.
     static list<uint32> classQuestIds; ///< List of class quest IDs.
 
-    /// Curated gear cache: class -> spec -> tier -> slot -> itemId. Lazily
-    /// loaded once from `ai_playerbot_gear` (see InitCuratedGear()).
+    /// Curated gear cache: class -> spec -> tier -> slot -> itemId. Loaded
+    /// once from `ai_playerbot_gear` (see LoadCuratedGear()).
     static map<uint8, map<string, map<string, map<string, uint32> > > > curatedGearSets;
 
+    /// Set once LoadCuratedGear() has run (even if the table was empty).
+    static bool curatedGearLoaded;
+
     /// Set once LoadCuratedGearEnhancements() has run (even if the tables
     /// were empty), so it is only ever queried once.
     static bool curatedEnhancementsLoaded;
@@ -26,15 +26,34 @@
 using namespace ai;
 using namespace MaNGOS;
 
+/// Comma separated list of the random bot accounts, for `IN (...)` clauses.
+static string JoinRandomBotAccounts()
+{
+    ostringstream os;
+    bool first = true;
+    for (list<uint32>::iterator i = sPlayerbotAIConfig.randomBotAccounts.begin(); i != sPlayerbotAIConfig.randomBotAccounts.end(); ++i)
+    {
+        if (!first)
+        {
+            os << ",";
+        }
+        os << *i;
+        first = false;
+    }
+
+    return os.str();
+}
+
 /**
  * RandomPlayerbotMgr is responsible for managing random player bots in the game.
  * It handles the creation, updating, and processing of these bots, ensuring they
  * behave in a way that simulates real player activity.
  */
-RandomPlayerbotMgr::RandomPlayerbotMgr() : PlayerbotHolder(), processTicks(0), m_processBotCursor(0)
+RandomPlayerbotMgr::RandomPlayerbotMgr() : PlayerbotHolder(), processTicks(0), m_processBotCursor(0),
+    m_teleportCachePrepared(false), m_addBotsPending(false), m_groupedBotsPending(false), m_eventValuesLoaded(false),
+    m_eventFlushFailed(std::make_shared<std::atomic<bool> >(false))
 {
     sPlayerbotCommandServer.Start();
-    //PrepareTeleportCache();
 }
 
 RandomPlayerbotMgr::~RandomPlayerbotMgr()
@@ -179,6 +198,9 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed)
         PrintStats();
     }
 
+    // Everything this pass changed goes to the DB in one batch
+    FlushEventValues();
+
     // Advance the pass counter. It was never incremented, so the "!processTicks"
     // startup-burst branch above ran on *every* pass -- forcing a full-bot-list
     // process each time instead of only at startup. Incrementing restores the
@@ -186,45 +208,57 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed)
     ++processTicks;
 }
 
-uint32 RandomPlayerbotMgr::AddRandomBots()
+void RandomPlayerbotMgr::AddRandomBots()
 {
-    set<uint32> bots;
+    // Still waiting for the characters asked for on an earlier pass
+    if (m_addBotsPending || sPlayerbotAIConfig.randomBotAccounts.empty())
+    {
+        return;
+    }
 
-    QueryResult* results = CharacterDatabase.PQuery(
-        "select `bot` from ai_playerbot_random_bots where event = 'add'");
+    m_addBotsPending = true;
+    string query = "SELECT `guid`, `race`, `account` FROM `characters` WHERE `account` IN (" + JoinRandomBotAccounts() + ")";
+    CharacterDatabase.AsyncQuery([this](QueryResult* results)
+                                 {
+                                     m_addBotsPending = false;
+                                     AddRandomBots(results);
+                                 },
+                                 query.c_str());
+}
 
-    if (results)
+uint32 RandomPlayerbotMgr::AddRandomBots(QueryResult* results)
+{
+    if (!results)
     {
-        do
-        {
-            Field* fields = results->Fetch();
-            uint32 bot = fields[0].GetUInt32();
-            bots.insert(bot);
-        } while (results->NextRow());
-        delete results;
+        return 0;
     }
 
+    // account -> (guid, race) of its characters, walked in configured account order below
+    std::map<uint32, vector<std::pair<uint32, uint8> > > characters;
+    do
+    {
+        Field* fields = results->Fetch();
+        characters[fields[2].GetUInt32()].push_back(std::make_pair(fields[0].GetUInt32(), fields[1].GetUInt8()));
+    } while (results->NextRow());
+    delete results;
+
+    list<uint32> existing = GetBots();
+    set<uint32> bots(existing.begin(), existing.end());
+
     vector<uint32> guids;
     int maxAllowedBotCount = GetEventValue(0, "bot_count");
     for (list<uint32>::iterator i = sPlayerbotAIConfig.randomBotAccounts.begin(); i != sPlayerbotAIConfig.randomBotAccounts.end(); i++)
     {
-        uint32 accountId = *i;
-        if (!sAccountMgr.GetCharactersCount(accountId))
+        std::map<uint32, vector<std::pair<uint32, uint8> > >::const_iterator account = characters.find(*i);
+        if (account == characters.end())
         {
             continue;
         }
 
-        QueryResult* result = CharacterDatabase.PQuery("SELECT guid, race FROM characters WHERE account = '%u'", accountId);
-        if (!result)
+        for (vector<std::pair<uint32, uint8> >::const_iterator character = account->second.begin(); character != account->second.end(); ++character)
         {
-            continue;
-        }
-
-        do
-        {
-            Field* fields = result->Fetch();
-            uint32 guid = fields[0].GetUInt32();
-            uint8 race = fields[1].GetUInt8();
+            uint32 guid = character->first;
+            uint8 race = character->second;
             bool alliance = guids.size() % 2 == 0;
             if (bots.find(guid) == bots.end() &&
                 ((alliance && IsAlliance(race)) || ((!alliance && !IsAlliance(race))
@@ -239,8 +273,7 @@ uint32 RandomPlayerbotMgr::AddRandomBots()
                 sLog.outString("New random bot %d added", bot);
                 if (bots.size() >= maxAllowedBotCount) break;
             }
-        } while (result->NextRow());
-        delete result;
+        }
     }
 
     return guids.size();
@@ -291,22 +324,14 @@ bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
     uint32 deadFlag = GetEventValue(bot, "dead");
     if (deadFlag)
     {
-        QueryResult* deadRow = CharacterDatabase.PQuery(
-            "SELECT `validIn` FROM `ai_playerbot_random_bots` "
-            "WHERE `owner` = 0 AND `bot` = '%u' AND `event` = 'dead'", bot);
-        if (deadRow)
+        uint32 deadValidIn = GetEventValidIn(bot, "dead");
+        uint32 const sentinelValidIn = sPlayerbotAIConfig.maxRandomBotReviveTime * 10;
+        if (deadValidIn >= sentinelValidIn)
         {
-            uint32 deadValidIn = deadRow->Fetch()[0].GetUInt32();
-            delete deadRow;
-
-            uint32 const sentinelValidIn = sPlayerbotAIConfig.maxRandomBotReviveTime * 10;
-            if (deadValidIn >= sentinelValidIn)
-            {
-                sLog.outDetail("Bot %d dead row wedged (validIn=%u), self-healing", bot, deadValidIn);
-                SetEventValue(bot, "dead", 0, 0);
-                SetEventValue(bot, "revive", 0, 0);
-                deadFlag = 0;
-            }
+            sLog.outDetail("Bot %d dead row wedged (validIn=%u), self-healing", bot, deadValidIn);
+            SetEventValue(bot, "dead", 0, 0);
+            SetEventValue(bot, "revive", 0, 0);
+            deadFlag = 0;
         }
     }
 
@@ -630,35 +655,40 @@ void RandomPlayerbotMgr::RandomTeleport(Player* bot, vector<WorldLocation> &locs
 
 void RandomPlayerbotMgr::RandomTeleportForLevel(Player* bot)
 {
-    // Bounded to avoid sorting/scanning every matching spawn on maps with a
-    // huge creature count; tune against live query performance if needed.
+    // Bounded to avoid zone-checking every matching spawn on maps with a
+    // huge creature count.
     static uint32 const RANDOM_TELEPORT_CANDIDATE_LIMIT = 300;
 
-    vector<WorldLocation> locs;
-    QueryResult* results = WorldDatabase.PQuery(
-        "SELECT `c`.`map`, `c`.`position_x`, `c`.`position_y`, `c`.`position_z` FROM `creature` `c` "
-        "INNER JOIN `creature_template` `t` ON `c`.`id` = `t`.`entry` "
-        "WHERE (%u - (`t`.`maxlevel` + `t`.`minlevel`) / 2) BETWEEN 0 AND %u AND `c`.`map` IN (%s) "
-        "ORDER BY RAND() LIMIT %u",
-        bot->getLevel(), sPlayerbotAIConfig.randomBotTeleLevel, sPlayerbotAIConfig.randomBotMapsAsString.c_str(),
-        RANDOM_TELEPORT_CANDIDATE_LIMIT);
+    PrepareTeleportCache();
 
-    if (results)
+    // Spawns of creatures at most RandomBotTeleLevel levels below the bot
+    uint32 level = bot->getLevel();
+    uint32 minLevel = level > sPlayerbotAIConfig.randomBotTeleLevel ? level - sPlayerbotAIConfig.randomBotTeleLevel : 0;
+    vector<vector<WorldLocation> const*> bands;
+    size_t total = 0;
+    std::map<uint32, vector<WorldLocation> >::const_iterator end = m_teleportLocsPerLevel.upper_bound(level);
+    for (std::map<uint32, vector<WorldLocation> >::const_iterator i = m_teleportLocsPerLevel.lower_bound(minLevel); i != end; ++i)
     {
-        do
+        bands.push_back(&i->second);
+        total += i->second.size();
+    }
+
+    vector<WorldLocation> locs;
+    for (size_t candidate = 0; candidate < total && candidate < RANDOM_TELEPORT_CANDIDATE_LIMIT; ++candidate)
+    {
+        size_t index = total <= RANDOM_TELEPORT_CANDIDATE_LIMIT ? candidate : urand(0, total - 1);
+        vector<vector<WorldLocation> const*>::const_iterator band = bands.begin();
+        while (index >= (*band)->size())
         {
-            Field* fields = results->Fetch();
-            uint32 mapId = fields[0].GetUInt32();
-            float x = fields[1].GetFloat();
-            float y = fields[2].GetFloat();
-            float z = fields[3].GetFloat();
-            if (IsZoneSafeForBot(bot, mapId, x, y, z))
-            {
-                WorldLocation loc(mapId, x, y, z, 0);
-                locs.push_back(loc);
-            }
-        } while (results->NextRow());
-        delete results;
+            index -= (*band)->size();
+            ++band;
+        }
+
+        WorldLocation const& loc = (**band)[index];
+        if (IsZoneSafeForBot(bot, loc.mapid, loc.coord_x, loc.coord_y, loc.coord_z))
+        {
+            locs.push_back(loc);
+        }
     }
 
     RandomTeleport(bot, locs);
@@ -775,17 +805,16 @@ void RandomPlayerbotMgr::RandomizeFirst(Player* bot)
         int index = urand(0, sPlayerbotAIConfig.randomBotMaps.size() - 1);
         uint32 mapId = sPlayerbotAIConfig.randomBotMaps[index];
 
-        vector<GameTele const*> locs;
+        vector<GameTeleMap::const_iterator> locs;
         GameTeleMap const & teleMap = sObjectMgr.GetGameTeleMap();
         for (GameTeleMap::const_iterator itr = teleMap.begin(); itr != teleMap.end(); ++itr)
         {
-            GameTele const* tele = &itr->second;
             // Collect all teleports on this map; zone safety is checked below
             // against the bot's *target* level (computed from the zone), not the
             // fresh bot's level 1, so a new bot is not confined to low-level zones.
-            if (tele->mapId == mapId)
+            if (itr->second.mapId == mapId)
             {
-                locs.push_back(tele);
+                locs.push_back(itr);
             }
         }
         if (locs.empty()) // no safe locations found, so try another map
@@ -798,8 +827,8 @@ void RandomPlayerbotMgr::RandomizeFirst(Player* bot)
         {
             return;
         }
-        GameTele const* tele = locs[index];
-        uint32 level = GetZoneLevel(tele->mapId, tele->position_x, tele->position_y, tele->position_z);
+        GameTele const* tele = &locs[index]->second;
+        uint32 level = GetZoneLevel(locs[index]->first);
         if (level > maxLevel + 5)
         {
             continue;
@@ -833,34 +862,93 @@ void RandomPlayerbotMgr::RandomizeFirst(Player* bot)
     }
 }
 
-uint32 RandomPlayerbotMgr::GetZoneLevel(uint16 mapId, float teleX, float teleY, float teleZ)
+uint32 RandomPlayerbotMgr::GetZoneLevel(uint32 teleId)
 {
-    uint32 maxLevel = sWorld.getConfig(CONFIG_UINT32_MAX_PLAYER_LEVEL);
+    PrepareTeleportCache();
 
-    uint32 level;
-    QueryResult *results = WorldDatabase.PQuery("SELECT AVG(`t`.`minlevel`) `minlevel`, AVG(`t`.`maxlevel`) `maxlevel` FROM `creature` `c` "
-            "INNER JOIN `creature_template` `t` ON `c`.`id` = `t`.`entry` "
-            "WHERE `map` = '%u' AND `minlevel` > 1 AND ABS(`position_x` - '%f') < '%u' AND ABS(`position_y` - '%f') < '%u'",
-            mapId, teleX, sPlayerbotAIConfig.randomBotTeleportDistance / 2, teleY, sPlayerbotAIConfig.randomBotTeleportDistance / 2);
+    std::unordered_map<uint32, ZoneLevelBand>::const_iterator band = m_teleZoneLevels.find(teleId);
+    if (band == m_teleZoneLevels.end())
+    {
+        return 0;
+    }
 
-    if (results)
+    uint8 minLevel = band->second.minLevelSum / band->second.creatureCount;
+    uint8 maxLevel = band->second.maxLevelSum / band->second.creatureCount;
+    return urand(minLevel, maxLevel);
+}
+
+void RandomPlayerbotMgr::PrepareTeleportCache()
+{
+    if (m_teleportCachePrepared)
     {
-        Field* fields = results->Fetch();
-        uint8 minLevel = fields[0].GetUInt8();
-        uint8 maxLevel = fields[1].GetUInt8();
-        level = urand(minLevel, maxLevel);
-        if (level > maxLevel)
+        return;
+    }
+    m_teleportCachePrepared = true;
+
+    sLog.outString(">> [Playerbots] Preparing random teleport locations...");
+
+    std::set<uint32> maps(sPlayerbotAIConfig.randomBotMaps.begin(), sPlayerbotAIConfig.randomBotMaps.end());
+    float range = sPlayerbotAIConfig.randomBotTeleportDistance / 2;
+
+    // game_tele locations per map, sorted by x so a spawn finds the ones around it with a binary search
+    std::map<uint32, vector<std::pair<float, GameTeleMap::const_iterator> > > teles;
+    GameTeleMap const& teleMap = sObjectMgr.GetGameTeleMap();
+    for (GameTeleMap::const_iterator itr = teleMap.begin(); itr != teleMap.end(); ++itr)
+    {
+        if (maps.find(itr->second.mapId) != maps.end())
         {
-            level = maxLevel;
+            teles[itr->second.mapId].push_back(std::make_pair(itr->second.position_x, itr));
         }
-        delete results;
     }
-    else
+    for (std::map<uint32, vector<std::pair<float, GameTeleMap::const_iterator> > >::iterator i = teles.begin(); i != teles.end(); ++i)
     {
-        level = urand(1, maxLevel);
+        std::sort(i->second.begin(), i->second.end(),
+            [](std::pair<float, GameTeleMap::const_iterator> const& a, std::pair<float, GameTeleMap::const_iterator> const& b) { return a.first < b.first; });
+    }
+
+    uint32 spawns = 0;
+    CreatureDataMap const* creatureDataMap = sObjectMgr.GetCreatureDataMap();
+    for (CreatureDataMap::const_iterator itr = creatureDataMap->begin(); itr != creatureDataMap->end(); ++itr)
+    {
+        CreatureData const& data = itr->second;
+        if (maps.find(data.mapid) == maps.end())
+        {
+            continue;
+        }
+
+        CreatureInfo const* cInfo = sObjectMgr.GetCreatureTemplate(data.id);
+        if (!cInfo)
+        {
+            continue;
+        }
+
+        m_teleportLocsPerLevel[(cInfo->MinLevel + cInfo->MaxLevel) / 2].push_back(WorldLocation(data.mapid, data.posX, data.posY, data.posZ, 0));
+        ++spawns;
+
+        if (cInfo->MinLevel <= 1)
+        {
+            continue;
+        }
+
+        vector<std::pair<float, GameTeleMap::const_iterator> > const& mapTeles = teles[data.mapid];
+        vector<std::pair<float, GameTeleMap::const_iterator> >::const_iterator tele = std::lower_bound(mapTeles.begin(), mapTeles.end(), data.posX - range,
+            [](std::pair<float, GameTeleMap::const_iterator> const& a, float x) { return a.first <= x; });
+        for (; tele != mapTeles.end() && tele->first < data.posX + range; ++tele)
+        {
+            if (fabs(tele->second->second.position_y - data.posY) >= range)
+            {
+                continue;
+            }
+
+            ZoneLevelBand& band = m_teleZoneLevels[tele->second->first];
+            band.minLevelSum += cInfo->MinLevel;
+            band.maxLevelSum += cInfo->MaxLevel;
+            ++band.creatureCount;
+        }
     }
 
-    return level;
+    sLog.outString(">> [Playerbots] Prepared %u random teleport locations in %u level bands, zone levels for %u game_tele locations",
+        spawns, uint32(m_teleportLocsPerLevel.size()), uint32(m_teleZoneLevels.size()));
 }
 
 void RandomPlayerbotMgr::Refresh(Player* bot)
@@ -921,34 +1009,34 @@ bool RandomPlayerbotMgr::IsRandomBot(Player* bot)
 
 bool RandomPlayerbotMgr::IsRandomBot(uint32 bot)
 {
-    std::unordered_map<uint32, bool>::iterator it = m_randomBotCache.find(bot);
-    if (it != m_randomBotCache.end())
+    // A bot stays random while it has an "add" row, even one that has expired
+    // and is waiting for ProcessBot() to retire it
+    std::lock_guard<std::mutex> guard(m_eventValueLock);
+    if (!m_eventValuesLoaded)
     {
-        return it->second;
+        ReadEventValues();
     }
 
-    bool value = (GetEventValue(bot, "add") != 0);
-    m_randomBotCache[bot] = value;
-    return value;
+    std::unordered_map<uint32, BotEventValues>::const_iterator values = m_eventValues.find(bot);
+    return values != m_eventValues.end() && values->second.find("add") != values->second.end();
 }
 
 list<uint32> RandomPlayerbotMgr::GetBots()
 {
     list<uint32> bots;
 
-    // Query the database to get the list of random bots
-    QueryResult* results = CharacterDatabase.Query(
-            "SELECT `bot` FROM `ai_playerbot_random_bots` WHERE `owner` = 0 AND `event` = 'add'");
+    std::lock_guard<std::mutex> guard(m_eventValueLock);
+    if (!m_eventValuesLoaded)
+    {
+        ReadEventValues();
+    }
 
-    if (results)
+    for (std::unordered_map<uint32, BotEventValues>::const_iterator i = m_eventValues.begin(); i != m_eventValues.end(); ++i)
     {
-        do
+        if (i->second.find("add") != i->second.end())
         {
-            Field* fields = results->Fetch();
-            uint32 bot = fields[0].GetUInt32();
-            bots.push_back(bot);
-        } while (results->NextRow());
-        delete results;
+            bots.push_back(i->first);
+        }
     }
 
     return bots;
@@ -1025,134 +1113,352 @@ bool RandomPlayerbotMgr::IsZoneSafeForBot(Player* bot, uint32 mapId, float x, fl
     return true;
 }
 
-QueryResult* RandomPlayerbotMgr::QueryGroupedBots()
+string RandomPlayerbotMgr::GroupedBotsQuery()
 {
     if (sPlayerbotAIConfig.randomBotAccounts.empty())
     {
-        return nullptr;
+        return string();
     }
 
-    ostringstream os;
-    bool first = true;
-    for (list<uint32>::iterator i = sPlayerbotAIConfig.randomBotAccounts.begin(); i != sPlayerbotAIConfig.randomBotAccounts.end(); ++i)
-    {
-        if (!first)
-        {
-            os << ",";
-        }
-        os << *i;
-        first = false;
-    }
-
-    return CharacterDatabase.PQuery(
+    return
         "SELECT gm.`memberGuid` FROM `group_member` gm "
         "INNER JOIN `characters` c ON gm.`memberGuid` = c.`guid` "
         "INNER JOIN `groups` g ON gm.`groupId` = g.`groupId` "
-        "WHERE c.`account` IN (%s)",
-        os.str().c_str());
+        "WHERE c.`account` IN (" + JoinRandomBotAccounts() + ")";
 }
 
 void RandomPlayerbotMgr::LoadGroupedBots()
 {
-    m_groupedBots.clear();
-    QueryResult* result = QueryGroupedBots();
-    if (!result)
+    // The previous refresh is still running; keep using the set it will replace
+    if (m_groupedBotsPending)
     {
         return;
     }
 
-    do
+    string query = GroupedBotsQuery();
+    if (query.empty())
     {
-        Field* fields = result->Fetch();
-        m_groupedBots.insert(fields[0].GetUInt32());
-    } while (result->NextRow());
-    delete result;
+        m_groupedBots.clear();
+        return;
+    }
+
+    m_groupedBotsPending = true;
+    CharacterDatabase.AsyncQuery([this](QueryResult* result)
+                                 {
+                                     m_groupedBotsPending = false;
+                                     m_groupedBots.clear();
+                                     if (!result)
+                                     {
+                                         return;
+                                     }
+
+                                     do
+                                     {
+                                         Field* fields = result->Fetch();
+                                         m_groupedBots.insert(fields[0].GetUInt32());
+                                     } while (result->NextRow());
+                                     delete result;
+                                 },
+                                 query.c_str());
 }
 
 void RandomPlayerbotMgr::EnsureGroupedBotsOnline()
 {
-    QueryResult* result = QueryGroupedBots();
-    if (!result)
+    string query = GroupedBotsQuery();
+    if (query.empty())
+    {
+        return;
+    }
+
+    CharacterDatabase.AsyncQuery([this](QueryResult* result)
+                                 {
+                                     if (!result)
+                                     {
+                                         return;
+                                     }
+
+                                     uint32 count = 0;
+                                     do
+                                     {
+                                         Field* fields = result->Fetch();
+                                         uint32 botGuid = fields[0].GetUInt32();
+                                         if (!GetEventValue(botGuid, "add"))
+                                         {
+                                             SetEventValue(botGuid, "add", 1, sPlayerbotAIConfig.maxRandomBotInWorldTime);
+                                             count++;
+                                         }
+                                     } while (result->NextRow());
+                                     delete result;
+
+                                     if (count > 0)
+                                     {
+                                         sLog.outString("Queued %u grouped bot(s) for login at startup", count);
+                                     }
+                                 },
+                                 query.c_str());
+}
+
+void RandomPlayerbotMgr::LoadEventValues()
+{
+    std::lock_guard<std::mutex> guard(m_eventValueLock);
+    if (!m_eventValuesLoaded)
+    {
+        ReadEventValues();
+    }
+}
+
+void RandomPlayerbotMgr::ReadEventValues()
+{
+    m_eventValues.clear();
+    m_dirtyEventValues.clear();
+    m_eventValuesLoaded = true;
+
+    QueryResult* results = CharacterDatabase.Query(
+            "SELECT `bot`, `event`, `value`, `time`, `validIn` FROM `ai_playerbot_random_bots` WHERE `owner` = 0");
+    if (!results)
     {
+        sLog.outString(">> Loaded 0 random bot event values");
         return;
     }
 
     uint32 count = 0;
     do
     {
-        Field* fields = result->Fetch();
-        uint32 botGuid = fields[0].GetUInt32();
-        if (!GetEventValue(botGuid, "add"))
+        Field* fields = results->Fetch();
+        uint32 value = fields[2].GetUInt32();
+        if (!value)
         {
-            SetEventValue(botGuid, "add", 1, sPlayerbotAIConfig.maxRandomBotInWorldTime);
-            count++;
+            continue;
         }
-    } while (result->NextRow());
-    delete result;
 
-    if (count > 0)
-    {
-        sLog.outString("Queued %u grouped bot(s) for login at startup", count);
-    }
+        EventValueEntry& entry = m_eventValues[fields[0].GetUInt32()][fields[1].GetCppString()];
+        entry.value = value;
+        entry.lastChangeTime = fields[3].GetUInt32();
+        entry.validIn = fields[4].GetUInt32();
+        ++count;
+    } while (results->NextRow());
+    delete results;
+
+    sLog.outString(">> Loaded %u random bot event values for %u bots", count, uint32(m_eventValues.size()));
 }
 
-uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, string event)
+void RandomPlayerbotMgr::ResetEventValues()
+{
+    std::lock_guard<std::mutex> guard(m_eventValueLock);
+    m_eventValues.clear();
+    m_dirtyEventValues.clear();
+    m_eventValuesLoaded = true;
+}
+
+void RandomPlayerbotMgr::FlushEventValues()
 {
-    uint32 value = 0;
+    struct PendingRow
+    {
+        uint32 bot;
+        std::string event;
+        EventValueEntry entry;
+    };
 
-    std::pair<uint32, std::string> key(bot, event);
-    std::map<std::pair<uint32, std::string>, EventValueEntry>::iterator cacheIt = m_eventValueCache.find(key);
-    if (cacheIt != m_eventValueCache.end())
+    // Copy the changed rows out under the lock; the SQL is built without it
+    std::map<std::string, std::vector<uint32> > deletes;
+    std::vector<PendingRow> inserts;
+    bool rewrite = false;
     {
-        if (((uint32)time(0) - cacheIt->second.lastChangeTime) < cacheIt->second.validIn)
+        std::lock_guard<std::mutex> guard(m_eventValueLock);
+
+        // An earlier flush never committed: the table is whatever it was before it,
+        // so write all of it rather than only what changed since
+        rewrite = m_eventValuesLoaded && m_eventFlushFailed->exchange(false);
+        if (rewrite)
         {
-            return cacheIt->second.value;
+            for (std::unordered_map<uint32, BotEventValues>::const_iterator bot = m_eventValues.begin(); bot != m_eventValues.end(); ++bot)
+            {
+                for (BotEventValues::const_iterator row = bot->second.begin(); row != bot->second.end(); ++row)
+                {
+                    PendingRow pending = { bot->first, row->first, row->second };
+                    inserts.push_back(pending);
+                }
+            }
+            m_dirtyEventValues.clear();                     // in the rewrite already
         }
+        else if (m_dirtyEventValues.empty())
+        {
+            return;
+        }
+
+        for (std::set<std::pair<uint32, std::string> >::const_iterator i = m_dirtyEventValues.begin(); i != m_dirtyEventValues.end(); ++i)
+        {
+            deletes[i->second].push_back(i->first);
+
+            std::unordered_map<uint32, BotEventValues>::const_iterator bot = m_eventValues.find(i->first);
+            if (bot == m_eventValues.end())
+            {
+                continue;
+            }
+
+            BotEventValues::const_iterator row = bot->second.find(i->second);
+            if (row != bot->second.end())
+            {
+                PendingRow pending = { i->first, i->second, row->second };
+                inserts.push_back(pending);
+            }
+        }
+        m_dirtyEventValues.clear();
     }
 
-    // Query the database to get the event value for the specified bot
-    QueryResult* results = CharacterDatabase.PQuery(
-            "SELECT `value`, `time`, `validIn` FROM `ai_playerbot_random_bots` WHERE `owner` = 0 AND `bot` = '%u' AND `event` = '%s'",
-            bot, event.c_str());
+    // One transaction: the old rows go per event in chunked IN lists, the new ones
+    // as a run of the same prepared INSERT, which the delay thread sends as
+    // multi-row INSERTs.
+    static uint32 const MAX_BOTS_PER_DELETE = 1000;
 
-    if (results)
+    CharacterDatabase.BeginTransaction();
+    CharacterDatabase.SetTransactionFailureFlag(m_eventFlushFailed);
+    if (rewrite)
     {
-        Field* fields = results->Fetch();
-        value = fields[0].GetUInt32();
-        uint32 lastChangeTime = fields[1].GetUInt32();
-        uint32 validIn = fields[2].GetUInt32();
-        if ((time(0) - lastChangeTime) >= validIn)
+        CharacterDatabase.Execute("DELETE FROM `ai_playerbot_random_bots` WHERE `owner` = 0");
+    }
+    for (std::map<std::string, std::vector<uint32> >::const_iterator i = deletes.begin(); i != deletes.end(); ++i)
+    {
+        for (size_t first = 0; first < i->second.size(); first += MAX_BOTS_PER_DELETE)
         {
-            value = 0;
+            size_t last = std::min(i->second.size(), first + MAX_BOTS_PER_DELETE);
+
+            ostringstream os;
+            os << "DELETE FROM `ai_playerbot_random_bots` WHERE `owner` = 0 AND `event` = '" << i->first << "' AND `bot` IN (";
+            for (size_t j = first; j < last; ++j)
+            {
+                if (j != first)
+                {
+                    os << ",";
+                }
+                os << i->second[j];
+            }
+            os << ")";
+            CharacterDatabase.Execute(os.str().c_str());
         }
-        m_eventValueCache[key] = { value, lastChangeTime, validIn };
-        delete results;
     }
 
-    return value;
+    static SqlStatementID insertEventValue;
+    for (std::vector<PendingRow>::const_iterator i = inserts.begin(); i != inserts.end(); ++i)
+    {
+        SqlStatement stmt = CharacterDatabase.CreateStatement(insertEventValue,
+            "INSERT INTO `ai_playerbot_random_bots` (`owner`, `bot`, `time`, `validIn`, `event`, `value`) VALUES (?, ?, ?, ?, ?, ?)");
+        stmt.addUInt32(0);
+        stmt.addUInt32(i->bot);
+        stmt.addUInt32(i->entry.lastChangeTime);
+        stmt.addUInt32(i->entry.validIn);
+        stmt.addString(i->event);
+        stmt.addUInt32(i->entry.value);
+        stmt.Execute();
+    }
+
+    if (!CharacterDatabase.CommitTransaction())
+    {
+        m_eventFlushFailed->store(true);
+    }
+}
+
+uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, string event)
+{
+    std::lock_guard<std::mutex> guard(m_eventValueLock);
+    if (!m_eventValuesLoaded)
+    {
+        ReadEventValues();
+    }
+
+    std::unordered_map<uint32, BotEventValues>::const_iterator values = m_eventValues.find(bot);
+    if (values == m_eventValues.end())
+    {
+        return 0;
+    }
+
+    BotEventValues::const_iterator row = values->second.find(event);
+    if (row == values->second.end())
+    {
+        return 0;
+    }
+
+    if (((uint32)time(0) - row->second.lastChangeTime) >= row->second.validIn)
+    {
+        return 0;
+    }
+
+    return row->second.value;
+}
+
+uint32 RandomPlayerbotMgr::GetEventValidIn(uint32 bot, string event)
+{
+    std::lock_guard<std::mutex> guard(m_eventValueLock);
+    if (!m_eventValuesLoaded)
+    {
+        ReadEventValues();
+    }
+
+    std::unordered_map<uint32, BotEventValues>::const_iterator values = m_eventValues.find(bot);
+    if (values == m_eventValues.end())
+    {
+        return 0;
+    }
+
+    BotEventValues::const_iterator row = values->second.find(event);
+    return row != values->second.end() ? row->second.validIn : 0;
 }
 
 uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, string event, uint32 value, uint32 validIn)
 {
-    // Delete the existing event value for the specified bot
-    CharacterDatabase.PExecute("DELETE FROM `ai_playerbot_random_bots` WHERE `owner` = 0 and `bot` = '%u' and `event` = '%s'",
-            bot, event.c_str());
+    std::lock_guard<std::mutex> guard(m_eventValueLock);
+    if (!m_eventValuesLoaded)
+    {
+        ReadEventValues();
+    }
+
+    // Like the table, a zero value is no row at all
     if (value)
     {
-        // Insert the new event value for the specified bot
-        CharacterDatabase.PExecute(
-                "INSERT INTO `ai_playerbot_random_bots` (`owner`, `bot`, `time`, `validIn`, `event`, `value`) VALUES ('%u', '%u', '%u', '%u', '%s', '%u')",
-                0, bot, (uint32)time(0), validIn, event.c_str(), value);
+        EventValueEntry& entry = m_eventValues[bot][event];
+        entry.value = value;
+        entry.lastChangeTime = (uint32)time(0);
+        entry.validIn = validIn;
+    }
+    else
+    {
+        std::unordered_map<uint32, BotEventValues>::iterator values = m_eventValues.find(bot);
+        if (values != m_eventValues.end())
+        {
+            values->second.erase(event);
+            if (values->second.empty())
+            {
+                m_eventValues.erase(values);
+            }
+        }
+    }
+
+    m_dirtyEventValues.insert(std::make_pair(bot, event));
+    return value;
+}
+
+void RandomPlayerbotMgr::SetEventValidIn(uint32 bot, string event, uint32 validIn)
+{
+    std::lock_guard<std::mutex> guard(m_eventValueLock);
+    if (!m_eventValuesLoaded)
+    {
+        ReadEventValues();
     }
 
-    if (event == "add")
+    std::unordered_map<uint32, BotEventValues>::iterator values = m_eventValues.find(bot);
+    if (values == m_eventValues.end())
     {
-        m_randomBotCache[bot] = (value != 0);
+        return;
     }
 
-    m_eventValueCache[std::make_pair(bot, event)] = { value, (uint32)time(0), validIn };
+    BotEventValues::iterator row = values->second.find(event);
+    if (row == values->second.end())
+    {
+        return;
+    }
 
-    return value;
+    row->second.validIn = validIn;
+    m_dirtyEventValues.insert(std::make_pair(bot, event));
 }
 
 void RandomPlayerbotMgr::CalculateAreaCreatureStats()
@@ -1287,6 +1593,7 @@ bool RandomPlayerbotMgr::HandlePlayerbotConsoleCommand(ChatHandler* handler, cha
     {
         // Reset all random bots
         CharacterDatabase.PExecute("DELETE FROM `ai_playerbot_random_bots`");
+        sRandomPlayerbotMgr.ResetEventValues();
         sLog.outString("Random bots were reset for all players. Please restart the Server.");
         return true;
     }
@@ -1360,11 +1667,10 @@ bool RandomPlayerbotMgr::HandlePlayerbotConsoleCommand(ChatHandler* handler, cha
                 sRandomPlayerbotMgr.IncreaseLevel(bot);
             }
             uint32 randomTime = urand(sPlayerbotAIConfig.minRandomBotRandomizeTime, sPlayerbotAIConfig.maxRandomBotRandomizeTime);
-            CharacterDatabase.PExecute("UPDATE `ai_playerbot_random_bots` SET `validIn` = '%u' WHERE `event` = 'randomize' AND `bot` = '%u'",
-                randomTime, bot->GetGUIDLow());
-            CharacterDatabase.PExecute("UPDATE `ai_playerbot_random_bots` SET `validIn` = '%u' WHERE `event` = 'logout' AND `bot` = '%u'",
-                sPlayerbotAIConfig.maxRandomBotInWorldTime, bot->GetGUIDLow());
+            sRandomPlayerbotMgr.SetEventValidIn(bot->GetGUIDLow(), "randomize", randomTime);
+            sRandomPlayerbotMgr.SetEventValidIn(bot->GetGUIDLow(), "logout", sPlayerbotAIConfig.maxRandomBotInWorldTime);
         }
+        sRandomPlayerbotMgr.FlushEventValues();
         return true;
     }
     else
@@ -1504,6 +1810,28 @@ bool RandomPlayerbotMgr::HasRealPlayerInZone(uint32 zoneId) const
     return zi != m_playerZoneCounts.end() && zi->second > 0;
 }
 
+bool RandomPlayerbotMgr::HasRealPlayerInSight(Player* bot) const
+{
+    // Real players are few next to the bots, so a scan beats a grid search per bot
+    Map* map = bot->GetMap();
+    float range = map->GetVisibilityDistance();
+    for (vector<Player*>::const_iterator i = players.begin(); i != players.end(); ++i)
+    {
+        Player* player = *i;
+        if (player->GetPlayerbotAI() || player->GetMap() != map)
+        {
+            continue;
+        }
+
+        if (bot->Where().WithinDist(player->Where(), range, false))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 Player* RandomPlayerbotMgr::GetRandomPlayer()
 {
     // Get a random player from the list of players
@@ -1538,9 +1866,11 @@ void RandomPlayerbotMgr::PrintStats()
     }
 
     int dps = 0, heal = 0, tank = 0, active = 0;
+    uint32 perTier[BOT_TICK_TIERS] = { 0 };
     for (PlayerBotMap::iterator i = playerBots.begin(); i != playerBots.end(); ++i)
     {
         Player* bot = i->second;
+        perTier[bot->GetPlayerbotAI()->GetTickTier()]++;
         if (IsAlliance(bot->getRace()))
         {
             alliance[bot->getLevel() / 10]++;
@@ -1660,6 +1990,17 @@ void RandomPlayerbotMgr::PrintStats()
     sLog.outString("    dps: %d", dps);
 
     sLog.outString("Active bots: %d", active);
+
+    static char const* const tierNames[BOT_TICK_TIERS] = { "full", "reduced", "idle" };
+    sLog.outString("Per tick rate (since last stats):");
+    for (int tier = 0; tier < BOT_TICK_TIERS; ++tier)
+    {
+        BotTickAccounting::Totals totals = m_tickAccounting.Get(BotTickTier(tier));
+        sLog.outString("    %s: %u bots, %u updates run, %u held back, %.1f ms (%.1f us/update)",
+            tierNames[tier], perTier[tier], uint32(totals.runs), uint32(totals.skips),
+            totals.micros / 1000.0, totals.runs ? double(totals.micros) / totals.runs : 0.0);
+    }
+    m_tickAccounting.Reset();
 }
 
 double RandomPlayerbotMgr::GetBuyMultiplier(Player* bot)
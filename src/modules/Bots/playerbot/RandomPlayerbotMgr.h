@@ -4,6 +4,10 @@
 #include "Common.h"
 #include "PlayerbotAIBase.h"
 #include "PlayerbotMgr.h"
+#include "BotTickScheduler.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 class WorldPacket;
@@ -140,6 +144,12 @@ class RandomPlayerbotMgr : public PlayerbotHolder
         /// True if at least one real (non-bot) player is currently in the given zone.
         bool HasRealPlayerInZone(uint32 zoneId) const;
 
+        /// True if a real (non-bot) player on the bot's map is within visibility distance of it.
+        bool HasRealPlayerInSight(Player* bot) const;
+
+        /// CPU time spent on bot updates per tick tier, reported and reset by PrintStats().
+        BotTickAccounting& GetTickAccounting() { return m_tickAccounting; }
+
         /**
          * @brief Gets a random player.
          * @return Pointer to the random player.
@@ -200,10 +210,31 @@ class RandomPlayerbotMgr : public PlayerbotHolder
 
         /// Queues every bot in a persisted group for login (used when AiPlayerbot.RandomBotKeepGroups is set).
         void EnsureGroupedBotsOnline();
-        /// Refreshes m_groupedBots from the character DB.
+        /// Refreshes m_groupedBots from the character DB, asynchronously.
         void LoadGroupedBots();
-        /// Underlying query shared by EnsureGroupedBotsOnline/LoadGroupedBots.
-        QueryResult* QueryGroupedBots();
+        /// Underlying query shared by EnsureGroupedBotsOnline/LoadGroupedBots; empty if there are no bot accounts.
+        string GroupedBotsQuery();
+
+        /**
+         * @brief Loads the whole `ai_playerbot_random_bots` table into memory.
+         * Called once at startup; every later read is served from memory.
+         */
+        void LoadEventValues();
+
+        /**
+         * @brief Indexes the creature spawns of the random bot maps for the random teleports.
+         * Called once at startup, from the spawns ObjectMgr already holds, so that
+         * RandomTeleportForLevel() and GetZoneLevel() never query the world DB.
+         */
+        void PrepareTeleportCache();
+
+        /**
+         * @brief Writes the event values changed since the last flush.
+         * The rows go out as one transaction through the character DB delay thread.
+         * If an earlier flush did not commit, the whole table is rewritten instead,
+         * since which of its rows made it is not known.
+         */
+        void FlushEventValues();
 
         /**
          * @brief Teleports the given player bot to a random location.
@@ -260,6 +291,28 @@ class RandomPlayerbotMgr : public PlayerbotHolder
          */
         uint32 SetEventValue(uint32 bot, string event, uint32 value, uint32 validIn);
 
+        /**
+         * @brief Gets how long an event value is valid for, whether or not it has expired.
+         * @param bot The player ID.
+         * @param event The event name.
+         * @return The validity duration, or 0 if the bot has no such event.
+         */
+        uint32 GetEventValidIn(uint32 bot, string event);
+
+        /**
+         * @brief Changes how long an existing event value stays valid, keeping its value and start time.
+         * @param bot The player ID.
+         * @param event The event name.
+         * @param validIn The new validity duration of the event.
+         */
+        void SetEventValidIn(uint32 bot, string event, uint32 validIn);
+
+        /// Fills the in-memory event values from the DB; the caller holds m_eventValueLock.
+        void ReadEventValues();
+
+        /// Drops every in-memory event value, including unwritten changes (after `rndbot reset`).
+        void ResetEventValues();
+
         /**
          * @brief Gets the list of random player bots.
          * @return The list of random player bots.
@@ -268,9 +321,16 @@ class RandomPlayerbotMgr : public PlayerbotHolder
 
         /**
          * @brief Adds random player bots.
+         * The bot accounts' characters are read asynchronously; the bots are added once they arrive.
+         */
+        void AddRandomBots();
+
+        /**
+         * @brief Adds random player bots from the characters of the random bot accounts.
+         * @param results The `guid`, `race`, `account` rows of those characters, or NULL.
          * @return The number of random player bots added.
          */
-        uint32 AddRandomBots();
+        uint32 AddRandomBots(QueryResult* results);
 
         /**
          * @brief Processes the given player bot.
@@ -294,14 +354,11 @@ class RandomPlayerbotMgr : public PlayerbotHolder
         void RandomTeleport(Player* bot, vector<WorldLocation> &locs);
 
         /**
-         * @brief Gets the level of a zone based on its coordinates.
-         * @param mapId The map ID.
-         * @param teleX The X coordinate.
-         * @param teleY The Y coordinate.
-         * @param teleZ The Z coordinate.
-         * @return The level of the zone.
+         * @brief Gets the level of the zone around a game_tele location.
+         * @param teleId The game_tele entry, on one of the random bot maps.
+         * @return A level within the average creature level band around it, 0 if no creature is near.
          */
-        uint32 GetZoneLevel(uint16 mapId, float teleX, float teleY, float teleZ);
+        uint32 GetZoneLevel(uint32 teleId);
         bool IsZoneSafeForBot(Player* bot, uint32 mapId, float x, float y, float z, uint32 useLevel = 0);
         void CalculateAreaCreatureStats();
 
@@ -315,18 +372,37 @@ class RandomPlayerbotMgr : public PlayerbotHolder
         std::map<uint32, AreaCreatureStats> m_areaCreatureStatsMap;
         std::map<std::pair<uint32, uint32>, uint32> m_cellToAreaCache;
         bool m_areaCreatureStatsComputed = false; ///< Guards the one-time area-stats scan so an empty result is not recomputed every call.
-        std::unordered_map<uint32, bool> m_randomBotCache; ///< Caches IsRandomBot("add") lookups to avoid a DB query per call; kept coherent in SetEventValue.
         std::unordered_map<uint32, uint32> m_playerZoneCounts; ///< zone_id -> real player count, for O(1) bot tick gating.
         std::set<uint32> m_groupedBots; ///< Cached set of bot GUIDs currently in a group, refreshed each update cycle.
 
-        /// Cached mirror of one `ai_playerbot_random_bots` row.
+        /// Creature level sums around one game_tele location, see GetZoneLevel().
+        struct ZoneLevelBand
+        {
+            uint32 minLevelSum;
+            uint32 maxLevelSum;
+            uint32 creatureCount;
+        };
+        std::map<uint32, vector<WorldLocation> > m_teleportLocsPerLevel; ///< (minlevel + maxlevel) / 2 -> spawns of such creatures on the random bot maps.
+        std::unordered_map<uint32, ZoneLevelBand> m_teleZoneLevels; ///< game_tele id -> levels of the creatures near it with a minlevel above 1.
+        bool m_teleportCachePrepared;
+        BotTickAccounting m_tickAccounting;
+
+        bool m_addBotsPending; ///< An AddRandomBots() character query is in flight.
+        bool m_groupedBotsPending; ///< A LoadGroupedBots() query is in flight.
+
+        /// In-memory copy of one `ai_playerbot_random_bots` row.
         struct EventValueEntry
         {
             uint32 value;
             uint32 lastChangeTime;
             uint32 validIn;
         };
-        std::map<std::pair<uint32, std::string>, EventValueEntry> m_eventValueCache; ///< (bot, event) -> cached value, avoids a DB query per GetEventValue call.
+        typedef std::unordered_map<std::string, EventValueEntry> BotEventValues;
+        std::unordered_map<uint32, BotEventValues> m_eventValues; ///< bot -> event -> row; the whole table, rows with a zero value are absent as in the DB.
+        std::set<std::pair<uint32, std::string> > m_dirtyEventValues; ///< (bot, event) rows changed in memory but not yet written back.
+        bool m_eventValuesLoaded;
+        std::mutex m_eventValueLock; ///< Guards the three above; bot actions read prices and loot from map update threads.
+        std::shared_ptr<std::atomic<bool> > m_eventFlushFailed; ///< Set by a flush transaction that did not commit.
         std::set<uint32> m_allianceGuardAreas; ///< Contested areas whose guards are hostile to Horde; Horde bots are kept out.
         std::set<uint32> m_hordeGuardAreas;    ///< Contested areas whose guards are hostile to Alliance; Alliance bots are kept out.
 };
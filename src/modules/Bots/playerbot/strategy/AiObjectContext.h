@@ -21,23 +21,37 @@ namespace ai
         virtual Action* GetAction(string name) { return actionContexts.GetObject(name, ai); }
         virtual UntypedValue* GetUntypedValue(string name) { return valueContexts.GetObject(name, ai); }
 
+        virtual UntypedValue* GetUntypedValue(SymbolId id) { return valueContexts.GetObject(id, ai); }
+
+        // Values are looked up by interned id; neither a qualified name nor a number is formatted after the first lookup
+        template<class T>
+        Value<T>* GetValue(string_view name)
+        {
+            size_t found = name.find("::");
+            if (found != string_view::npos)
+            {
+                return GetValue<T>(name.substr(0, found), name.substr(found + 2));
+            }
+
+            return GetValue<T>(SymbolTable<UntypedValue>::Intern(name));
+        }
+
         template<class T>
-        Value<T>* GetValue(string name)
+        Value<T>* GetValue(SymbolId id)
         {
-            return dynamic_cast<Value<T>*>(GetUntypedValue(name));
+            return Typed<T>(GetUntypedValue(id));
         }
 
         template<class T>
-        Value<T>* GetValue(string name, string param)
+        Value<T>* GetValue(string_view name, string_view param)
         {
-            return GetValue<T>((string(name) + "::" + param));
+            return Typed<T>(valueContexts.GetQualifiedObject(SymbolTable<UntypedValue>::Intern(name), SymbolTable<QualifierSymbol>::Intern(param), ai));
         }
 
         template<class T>
-        Value<T>* GetValue(string name, uint32 param)
+        Value<T>* GetValue(string_view name, uint32 param)
         {
-            ostringstream out; out << param;
-            return GetValue<T>(name, out.str());
+            return Typed<T>(valueContexts.GetNumberedObject(SymbolTable<UntypedValue>::Intern(name), param, ai));
         }
 
         set<string> GetSupportedStrategies()
@@ -76,6 +90,13 @@ namespace ai
             valueContexts.Add(sharedValues);
         }
 
+    private:
+        template<class T>
+        static Value<T>* Typed(UntypedValue* value)
+        {
+            return value ? value->As<T>() : NULL;
+        }
+
     protected:
         NamedObjectContextList<Strategy> strategyContexts;
         NamedObjectContextList<Action> actionContexts;
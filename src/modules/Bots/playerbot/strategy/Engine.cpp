@@ -87,19 +87,21 @@ void Engine::Reset()
         delete action;
     } while (true);
 
-    for (list<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
+    for (vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
     {
         TriggerNode* trigger = *i;
         delete trigger;
     }
     triggers.clear();
 
-    for (list<Multiplier*>::iterator i = multipliers.begin(); i != multipliers.end(); i++)
+    for (vector<Multiplier*>::iterator i = multipliers.begin(); i != multipliers.end(); i++)
     {
         Multiplier* multiplier = *i;
         delete multiplier;
     }
     multipliers.clear();
+
+    fires.clear();
 }
 
 // Initializes the engine by resetting it and initializing strategies
@@ -107,14 +109,19 @@ void Engine::Init()
 {
     Reset();
 
+    // Strategies hand out lists, the engine walks them every tick as flat arrays
+    list<Multiplier*> strategyMultipliers;
+    list<TriggerNode*> strategyTriggers;
     for (map<string, Strategy*>::iterator i = strategies.begin(); i != strategies.end(); i++)
     {
         Strategy* strategy = i->second;
-        strategy->InitMultipliers(multipliers);
-        strategy->InitTriggers(triggers);
+        strategy->InitMultipliers(strategyMultipliers);
+        strategy->InitTriggers(strategyTriggers);
         Event emptyEvent;
         MultiplyAndPush(strategy->getDefaultActions(), 0.0f, false, emptyEvent, "default");
     }
+    multipliers.assign(strategyMultipliers.begin(), strategyMultipliers.end());
+    triggers.assign(strategyTriggers.begin(), strategyTriggers.end());
 
     if (testMode)
     {
@@ -137,8 +144,14 @@ bool Engine::DoNextAction(Unit* unit, int depth)
     ActionBasket* basket = NULL;
 
     time_t currentTime = time(0);
-    aiObjectContext->Update();
-    ProcessTriggers();
+
+    // The triggers are looked at once per tick; the passes below that only refill
+    // an emptied queue with default actions do not evaluate them again
+    if (!depth)
+    {
+        Think();
+        ProcessTriggers();
+    }
 
     int iterations = 0;
     int iterationsPerTick = queue.Size() * sPlayerbotAIConfig.iterationsPerTick;
@@ -160,7 +173,7 @@ bool Engine::DoNextAction(Unit* unit, int depth)
             }
             else if (action->isUseful())
             {
-                for (list<Multiplier*>::iterator i = multipliers.begin(); i!= multipliers.end(); i++)
+                for (vector<Multiplier*>::iterator i = multipliers.begin(); i!= multipliers.end(); i++)
                 {
                     Multiplier* multiplier = *i;
                     relevance *= multiplier->GetValue(action);
@@ -418,11 +431,14 @@ bool Engine::HasStrategy(const string& name)
     return strategies.find(name) != strategies.end();
 }
 
-// Processes triggers and fires events
-void Engine::ProcessTriggers()
+// Updates values and checks triggers, remembering the events of those that fired
+void Engine::Think()
 {
-    map<Trigger*, Event> fires;
-    for (list<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
+    aiObjectContext->Update();
+
+    // Few triggers fire per tick, a flat list beats a map built and torn down every tick
+    fires.clear();
+    for (vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
     {
         TriggerNode* node = *i;
         if (!node)
@@ -449,31 +465,64 @@ void Engine::ProcessTriggers()
             {
                 continue;
             }
-            fires[trigger] = event;
+            SetFired(trigger, event);
             LogAction("T:%s", trigger->getName().c_str());
         }
     }
+}
 
-    for (list<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
+// Queues the handlers of the triggers the last Think() saw fire
+void Engine::ProcessTriggers()
+{
+    if (!fires.empty())
     {
-        TriggerNode* node = *i;
-        Trigger* trigger = node->getTrigger();
-        Event event = fires[trigger];
-        if (!event)
+        for (vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
         {
-            continue;
-        }
+            TriggerNode* node = *i;
+            Event const* event = GetFired(node->getTrigger());
+            if (!event)
+            {
+                continue;
+            }
 
-        MultiplyAndPush(node->getHandlers(), 0.0f, false, event, "trigger");
+            MultiplyAndPush(node->getHandlers(), 0.0f, false, *event, "trigger");
+        }
     }
 
-    for (list<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
+    for (vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
     {
         Trigger* trigger = (*i)->getTrigger();
         if (trigger) trigger->Reset();
     }
 }
 
+// Records the event a trigger fired with, a trigger shared by several nodes keeps its last event
+void Engine::SetFired(Trigger* trigger, Event const& event)
+{
+    for (vector<pair<Trigger*, Event> >::iterator i = fires.begin(); i != fires.end(); i++)
+    {
+        if (i->first == trigger)
+        {
+            i->second = event;
+            return;
+        }
+    }
+    fires.push_back(make_pair(trigger, event));
+}
+
+// Returns the event a trigger fired with this tick, NULL if it did not fire
+Event const* Engine::GetFired(Trigger* trigger) const
+{
+    for (vector<pair<Trigger*, Event> >::const_iterator i = fires.begin(); i != fires.end(); i++)
+    {
+        if (i->first == trigger)
+        {
+            return &i->second;
+        }
+    }
+    return NULL;
+}
+
 // Pushes default actions to the queue
 void Engine::PushDefaultActions()
 {
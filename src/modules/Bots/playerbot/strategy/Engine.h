@@ -130,7 +130,10 @@ namespace ai
     private:
         bool MultiplyAndPush(NextAction** actions, float forceRelevance, bool skipPrerequisites, Event event, const char* pushType);
         void Reset();
+        void Think();
         void ProcessTriggers();
+        void SetFired(Trigger* trigger, Event const& event);
+        Event const* GetFired(Trigger* trigger) const;
         void PushDefaultActions();
         void PushAgain(ActionNode* actionNode, float relevance, Event event);
         ActionNode* CreateActionNode(string name);
@@ -143,8 +146,9 @@ namespace ai
 
     protected:
         Queue queue; /**< Queue for managing actions */
-        std::list<TriggerNode*> triggers; /**< List of triggers */
-        std::list<Multiplier*> multipliers; /**< List of multipliers */
+        std::vector<TriggerNode*> triggers; /**< Triggers of all strategies, flattened by Init() */
+        std::vector<Multiplier*> multipliers; /**< Multipliers of all strategies, flattened by Init() */
+        std::vector<std::pair<Trigger*, Event> > fires; /**< Triggers fired this tick, reused between ticks */
         AiObjectContext* aiObjectContext; /**< AI object context */
         std::map<string, Strategy*> strategies; /**< Map of strategies */
         float lastRelevance; /**< Last relevance value */
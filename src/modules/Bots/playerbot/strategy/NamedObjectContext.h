@@ -1,5 +1,9 @@
 #pragma once
 
+#include <sstream>
+#include <vector>
+#include "SymbolTable.h"
+
 namespace ai
 {
     using namespace std;
@@ -33,12 +37,13 @@ namespace ai
                 name = name.substr(0, found);
             }
 
-            if (creators.find(name) == creators.end())
+            typename map<string, ActionCreator>::const_iterator itr = creators.find(name);
+            if (itr == creators.end())
             {
                 return NULL;
             }
 
-            ActionCreator creator = creators[name];
+            ActionCreator creator = itr->second;
             if (!creator)
             {
                 return NULL;
@@ -74,12 +79,13 @@ namespace ai
 
         T* create(string name, PlayerbotAI* ai)
         {
-            if (created.find(name) == created.end())
+            typename map<string, T*>::const_iterator found = created.find(name);
+            if (found == created.end())
             {
                 return created[name] = NamedObjectFactory<T>::create(name, ai);
             }
 
-            return created[name];
+            return found->second;
         }
 
         virtual ~NamedObjectContext()
@@ -159,16 +165,77 @@ namespace ai
         void Add(NamedObjectContext<T>* context)
         {
             contexts.push_back(context);
+
+            // A new context may resolve names the others did not
+            byId.clear();
+            byQualifiedId.clear();
         }
 
         T* GetObject(string name, PlayerbotAI* ai)
         {
-            for (typename list<NamedObjectContext<T>*>::iterator i = contexts.begin(); i != contexts.end(); i++)
+            size_t found = name.find("::");
+            if (found == string::npos)
             {
-                T* object = (*i)->create(name, ai);
-                if (object) return object;
+                return GetObject(SymbolTable<T>::Intern(name), ai);
             }
-            return NULL;
+
+            return GetQualifiedObject(SymbolTable<T>::Intern(string_view(name).substr(0, found)),
+                SymbolTable<QualifierSymbol>::Intern(string_view(name).substr(found + 2)), ai);
+        }
+
+        /**
+         * @brief Looks an object up by interned name, resolving it by name only the first time.
+         */
+        T* GetObject(SymbolId id, PlayerbotAI* ai)
+        {
+            if (id < byId.size() && byId[id].resolved)
+            {
+                return byId[id].object;
+            }
+
+            T* object = Create(SymbolTable<T>::GetName(id), ai);
+            if (id >= byId.size())
+            {
+                byId.resize(id + 1);
+            }
+            byId[id].object = object;
+            byId[id].resolved = true;
+            return object;
+        }
+
+        /**
+         * @brief Looks a qualified object ("name::qualifier") up by interned name and qualifier.
+         */
+        T* GetQualifiedObject(SymbolId id, SymbolId qualifier, PlayerbotAI* ai)
+        {
+            uint64 key = (uint64(id) << 32) | qualifier;
+            typename unordered_map<uint64, T*>::const_iterator found = byQualifiedId.find(key);
+            if (found != byQualifiedId.end())
+            {
+                return found->second;
+            }
+
+            T* object = Create(SymbolTable<T>::GetName(id) + "::" + SymbolTable<QualifierSymbol>::GetName(qualifier), ai);
+            byQualifiedId[key] = object;
+            return object;
+        }
+
+        /**
+         * @brief Looks a numerically qualified object ("name::123") up without formatting the number.
+         */
+        T* GetNumberedObject(SymbolId id, uint32 param, PlayerbotAI* ai)
+        {
+            uint64 key = (uint64(1) << 63) | (uint64(id) << 32) | param;
+            typename unordered_map<uint64, T*>::const_iterator found = byQualifiedId.find(key);
+            if (found != byQualifiedId.end())
+            {
+                return found->second;
+            }
+
+            ostringstream out; out << SymbolTable<T>::GetName(id) << "::" << param;
+            T* object = Create(out.str(), ai);
+            byQualifiedId[key] = object;
+            return object;
         }
 
         void Update()
@@ -246,7 +313,28 @@ namespace ai
         }
 
     private:
+        T* Create(string name, PlayerbotAI* ai)
+        {
+            for (typename list<NamedObjectContext<T>*>::iterator i = contexts.begin(); i != contexts.end(); i++)
+            {
+                T* object = (*i)->create(name, ai);
+                if (object) return object;
+            }
+            return NULL;
+        }
+
+    private:
+        struct Slot
+        {
+            Slot() : object(NULL), resolved(false) {}
+
+            T* object;
+            bool resolved;
+        };
+
         list<NamedObjectContext<T>*> contexts;
+        vector<Slot> byId;                                  // Indexed by SymbolTable<T> id
+        unordered_map<uint64, T*> byQualifiedId;            // See GetQualifiedObject() and GetNumberedObject()
     };
 
     template <class T> class NamedObjectFactoryList
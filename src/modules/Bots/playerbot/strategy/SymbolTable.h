@@ -0,0 +1,103 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ai
+{
+    using namespace std;
+
+    typedef uint32 SymbolId;
+
+    /**
+     * @brief Tag for the table holding the parameter part of qualified names ("name::parameter").
+     */
+    struct QualifierSymbol {};
+
+    /**
+     * @brief Process wide table of interned names, one dense id space per kind of object.
+     *
+     * Strategy, action, trigger and value names are interned once, the first time they
+     * are used, so bot contexts can keep their objects in flat arrays indexed by id
+     * instead of string maps. Ids are never reused and names are never dropped.
+     *
+     * Lookups go through a per thread cache first, so bots updated on different map
+     * threads only take the table lock for names their thread has not seen yet.
+     *
+     * @tparam KIND The kind of object the names belong to; only used to separate id spaces.
+     */
+    template <class KIND> class SymbolTable
+    {
+    public:
+        /**
+         * @brief Returns the id of a name, interning it on first use.
+         *
+         * @param name The name.
+         * @return SymbolId The dense id, stable for the lifetime of the process.
+         */
+        static SymbolId Intern(string_view name)
+        {
+            thread_local unordered_map<string_view, SymbolId> seen;
+
+            unordered_map<string_view, SymbolId>::const_iterator found = seen.find(name);
+            if (found != seen.end())
+            {
+                return found->second;
+            }
+
+            Storage& storage = GetStorage();
+            std::lock_guard<std::mutex> guard(storage.lock);
+
+            unordered_map<string_view, SymbolId>::const_iterator known = storage.ids.find(name);
+            if (known == storage.ids.end())
+            {
+                storage.names.push_back(string(name));
+                known = storage.ids.insert(make_pair(string_view(storage.names.back()), SymbolId(storage.names.size() - 1))).first;
+            }
+
+            // Keys view the table's own copy of the name, which never moves
+            seen.insert(*known);
+            return known->second;
+        }
+
+        /**
+         * @brief Returns the name of an interned id.
+         *
+         * @param id The id, as returned by Intern().
+         * @return string The name.
+         */
+        static string GetName(SymbolId id)
+        {
+            Storage& storage = GetStorage();
+            std::lock_guard<std::mutex> guard(storage.lock);
+            return id < storage.names.size() ? storage.names[id] : string();
+        }
+
+        /**
+         * @brief Returns the number of names interned so far.
+         */
+        static uint32 Size()
+        {
+            Storage& storage = GetStorage();
+            std::lock_guard<std::mutex> guard(storage.lock);
+            return uint32(storage.names.size());
+        }
+
+    private:
+        struct Storage
+        {
+            std::mutex lock;
+            deque<string> names;                                // indexed by id, a deque so names never move
+            unordered_map<string_view, SymbolId> ids;
+        };
+
+        static Storage& GetStorage()
+        {
+            static Storage storage;
+            return storage;
+        }
+    };
+};
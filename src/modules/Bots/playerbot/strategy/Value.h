@@ -1,4 +1,5 @@
 #pragma once
+#include <typeinfo>
 #include "Action.h"
 #include "Event.h"
 #include "../PlayerbotAIAware.h"
@@ -6,16 +7,30 @@
 
 namespace ai
 {
+    template<class T> class Value;
+
     /**
      * @brief Base class for untyped values.
      */
     class UntypedValue : public AiNamedObject
     {
     public:
-        UntypedValue(PlayerbotAI* ai, string name) : AiNamedObject(ai, name) {}
+        UntypedValue(PlayerbotAI* ai, string name) : AiNamedObject(ai, name), castType(NULL), castValue(NULL) {}
         virtual void Update() {}
         virtual void Reset() {}
         virtual string Format() { return "?"; }
+
+        /**
+         * @brief Typed view of this value, NULL if it does not hold a T.
+         *
+         * The cross cast is done once and kept, a value is almost always read as one type.
+         */
+        template<class T>
+        Value<T>* As();
+
+    private:
+        std::type_info const* castType;                          // Type the last cast was made to
+        void* castValue;                                    // Result of that cast
     };
 
     /**
@@ -32,6 +47,17 @@ namespace ai
         operator T() { return Get(); }
     };
 
+    template<class T>
+    Value<T>* UntypedValue::As()
+    {
+        if (castType != &typeid(Value<T>))
+        {
+            castValue = dynamic_cast<Value<T>*>(this);
+            castType = &typeid(Value<T>);
+        }
+        return static_cast<Value<T>*>(castValue);
+    }
+
     /**
      * @brief Template class for calculated values.
      *
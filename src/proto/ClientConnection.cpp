@@ -421,22 +421,35 @@ namespace proto
 
         m_gateway.TracePacket(m_traceSession.load(std::memory_order_relaxed), packet, false);
 
-        std::vector<uint8_t> wire;
+        PacketCodec::HeaderEncryptor encryptor = [this](uint8* header, size_t len)
         {
-            // The cipher is a stream: two threads encrypting headers concurrently
-            // would interleave the keystream and desynchronise the client for good.
-            std::lock_guard<std::mutex> lock(m_cryptSendLock);
-            wire = PacketCodec::Encode(packet,
-                [this](uint8* header, size_t len)
-                {
-                    if (m_crypt.IsInitialized())
-                    {
-                        m_crypt.EncryptSend(header, len);
-                    }
-                });
+            if (m_crypt.IsInitialized())
+            {
+                m_crypt.EncryptSend(header, len);
+            }
+        };
+
+        // The cipher is a stream: two threads encrypting headers concurrently would
+        // interleave the keystream and desynchronise the client for good. The bytes
+        // are queued under the same lock, so headers also reach the wire in the
+        // order they were encrypted.
+        std::lock_guard<std::mutex> lock(m_cryptSendLock);
+
+        if (!m_gatherSender)
+        {
+            std::vector<uint8_t> wire = PacketCodec::Encode(packet, encryptor);
+            m_sender(wire.data(), wire.size());
+            return;
         }
 
-        m_sender(wire.data(), wire.size());
+        // Only the header is this connection's own. The body goes to the transport
+        // straight out of the packet, which a broadcast builds once and hands to
+        // every recipient, so a packet to N players costs N headers and N copies
+        // into the send queues -- no per-recipient encode or buffer.
+        uint8 header[MAX_SERVER_HEADER_SIZE];
+        size_t headerLen = PacketCodec::EncodeHeader(packet, header, encryptor);
+        m_gatherSender(header, headerLen,
+                       packet.empty() ? NULL : packet.contents(), packet.size());
     }
 
     void ClientConnection::Close()
@@ -80,6 +80,11 @@ namespace proto
                 m_sender = std::move(sender);
             }
 
+            void setGatherSender(net::GatherSender sender) override
+            {
+                m_gatherSender = std::move(sender);
+            }
+
             void setCloser(net::Closer closer) override
             {
                 m_closer = std::move(closer);
@@ -159,6 +164,7 @@ namespace proto
             std::atomic<bool> m_closed;
 
             net::Sender m_sender;
+            net::GatherSender m_gatherSender;
             net::Closer m_closer;
 
             static std::atomic<uint32> s_openConnections;
@@ -180,8 +180,9 @@ namespace proto
         return DecodeStatus::Ok;
     }
 
-    std::vector<uint8> PacketCodec::Encode(const WorldPacket& packet,
-                                           const HeaderEncryptor& encryptor)
+    size_t PacketCodec::EncodeHeader(const WorldPacket& packet,
+                                     uint8 (&header)[MAX_SERVER_HEADER_SIZE],
+                                     const HeaderEncryptor& encryptor)
     {
         // Mirrors WorldSocket.cpp's ServerPktHeader verbatim: the size field
         // counts the two opcode bytes along with the payload, and packets over
@@ -189,7 +190,6 @@ namespace proto
         const uint32 size  = uint32(packet.size()) + 2;
         const bool   large = size > 0x7FFF;
 
-        uint8  header[5];
         size_t headerLen = 0;
 
         if (large)
@@ -208,6 +208,15 @@ namespace proto
             encryptor(header, headerLen);
         }
 
+        return headerLen;
+    }
+
+    std::vector<uint8> PacketCodec::Encode(const WorldPacket& packet,
+                                           const HeaderEncryptor& encryptor)
+    {
+        uint8  header[MAX_SERVER_HEADER_SIZE];
+        size_t headerLen = EncodeHeader(packet, header, encryptor);
+
         std::vector<uint8> wire;
         wire.reserve(headerLen + packet.size());
         wire.insert(wire.end(), header, header + headerLen);
@@ -40,6 +40,9 @@ namespace proto
     /// Source of truth: WorldSocket.cpp handle_input_header() (ClientPktHeader).
     static const size_t CLIENT_HEADER_SIZE = 6;
 
+    /// Largest server -> client header: three-byte size + uint16 opcode.
+    static const size_t MAX_SERVER_HEADER_SIZE = 5;
+
     /// Largest packet the 4.3.4 client is ever allowed to send, payload
     /// included. Source: WorldSocket.cpp:654 (`header.size > 10240`).
     static const uint32 MAX_CLIENT_PACKET_SIZE = 10240;
@@ -151,6 +154,24 @@ namespace proto
             static std::vector<uint8> Encode(const WorldPacket& packet,
                                              const HeaderEncryptor& encryptor);
 
+            /**
+             * @brief Write and encrypt only the header Encode() would put in front
+             *        of the payload.
+             *
+             * For senders that hand the payload to the transport straight from the
+             * packet: a broadcast builds its packet once, and each recipient then
+             * pays for its own few header bytes rather than for a fresh copy of
+             * the whole body.
+             *
+             * @param packet    Packet whose header to write.
+             * @param header    Receives the header bytes.
+             * @param encryptor Header encryption hook; may be empty.
+             * @return The header length, 4 or 5.
+             */
+            static size_t EncodeHeader(const WorldPacket& packet,
+                                       uint8 (&header)[MAX_SERVER_HEADER_SIZE],
+                                       const HeaderEncryptor& encryptor);
+
             /// Install the header decryptor, once the session key has been agreed.
             void SetHeaderDecryptor(HeaderDecryptor decryptor)
             {
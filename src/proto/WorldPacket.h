@@ -61,6 +61,17 @@ class WorldPacket : public ByteBuffer
         WorldPacket(const WorldPacket& packet) : ByteBuffer(packet), m_opcode(packet.m_opcode)
         {
         }
+        /**
+         * @brief move constructor; the payload changes hands without a copy
+         *
+         * @param packet
+         */
+        WorldPacket(WorldPacket&& packet) noexcept : ByteBuffer(std::move(packet)), m_opcode(packet.m_opcode)
+        {
+        }
+
+        WorldPacket& operator=(const WorldPacket& packet) = default;
+        WorldPacket& operator=(WorldPacket&& packet) = default;
 
         /**
          * @brief
@@ -151,6 +151,11 @@ bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
 
     m_pingIntervallms = sConfig.GetIntDefault("MaxPingTime", 30) * (MINUTE * 1000);
 
+    // Write batching on the async connection. Neither changes what is written, only
+    // how many round trips and COMMITs it costs; 1 restores one of each per request.
+    m_groupCommitLimit = std::max(1, sConfig.GetIntDefault("GroupCommitTransactions", 16));
+    m_multiRowInsertLimit = std::max(1, sConfig.GetIntDefault("MultiRowInsertRows", 32));
+
     // create DB connections
 
     // setup connection pool size
@@ -549,6 +554,17 @@ bool Database::CommitTransaction()
     return true;
 }
 
+bool Database::SetTransactionFailureFlag(std::shared_ptr<std::atomic<bool> > const& failed)
+{
+    if (!m_TransStorage || !(*m_TransStorage)->get())
+    {
+        return false;
+    }
+
+    (*m_TransStorage)->get()->SetFailureFlag(failed);
+    return true;
+}
+
 bool Database::CommitTransactionDirect()
 {
     if (!m_pAsyncConn)
@@ -856,6 +872,118 @@ std::string Database::GetStmtString(const int stmtId) const
     return std::string();
 }
 
+bool Database::BuildMultiRowInsert(const std::string& fmt, uint32 rows, std::string& result)
+{
+    if (rows < 2)
+    {
+        return false;
+    }
+
+    std::string upper(fmt);
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+
+    size_t start = upper.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos ||
+        (upper.compare(start, 7, "INSERT ") != 0 && upper.compare(start, 8, "REPLACE ") != 0))
+    {
+        return false;
+    }
+
+    // INSERT ... SELECT and ON DUPLICATE KEY UPDATE have no multi-row VALUES form
+    // that means the same thing; leave them alone
+    size_t values = upper.rfind("VALUES");
+    if (values == std::string::npos || upper.find("SELECT") != std::string::npos ||
+        upper.find("ON DUPLICATE") != std::string::npos)
+    {
+        return false;
+    }
+
+    size_t open = fmt.find('(', values);
+    size_t close = fmt.find(')', open == std::string::npos ? values : open);
+    if (open == std::string::npos || close == std::string::npos ||
+        fmt.find_first_not_of(" \t\r\n;", close + 1) != std::string::npos)
+    {
+        return false;
+    }
+
+    // placeholders and literals repeat safely; a nested parenthesis (NOW(), a
+    // subquery) would need a real parser, so such statements keep their single row
+    const std::string tuple = fmt.substr(open, close - open + 1);
+    if (tuple.find('?') == std::string::npos || tuple.find('(', 1) != std::string::npos)
+    {
+        return false;
+    }
+
+    result.assign(fmt, 0, close + 1);
+    result.reserve(result.size() + (tuple.size() + 2) * (rows - 1));
+    for (uint32 i = 1; i < rows; ++i)
+    {
+        result.append(", ");
+        result.append(tuple);
+    }
+
+    return true;
+}
+
+int Database::GetMultiRowStmtIndex(int stmtId, uint32 rows)
+{
+    if (stmtId == -1 || rows < 2)
+    {
+        return -1;
+    }
+
+    const uint64 key = (uint64(uint32(stmtId)) << 32) | rows;
+    {
+        LOCK_GUARD _guard(m_stmtGuard);
+        MultiRowStmtRegistry::const_iterator iter = m_multiRowStmts.find(key);
+        if (iter != m_multiRowStmts.end())
+        {
+            return iter->second;
+        }
+    }
+
+    // GetStmtString() takes m_stmtGuard itself, so the format is fetched outside it
+    std::string szFmt;
+    const bool widened = BuildMultiRowInsert(GetStmtString(stmtId), rows, szFmt);
+
+    LOCK_GUARD _guard(m_stmtGuard);
+    int nId = -1;
+    if (widened)
+    {
+        PreparedStmtRegistry::const_iterator iter = m_stmtRegistry.find(szFmt);
+        if (iter == m_stmtRegistry.end())
+        {
+            nId = ++m_iStmtIndex;
+            m_stmtRegistry[szFmt] = nId;
+        }
+        else
+        {
+            nId = iter->second;
+        }
+    }
+
+    m_multiRowStmts[key] = nId;
+    return nId;
+}
+
+void Database::RecordCommit(uint32 transactions, uint32 statements, uint32 rowsMerged)
+{
+    m_statCommits.fetch_add(1, std::memory_order_relaxed);
+    m_statTransactions.fetch_add(transactions, std::memory_order_relaxed);
+    m_statStatements.fetch_add(statements, std::memory_order_relaxed);
+    m_statRowsMerged.fetch_add(rowsMerged, std::memory_order_relaxed);
+}
+
+Database::CommitStats Database::GetCommitStats() const
+{
+    CommitStats stats;
+    stats.commits = m_statCommits.load(std::memory_order_relaxed);
+    stats.transactions = m_statTransactions.load(std::memory_order_relaxed);
+    stats.statements = m_statStatements.load(std::memory_order_relaxed);
+    stats.rowsMerged = m_statRowsMerged.load(std::memory_order_relaxed);
+    return stats;
+}
+
 // HELPER CLASSES AND FUNCTIONS
 Database::TransHelper::~TransHelper()
 {
@@ -35,6 +35,7 @@
 #include "Threading/ThreadLocalStore.h"
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include "SqlPreparedStatement.h"
 
@@ -417,6 +418,17 @@ class Database
          */
         bool CommitTransactionChecked();
 
+        /**
+         * @brief Have the transaction open on this thread set `failed` if it does not commit.
+         *
+         * The commit stays asynchronous; the caller looks at the flag later, e.g. at its
+         * next save, to learn that what it queued never reached the database.
+         *
+         * @param failed set to true on failure
+         * @return bool false if no transaction is open
+         */
+        bool SetTransactionFailureFlag(std::shared_ptr<std::atomic<bool> > const& failed);
+
         // PREPARED STATEMENT API
         /**
          * @brief allocate index for prepared statement with SQL request 'fmt'
@@ -434,6 +446,70 @@ class Database
          */
         std::string GetStmtString(const int stmtId) const;
 
+        /**
+         * @brief index of the statement that inserts 'rows' rows of statement 'stmtId' at once
+         *
+         * Registered on first use like any other statement, so each connection prepares
+         * it once. Only a plain INSERT/REPLACE ... VALUES (?, ...) has a multi-row form.
+         *
+         * @param stmtId index of the single-row statement
+         * @param rows number of rows, two or more
+         * @return int the index, or -1 when the statement cannot be widened
+         */
+        int GetMultiRowStmtIndex(int stmtId, uint32 rows);
+
+        /**
+         * @brief rewrite a single-row INSERT format into its 'rows'-row equivalent
+         *
+         * @param fmt prepared statement format ending in VALUES (?, ...)
+         * @param rows number of value tuples wanted
+         * @param result receives the widened format
+         * @return bool false when fmt is not a statement this can be done to
+         */
+        static bool BuildMultiRowInsert(const std::string& fmt, uint32 rows, std::string& result);
+
+        /**
+         * @brief Counters for the async writer, read by ".server dbstats".
+         *
+         * A commit is one COMMIT sent to the server, however many transactions it
+         * carried; statements are round trips, after any multi-row INSERT merging.
+         */
+        struct CommitStats
+        {
+            uint64 commits;                                 ///< COMMITs sent
+            uint64 transactions;                            ///< transactions they carried
+            uint64 statements;                              ///< statements sent inside them
+            uint64 rowsMerged;                              ///< rows that rode along in a multi-row INSERT
+        };
+
+        /**
+         * @brief account one successful commit
+         *
+         * @param transactions number of transactions in it
+         * @param statements statements sent
+         * @param rowsMerged rows saved by multi-row INSERTs
+         */
+        void RecordCommit(uint32 transactions, uint32 statements, uint32 rowsMerged);
+        /**
+         * @brief
+         *
+         * @return CommitStats
+         */
+        CommitStats GetCommitStats() const;
+
+        /**
+         * @brief most transactions the delay thread puts under one commit ("GroupCommitTransactions")
+         *
+         * @return uint32
+         */
+        uint32 GetGroupCommitLimit() const { return m_groupCommitLimit; }
+        /**
+         * @brief most rows in one merged INSERT ("MultiRowInsertRows"); 1 disables merging
+         *
+         * @return uint32
+         */
+        uint32 GetMultiRowInsertLimit() const { return m_multiRowInsertLimit; }
+
         /**
          * @brief
          *
@@ -503,7 +579,8 @@ class Database
         Database() :
             m_TransStorage(NULL),m_nQueryConnPoolSize(1), m_pAsyncConn(NULL), m_pResultQueue(NULL),
             m_threadBody(NULL), m_delayThread(NULL), m_bAllowAsyncTransactions(false),
-            m_iStmtIndex(-1), m_logSQL(false), m_pingIntervallms(0)
+            m_iStmtIndex(-1), m_groupCommitLimit(1), m_multiRowInsertLimit(1),
+            m_logSQL(false), m_pingIntervallms(0)
         {
             m_nQueryCounter = -1;
         }
@@ -660,6 +737,21 @@ class Database
 
         int m_iStmtIndex; /**< TODO */
 
+        /**
+         * @brief multi-row forms already registered, keyed by (single-row index, rows)
+         *
+         */
+        typedef std::unordered_map<uint64, int> MultiRowStmtRegistry;
+        MultiRowStmtRegistry m_multiRowStmts;               /**< guarded by m_stmtGuard; -1 marks "cannot be widened" */
+
+        uint32 m_groupCommitLimit;                          /**< see GetGroupCommitLimit() */
+        uint32 m_multiRowInsertLimit;                       /**< see GetMultiRowInsertLimit() */
+
+        std::atomic<uint64> m_statCommits{0};               /**< see CommitStats */
+        std::atomic<uint64> m_statTransactions{0};          /**< see CommitStats */
+        std::atomic<uint64> m_statStatements{0};            /**< see CommitStats */
+        std::atomic<uint64> m_statRowsMerged{0};            /**< see CommitStats */
+
     private:
 
         bool m_logSQL; /**< TODO */
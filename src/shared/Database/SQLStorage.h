@@ -32,6 +32,7 @@
 #include <map>
 #include "Database/DatabaseEnv.h"
 #include "DataStores/DBCFileLoader.h"
+#include "Database/SQLStorageSnapshot.h"
 
 /**
  * @brief
@@ -756,6 +757,15 @@ class SQLStorageLoaderBase
          * @param offset
          */
         void storeValue(char* value, StorageClass& store, char* record, uint32 field_pos, uint32& offset);
+
+        /**
+         * @brief Build one record from a source row.
+         *
+         * @param row a query row or a snapshot row: anything with GetUInt32(),
+         *            GetUInt8(), GetFloat() and GetString() by column index
+         */
+        template<class Row>
+        void storeRow(StorageClass& store, Row const& row);
 };
 
 /**
@@ -263,15 +263,152 @@ void SQLStorageLoaderBase<DerivedLoader, StorageClass>::storeValue(char const* v
     }
 }
 
+/**
+ * @brief Source row of a live query, in the shape storeRow() reads.
+ */
+class SQLStorageQueryRow
+{
+    public:
+        explicit SQLStorageQueryRow(Field const* fields) : m_fields(fields) {}
+
+        uint32 GetUInt32(uint32 column) const { return m_fields[column].GetUInt32(); }
+        uint8 GetUInt8(uint32 column) const { return m_fields[column].GetUInt8(); }
+        float GetFloat(uint32 column) const { return m_fields[column].GetFloat(); }
+        char const* GetString(uint32 column) const { return m_fields[column].GetString(); }
+
+    private:
+        Field const* m_fields;
+};
+
+template<class DerivedLoader, class StorageClass>
+template<class Row>
+void SQLStorageLoaderBase<DerivedLoader, StorageClass>::storeRow(StorageClass& store, Row const& row)
+{
+    char* record = store.createRecord(row.GetUInt32(0));
+    uint32 offset = 0;
+
+    // dependend on dest-size
+    // iterate two indexes: x over dest, y over source
+    //                      y++ If and only If x != FT_NA*
+    //                      x++ If and only If a value is stored
+    for (uint32 x = 0, y = 0; x < store.GetDstFieldCount();)
+    {
+        switch (store.GetDstFormat(x))
+        {
+            // For default fill continue and do not increase y
+            case DBC_FF_NA:         storeValue((uint32)0, store, record, x, offset);         ++x; continue;
+            case DBC_FF_NA_BYTE:    storeValue((char)0, store, record, x, offset);           ++x; continue;
+            case DBC_FF_NA_FLOAT:   storeValue((float)0.0f, store, record, x, offset);       ++x; continue;
+            case DBC_FF_NA_POINTER: storeValue((char const*)NULL, store, record, x, offset); ++x; continue;
+            default:
+                break;
+        }
+
+        // It is required that the input has at least as many columns set as the output requires
+        if (y >= store.GetSrcFieldCount())
+        {
+            assert(false && "SQL storage has too few columns!");
+        }
+
+        switch (store.GetSrcFormat(y))
+        {
+            case DBC_FF_LOGIC:  storeValue((bool)(row.GetUInt32(y) > 0), store, record, x, offset);  ++x; break;
+            case DBC_FF_BYTE:   storeValue((char)row.GetUInt8(y), store, record, x, offset);         ++x; break;
+            case DBC_FF_INT:    storeValue((uint32)row.GetUInt32(y), store, record, x, offset);      ++x; break;
+            case DBC_FF_FLOAT:  storeValue((float)row.GetFloat(y), store, record, x, offset);        ++x; break;
+            case DBC_FF_STRING: storeValue((char const*)row.GetString(y), store, record, x, offset); ++x; break;
+            case DBC_FF_NA:
+            case DBC_FF_NA_BYTE:
+            case DBC_FF_NA_FLOAT:
+                // Do Not increase x
+                break;
+            case DBC_FF_IND:
+            case DBC_FF_SORT:
+            case DBC_FF_NA_POINTER:
+                assert(false && "SQL storage not have sort or pointer field types");
+                break;
+            default:
+                assert(false && "unknown format character");
+        }
+        ++y;
+    }
+}
+
 template<class DerivedLoader, class StorageClass>
 /**
- * @brief
+ * @brief Load the table, from its snapshot when the table has not changed since.
  *
  * @param store
  * @param error_at_empty
  */
 void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store, bool error_at_empty /*= true*/)
 {
+    // get struct size
+    uint32 recordsize = 0;
+    for (uint32 x = 0; x < store.GetDstFieldCount(); ++x)
+    {
+        switch (store.GetDstFormat(x))
+        {
+            case DBC_FF_LOGIC:
+                recordsize += sizeof(bool);   break;
+            case DBC_FF_BYTE:
+                recordsize += sizeof(char);   break;
+            case DBC_FF_INT:
+                recordsize += sizeof(uint32); break;
+            case DBC_FF_FLOAT:
+                recordsize += sizeof(float);  break;
+            case DBC_FF_STRING:
+                recordsize += sizeof(char*);  break;
+            case DBC_FF_NA:
+                recordsize += sizeof(uint32); break;
+            case DBC_FF_NA_BYTE:
+                recordsize += sizeof(char);   break;
+            case DBC_FF_NA_FLOAT:
+                recordsize += sizeof(float);  break;
+            case DBC_FF_NA_POINTER:
+                recordsize += sizeof(char*);  break;
+            case DBC_FF_IND:
+            case DBC_FF_SORT:
+                assert(false && "SQL storage not have sort field types");
+                break;
+            default:
+                assert(false && "unknown format character");
+                break;
+        }
+    }
+
+    // The checksum is computed by the server without shipping a row, so asking costs
+    // a fraction of the SELECT * it may save.
+    std::string snapshotKey;
+    if (SQLStorageSnapshot::IsEnabled())
+    {
+        if (QueryResult* checksum = WorldDatabase.PQuery("CHECKSUM TABLE `%s`", store.GetTableName()))
+        {
+            Field* fields = checksum->Fetch();
+            if (!fields[1].IsNULL())
+            {
+                snapshotKey = SQLStorageSnapshot::MakeKey(store.GetTableName(), store.GetSrcFormat(), store.GetDstFormat(), fields[1].GetUInt64());
+            }
+            delete checksum;
+        }
+    }
+
+    SQLStorageSnapshot::Reader snapshot;
+    if (!snapshotKey.empty() && snapshot.Open(store.GetTableName(), snapshotKey, store.GetSrcFormat()))
+    {
+        store.prepareToLoad(snapshot.GetMaxRecordId(), snapshot.GetRowCount(), recordsize);
+
+        BarGoLink bar(snapshot.GetRowCount());
+        while (snapshot.NextRow())
+        {
+            bar.step();
+            storeRow(store, snapshot);
+        }
+
+        DETAIL_LOG("%s: %u rows from snapshot", store.GetTableName(), snapshot.GetRowCount());
+        return;
+    }
+
     Field* fields = NULL;
     QueryResult* result  = WorldDatabase.PQuery("SELECT MAX(`%s`) FROM `%s`", store.EntryFieldName(), store.GetTableName());
     if (!result)
@@ -283,7 +420,6 @@ void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store
 
     uint32 maxRecordId = (*result)[0].GetUInt32() + 1;
     uint32 recordCount = 0;
-    uint32 recordsize = 0;
     delete result;
 
     result = WorldDatabase.PQuery("SELECT COUNT(*) FROM `%s`", store.GetTableName());
@@ -320,101 +456,32 @@ void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store
         exit(1);                                            // Stop server at loading broken or non-compatible table.
     }
 
-    // get struct size
-    uint32 offset = 0;
-    for (uint32 x = 0; x < store.GetDstFieldCount(); ++x)
-    {
-        switch (store.GetDstFormat(x))
-        {
-            case DBC_FF_LOGIC:
-                recordsize += sizeof(bool);   break;
-            case DBC_FF_BYTE:
-                recordsize += sizeof(char);   break;
-            case DBC_FF_INT:
-                recordsize += sizeof(uint32); break;
-            case DBC_FF_FLOAT:
-                recordsize += sizeof(float);  break;
-            case DBC_FF_STRING:
-                recordsize += sizeof(char*);  break;
-            case DBC_FF_NA:
-                recordsize += sizeof(uint32); break;
-            case DBC_FF_NA_BYTE:
-                recordsize += sizeof(char);   break;
-            case DBC_FF_NA_FLOAT:
-                recordsize += sizeof(float);  break;
-            case DBC_FF_NA_POINTER:
-                recordsize += sizeof(char*);  break;
-            case DBC_FF_IND:
-            case DBC_FF_SORT:
-                assert(false && "SQL storage not have sort field types");
-                break;
-            default:
-                assert(false && "unknown format character");
-                break;
-        }
-    }
-
     // Prepare data storage and lookup storage
     store.prepareToLoad(maxRecordId, recordCount, recordsize);
 
+    SQLStorageSnapshot::Writer writer(store.GetTableName(), snapshotKey, store.GetSrcFormat());
+
     BarGoLink bar(recordCount);
     do
     {
         fields = result->Fetch();
         bar.step();
 
-        char* record = store.createRecord(fields[0].GetUInt32());
-        offset = 0;
+        storeRow(store, SQLStorageQueryRow(fields));
 
-        // dependend on dest-size
-        // iterate two indexes: x over dest, y over source
-        //                      y++ If and only If x != FT_NA*
-        //                      x++ If and only If a value is stored
-        for (uint32 x = 0, y = 0; x < store.GetDstFieldCount();)
+        if (!snapshotKey.empty())
         {
-            switch (store.GetDstFormat(x))
-            {
-                // For default fill continue and do not increase y
-                case DBC_FF_NA:         storeValue((uint32)0, store, record, x, offset);         ++x; continue;
-                case DBC_FF_NA_BYTE:    storeValue((char)0, store, record, x, offset);           ++x; continue;
-                case DBC_FF_NA_FLOAT:   storeValue((float)0.0f, store, record, x, offset);       ++x; continue;
-                case DBC_FF_NA_POINTER: storeValue((char const*)NULL, store, record, x, offset); ++x; continue;
-                default:
-                    break;
-            }
-
-            // It is required that the input has at least as many columns set as the output requires
-            if (y >= store.GetSrcFieldCount())
-            {
-                assert(false && "SQL storage has too few columns!");
-            }
-
-            switch (store.GetSrcFormat(y))
-            {
-                case DBC_FF_LOGIC:  storeValue((bool)(fields[y].GetUInt32() > 0), store, record, x, offset);  ++x; break;
-                case DBC_FF_BYTE:   storeValue((char)fields[y].GetUInt8(), store, record, x, offset);         ++x; break;
-                case DBC_FF_INT:    storeValue((uint32)fields[y].GetUInt32(), store, record, x, offset);      ++x; break;
-                case DBC_FF_FLOAT:  storeValue((float)fields[y].GetFloat(), store, record, x, offset);        ++x; break;
-                case DBC_FF_STRING: storeValue((char const*)fields[y].GetString(), store, record, x, offset); ++x; break;
-                case DBC_FF_NA:
-                case DBC_FF_NA_BYTE:
-                case DBC_FF_NA_FLOAT:
-                    // Do Not increase x
-                    break;
-                case DBC_FF_IND:
-                case DBC_FF_SORT:
-                case DBC_FF_NA_POINTER:
-                    assert(false && "SQL storage not have sort or pointer field types");
-                    break;
-                default:
-                    assert(false && "unknown format character");
-            }
-            ++y;
+            writer.AddRow(fields);
         }
     }
     while (result->NextRow());
 
     delete result;
+
+    if (!snapshotKey.empty() && !writer.Commit(maxRecordId))
+    {
+        sLog.outError("%s: could not write the table snapshot; the next start loads it from SQL again", store.GetTableName());
+    }
 }
 
 #endif
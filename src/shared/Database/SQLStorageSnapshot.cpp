@@ -0,0 +1,353 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file SQLStorageSnapshot.cpp
+ * @brief Reading and writing of SQLStorage snapshot files.
+ *
+ * File layout, native byte order (a snapshot never leaves the host that wrote it):
+ *
+ *     uint32 magic, uint32 version
+ *     uint32 key length, key bytes
+ *     uint32 max record id + 1, uint32 row count
+ *     rows: column 0 (the entry) as uint32, then every other column by its source
+ *           format -- 'i'/'l' uint32, 'b' uint8, 'f' float, 's' uint32 length (or
+ *           NULL_STRING) followed by the bytes and a terminating zero; the ignored
+ *           formats store nothing
+ */
+
+#include "SQLStorageSnapshot.h"
+
+#include "Field.h"
+#include "DataStores/DBCFileLoader.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <sstream>
+
+static const uint32 SNAPSHOT_MAGIC   = 0x5153534D;          // "MSSQ"
+static const uint32 SNAPSHOT_VERSION = 1;
+static const uint32 NULL_STRING      = 0xFFFFFFFF;
+
+static std::mutex s_directoryLock;
+static std::string s_directory;
+
+void SQLStorageSnapshot::SetDirectory(std::string const& directory)
+{
+    std::lock_guard<std::mutex> guard(s_directoryLock);
+    s_directory = directory;
+}
+
+bool SQLStorageSnapshot::IsEnabled()
+{
+    std::lock_guard<std::mutex> guard(s_directoryLock);
+    return !s_directory.empty();
+}
+
+std::string SQLStorageSnapshot::PathFor(char const* table)
+{
+    std::lock_guard<std::mutex> guard(s_directoryLock);
+    return (std::filesystem::path(s_directory) / (std::string(table) + ".snapshot")).string();
+}
+
+std::string SQLStorageSnapshot::MakeKey(char const* table, char const* srcFormat, char const* dstFormat, uint64 checksum)
+{
+    // the record layout depends on the pointer size too
+    std::ostringstream key;
+    key << table << '/' << srcFormat << '/' << dstFormat << '/' << sizeof(char*) << '/' << checksum;
+    return key.str();
+}
+
+// -- Reader ----------------------------------------------------------------------------
+
+template<typename T>
+static bool Take(std::vector<char> const& file, size_t& pos, T& value)
+{
+    if (file.size() - pos < sizeof(T))
+    {
+        return false;
+    }
+
+    memcpy(&value, &file[pos], sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+bool SQLStorageSnapshot::Reader::Open(char const* table, std::string const& key, char const* srcFormat)
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+
+    FILE* f = fopen(PathFor(table).c_str(), "rb");
+    if (!f)
+    {
+        return false;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    bool read = size > 0;
+    if (read)
+    {
+        m_file.resize(size);
+        read = fread(&m_file[0], 1, size, f) == size_t(size);
+    }
+    fclose(f);
+
+    if (!read)
+    {
+        return false;
+    }
+
+    size_t pos = 0;
+    uint32 magic, version, keyLength;
+    if (!Take(m_file, pos, magic) || magic != SNAPSHOT_MAGIC ||
+        !Take(m_file, pos, version) || version != SNAPSHOT_VERSION ||
+        !Take(m_file, pos, keyLength) || m_file.size() - pos < keyLength ||
+        key.compare(0, std::string::npos, &m_file[pos], keyLength) != 0)
+    {
+        return false;
+    }
+    pos += keyLength;
+
+    if (!Take(m_file, pos, m_maxRecordId) || !Take(m_file, pos, m_rowCount))
+    {
+        return false;
+    }
+
+    m_format = srcFormat;
+    m_fieldCount = strlen(srcFormat);
+    m_row.resize(m_fieldCount);
+
+    // walk every row once without keeping it, so NextRow() cannot run off the end
+    size_t check = pos;
+    for (uint32 i = 0; i < m_rowCount; ++i)
+    {
+        if (!Decode(check, false))
+        {
+            return false;
+        }
+    }
+    if (check != m_file.size())
+    {
+        return false;
+    }
+
+    m_pos = pos;
+    m_end = check;
+    return true;
+}
+
+bool SQLStorageSnapshot::Reader::Decode(size_t& pos, bool keep)
+{
+    Value entry;
+    if (!m_fieldCount || !Take(m_file, pos, entry.u))
+    {
+        return false;
+    }
+    if (keep)
+    {
+        m_row[0] = entry;
+    }
+
+    for (uint32 y = 1; y < m_fieldCount; ++y)
+    {
+        Value value;
+        value.u = 0;
+
+        switch (m_format[y])
+        {
+            case DBC_FF_LOGIC:
+            case DBC_FF_INT:
+                if (!Take(m_file, pos, value.u))
+                {
+                    return false;
+                }
+                break;
+            case DBC_FF_BYTE:
+            {
+                uint8 byte;
+                if (!Take(m_file, pos, byte))
+                {
+                    return false;
+                }
+                value.u = byte;
+                break;
+            }
+            case DBC_FF_FLOAT:
+                if (!Take(m_file, pos, value.f))
+                {
+                    return false;
+                }
+                break;
+            case DBC_FF_STRING:
+            {
+                uint32 length;
+                if (!Take(m_file, pos, length))
+                {
+                    return false;
+                }
+
+                if (length == NULL_STRING)
+                {
+                    value.s = NULL;
+                    break;
+                }
+
+                if (m_file.size() - pos <= length || m_file[pos + length] != '\0')
+                {
+                    return false;
+                }
+
+                value.s = &m_file[pos];
+                pos += length + 1;
+                break;
+            }
+            default:
+                break;
+        }
+
+        if (keep)
+        {
+            m_row[y] = value;
+        }
+    }
+
+    return true;
+}
+
+bool SQLStorageSnapshot::Reader::NextRow()
+{
+    if (m_pos >= m_end)
+    {
+        return false;
+    }
+
+    return Decode(m_pos, true);
+}
+
+// -- Writer ----------------------------------------------------------------------------
+
+SQLStorageSnapshot::Writer::Writer(char const* table, std::string const& key, char const* srcFormat)
+    : m_table(table), m_key(key), m_format(srcFormat), m_fieldCount(strlen(srcFormat)), m_rowCount(0)
+{
+}
+
+template<typename T>
+void SQLStorageSnapshot::Writer::Put(T value)
+{
+    size_t pos = m_rows.size();
+    m_rows.resize(pos + sizeof(T));
+    memcpy(&m_rows[pos], &value, sizeof(T));
+}
+
+void SQLStorageSnapshot::Writer::AddRow(Field const* fields)
+{
+    Put<uint32>(fields[0].GetUInt32());
+
+    for (uint32 y = 1; y < m_fieldCount; ++y)
+    {
+        switch (m_format[y])
+        {
+            case DBC_FF_LOGIC:
+            case DBC_FF_INT:
+                Put<uint32>(fields[y].GetUInt32());
+                break;
+            case DBC_FF_BYTE:
+                Put<uint8>(fields[y].GetUInt8());
+                break;
+            case DBC_FF_FLOAT:
+                Put<float>(fields[y].GetFloat());
+                break;
+            case DBC_FF_STRING:
+            {
+                char const* str = fields[y].GetString();
+                if (!str)
+                {
+                    Put<uint32>(NULL_STRING);
+                    break;
+                }
+
+                uint32 length = strlen(str);
+                Put<uint32>(length);
+                m_rows.insert(m_rows.end(), str, str + length + 1);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    ++m_rowCount;
+}
+
+bool SQLStorageSnapshot::Writer::Commit(uint32 maxRecordId)
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+
+    std::string path = PathFor(m_table.c_str());
+    std::string partial = path + ".partial";
+
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+
+    FILE* f = fopen(partial.c_str(), "wb");
+    if (!f)
+    {
+        return false;
+    }
+
+    uint32 header[] = { SNAPSHOT_MAGIC, SNAPSHOT_VERSION, uint32(m_key.size()) };
+    uint32 counts[] = { maxRecordId, m_rowCount };
+
+    bool written = fwrite(header, sizeof(header), 1, f) == 1 &&
+                   fwrite(m_key.data(), 1, m_key.size(), f) == m_key.size() &&
+                   fwrite(counts, sizeof(counts), 1, f) == 1 &&
+                   (m_rows.empty() || fwrite(&m_rows[0], 1, m_rows.size(), f) == m_rows.size());
+    written = fclose(f) == 0 && written;
+
+    if (written)
+    {
+        // a reader sees the old snapshot or the new one, never half of one
+        std::filesystem::rename(partial, path, error);
+        written = !error;
+    }
+
+    if (!written)
+    {
+        std::filesystem::remove(partial, error);
+    }
+
+    return written;
+}
@@ -0,0 +1,141 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file SQLStorageSnapshot.h
+ * @brief On-disk copy of the rows an SQLStorage table was last loaded from.
+ *
+ * Loading creature_template and its siblings means a SELECT * of the whole table,
+ * shipped as text and parsed back into numbers field by field, on every start --
+ * even though the world database rarely changes between two starts. A snapshot
+ * keeps those rows in binary, already typed by the table's source format, under a
+ * key made of the table's CHECKSUM and both formats. When the key still matches,
+ * SQLStorageLoaderBase replays the rows from the snapshot; otherwise it loads from
+ * SQL as before and writes a fresh snapshot.
+ *
+ * The snapshot holds the source rows, not the finished records: records own their
+ * strings, and loaders such as the creature loader convert columns on the way in
+ * (script names to ids), so the conversion still runs on every start.
+ */
+
+#ifndef MANGOS_H_SQLSTORAGESNAPSHOT
+#define MANGOS_H_SQLSTORAGESNAPSHOT
+
+#include "Platform/Define.h"
+
+#include <string>
+#include <vector>
+
+class Field;
+
+class SQLStorageSnapshot
+{
+    public:
+        /// Where snapshots live; an empty directory turns them off.
+        static void SetDirectory(std::string const& directory);
+        static bool IsEnabled();
+
+        /**
+         * @brief The key a snapshot of `table` must carry to be current.
+         *
+         * @param checksum the table's CHECKSUM TABLE value
+         */
+        static std::string MakeKey(char const* table, char const* srcFormat, char const* dstFormat, uint64 checksum);
+
+        /// Replays the rows of a current snapshot, one at a time.
+        class Reader
+        {
+            public:
+                Reader() : m_pos(0), m_end(0), m_maxRecordId(0), m_rowCount(0), m_format(NULL), m_fieldCount(0) {}
+
+                /**
+                 * @brief Open the snapshot of `table` if it was written under `key`.
+                 *
+                 * The whole file is read and its structure checked before this
+                 * returns true, so a truncated or damaged file is reported as
+                 * stale here rather than discovered half-way through a load.
+                 */
+                bool Open(char const* table, std::string const& key, char const* srcFormat);
+
+                uint32 GetMaxRecordId() const { return m_maxRecordId; }
+                uint32 GetRowCount() const { return m_rowCount; }
+
+                /// Advance to the next row; false after the last one.
+                bool NextRow();
+
+                // columns of the current row, by source column index
+                uint32 GetUInt32(uint32 column) const { return m_row[column].u; }
+                uint8 GetUInt8(uint32 column) const { return uint8(m_row[column].u); }
+                float GetFloat(uint32 column) const { return m_row[column].f; }
+                char const* GetString(uint32 column) const { return m_row[column].s; }
+
+            private:
+                union Value
+                {
+                    uint32 u;
+                    float f;
+                    char const* s;
+                };
+
+                bool Decode(size_t& pos, bool keep);
+
+                std::vector<char> m_file;
+                std::vector<Value> m_row;
+                size_t m_pos;
+                size_t m_end;
+                uint32 m_maxRecordId;
+                uint32 m_rowCount;
+                char const* m_format;
+                uint32 m_fieldCount;
+        };
+
+        /// Collects rows as they are loaded from SQL and writes them out at the end.
+        class Writer
+        {
+            public:
+                Writer(char const* table, std::string const& key, char const* srcFormat);
+
+                /// Record one row, as returned by the SELECT *.
+                void AddRow(Field const* fields);
+
+                /// Write the file; it replaces the old snapshot only once complete.
+                bool Commit(uint32 maxRecordId);
+
+            private:
+                template<typename T> void Put(T value);
+
+                std::string m_table;
+                std::string m_key;
+                char const* m_format;
+                uint32 m_fieldCount;
+                uint32 m_rowCount;
+                std::vector<char> m_rows;
+        };
+
+    private:
+        static std::string PathFor(char const* table);
+};
+
+#endif
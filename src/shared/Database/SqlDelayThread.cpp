@@ -38,6 +38,7 @@
 #include "Database/SqlOperations.h"
 #include "DatabaseEnv.h"
 #include "Timer.h"
+#include "Trace.h"
 
 /**
  * @brief Constructor for SqlDelayThread
@@ -86,6 +87,7 @@ void SqlDelayThread::run()
     // unexpected path, because a thread that skips it corrupts MySQL's per-thread state
     // instead of failing cleanly.
     DbThreadGuard dbThread(m_dbEngine);
+    Trace::SetThreadName("sql delay");
 
     const uint32 loopSleepms = 10; /**< Sleep interval between processing cycles in milliseconds */
 
@@ -141,6 +143,12 @@ void SqlDelayThread::Stop()
  * Each operation is executed using the thread's database connection,
  * then deleted. This method processes the entire queue before returning.
  *
+ * Consecutive transactions are not committed one by one: when autosaves line up,
+ * the queue holds dozens of player saves back to back, and each COMMIT is a round
+ * trip plus a log flush on the server. They are collected and committed together,
+ * up to the database's group commit limit. Anything else in the queue closes the
+ * group first, so the order in which writes reach the server never changes.
+ *
  * This is thread-safe as it uses the queue's internal synchronization
  * mechanisms. Multiple threads can safely enqueue operations while
  * this thread processes them.
@@ -150,10 +158,89 @@ void SqlDelayThread::Stop()
  */
 void SqlDelayThread::ProcessRequests()
 {
+    const size_t groupLimit = m_dbEngine->GetGroupCommitLimit();
+
     SqlOperation* s = NULL;
     while (m_sqlQueue.next(s))
     {
-        s->Execute(m_dbConnection);
+        if (groupLimit > 1 && s->Kind() == SQL_OP_TRANSACTION)
+        {
+            m_commitGroup.push_back(static_cast<SqlTransaction*>(s));
+            if (m_commitGroup.size() >= groupLimit)
+            {
+                CommitGroup();
+            }
+            continue;
+        }
+
+        CommitGroup();
+        {
+            TRACE_SCOPE("sql operation");
+            s->Execute(m_dbConnection);
+        }
         delete s;
     }
+
+    CommitGroup();
+}
+
+/**
+ * @brief Commit the collected transactions together
+ *
+ * One failing transaction must not take the others with it. If anything in the
+ * group fails, the whole group is rolled back and each transaction is replayed on
+ * its own, which is exactly what would have happened without grouping.
+ */
+void SqlDelayThread::CommitGroup()
+{
+    if (m_commitGroup.empty())
+    {
+        return;
+    }
+
+    TRACE_SCOPE("sql commit group");
+
+    if (m_commitGroup.size() == 1)
+    {
+        m_commitGroup.front()->Execute(m_dbConnection);
+        delete m_commitGroup.front();
+        m_commitGroup.clear();
+        return;
+    }
+
+    {
+        SqlConnection::Lock guard(m_dbConnection);
+
+        uint32 statements = 0;
+        uint32 rowsMerged = 0;
+        bool ok = m_dbConnection->BeginTransaction();
+        for (size_t i = 0; ok && i < m_commitGroup.size(); ++i)
+        {
+            ok = m_commitGroup[i]->ExecuteStatements(m_dbConnection, statements, rowsMerged);
+        }
+
+        if (ok && m_dbConnection->CommitTransaction())
+        {
+            m_dbEngine->RecordCommit(uint32(m_commitGroup.size()), statements, rowsMerged);
+        }
+        else
+        {
+            if (!m_dbConnection->RollbackTransaction())
+            {
+                sLog.outError("SqlDelayThread: rollback of a group of %zu transactions failed", m_commitGroup.size());
+            }
+
+            sLog.outError("SqlDelayThread: group of %zu transactions failed, committing them one by one", m_commitGroup.size());
+            for (size_t i = 0; i < m_commitGroup.size(); ++i)
+            {
+                m_commitGroup[i]->ExecuteLocked(m_dbConnection);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < m_commitGroup.size(); ++i)
+    {
+        delete m_commitGroup[i];
+    }
+    m_commitGroup.clear();
 }
@@ -26,12 +26,14 @@
 #ifndef MANGOS_H_SQLDELAYTHREAD
 #define MANGOS_H_SQLDELAYTHREAD
 
+#include <vector>
 #include "LockedQueue/LockedQueue.h"
 #include "Threading/Threading.h"
 
 class Database;
 class SqlOperation;
 class SqlConnection;
+class SqlTransaction;
 
 /**
  * @brief
@@ -50,6 +52,7 @@ class SqlDelayThread : public MaNGOS::Runnable
         Database* m_dbEngine;                               /**< Pointer to used Database engine */
         SqlConnection* m_dbConnection;                      /**< Pointer to DB connection */
         volatile bool m_running; /**< TODO */
+        std::vector<SqlTransaction*> m_commitGroup;         /**< Transactions waiting to share one COMMIT */
 
     public:
 
@@ -66,6 +69,12 @@ class SqlDelayThread : public MaNGOS::Runnable
          */
         void ProcessRequests();
 
+        /**
+         * @brief run m_commitGroup under a single BEGIN..COMMIT and empty it
+         *
+         */
+        void CommitGroup();
+
     public:
         /**
          * @brief
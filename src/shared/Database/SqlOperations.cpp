@@ -104,27 +104,105 @@ bool SqlTransaction::ExecuteLocked(SqlConnection* conn)
         return true;
     }
 
-    if (!conn->BeginTransaction())
+    bool committed = false;
+    uint32 statements = 0;
+    uint32 rowsMerged = 0;
+    if (conn->BeginTransaction())
     {
+        if (ExecuteStatements(conn, statements, rowsMerged))
+        {
+            committed = conn->CommitTransaction();
+        }
+        else if (!conn->RollbackTransaction())
+        {
+            sLog.outError("SqlTransaction: rollback failed");
+        }
+    }
+
+    if (!committed)
+    {
+        if (m_failed)
+        {
+            m_failed->store(true);
+        }
         return false;
     }
 
-    const int nItems = m_queue.size();
-    for (int i = 0; i < nItems; ++i)
+    conn->DB().RecordCommit(1, statements, rowsMerged);
+    return true;
+}
+
+/**
+ * @brief Execute the queued operations inside an already opened transaction
+ * @param conn The database connection to use, locked, with a transaction open
+ * @param statements Incremented by the number of statements sent to the server
+ * @param rowsMerged Incremented by the rows folded into a multi-row INSERT
+ * @return true if every operation succeeded
+ *
+ * A save is mostly runs of the same INSERT, one per item, spell or aura. Such a
+ * run is sent as a single INSERT ... VALUES (...), (...) of up to the configured
+ * number of rows. Inside a transaction that changes nothing but the number of
+ * round trips: a multi-row INSERT fails as a whole, and so would the transaction.
+ */
+bool SqlTransaction::ExecuteStatements(SqlConnection* conn, uint32& statements, uint32& rowsMerged)
+{
+    Database& db = conn->DB();
+    const uint32 maxRows = db.GetMultiRowInsertLimit();
+
+    const size_t nItems = m_queue.size();
+    for (size_t i = 0; i < nItems;)
     {
         SqlOperation* pStmt = m_queue[i];
 
-        if (!pStmt->ExecuteLocked(conn))
+        // find the run of identical prepared statements starting here
+        size_t runEnd = i + 1;
+        if (maxRows > 1 && pStmt->Kind() == SQL_OP_PREPARED)
+        {
+            const int nIndex = static_cast<SqlPreparedRequest*>(pStmt)->GetIndex();
+            while (runEnd < nItems && runEnd - i < maxRows &&
+                   m_queue[runEnd]->Kind() == SQL_OP_PREPARED &&
+                   static_cast<SqlPreparedRequest*>(m_queue[runEnd])->GetIndex() == nIndex)
+            {
+                ++runEnd;
+            }
+        }
+
+        const uint32 rows = uint32(runEnd - i);
+        const int nMultiIndex = rows > 1 ? db.GetMultiRowStmtIndex(static_cast<SqlPreparedRequest*>(pStmt)->GetIndex(), rows) : -1;
+        if (nMultiIndex == -1)
         {
-            if (!conn->RollbackTransaction())
+            // not an INSERT we know how to widen: the run goes through one by one
+            for (; i < runEnd; ++i)
             {
-                sLog.outError("SqlTransaction: rollback failed");
+                ++statements;
+                if (!m_queue[i]->ExecuteLocked(conn))
+                {
+                    return false;
+                }
             }
+            continue;
+        }
+
+        const SqlStmtParameters& first = static_cast<SqlPreparedRequest*>(pStmt)->GetParams();
+        SqlStmtParameters merged(first.boundParams() * rows);
+        for (; i < runEnd; ++i)
+        {
+            const SqlStmtParameters::ParameterContainer& params = static_cast<SqlPreparedRequest*>(m_queue[i])->GetParams().params();
+            for (SqlStmtParameters::ParameterContainer::const_iterator itr = params.begin(); itr != params.end(); ++itr)
+            {
+                merged.addParam(*itr);
+            }
+        }
+
+        ++statements;
+        rowsMerged += rows - 1;
+        if (!conn->ExecuteStmt(nMultiIndex, merged))
+        {
             return false;
         }
     }
 
-    return conn->CommitTransaction();
+    return true;
 }
 
 /**
@@ -32,7 +32,9 @@
 #include <vector>
 
 #include "LockedQueue/LockedQueue.h"
+#include <atomic>
 #include <future>
+#include <memory>
 #include <queue>
 #include "Utilities/Callback.h"
 
@@ -43,6 +45,20 @@ class SqlConnection;
 class SqlDelayThread;
 class SqlStmtParameters;
 
+/**
+ * @brief What an operation is, for the code that merges them.
+ *
+ * A virtual tag rather than a dynamic_cast: the delay thread asks it for every
+ * operation it drains, and only transactions and prepared statements are ever
+ * candidates for merging.
+ */
+enum SqlOperationKind
+{
+    SQL_OP_OTHER,
+    SQL_OP_TRANSACTION,
+    SQL_OP_PREPARED
+};
+
 /**
  * @brief
  *
@@ -50,6 +66,12 @@ class SqlStmtParameters;
 class SqlOperation
 {
     public:
+        /**
+         * @brief Which of the mergeable kinds this operation is, if any.
+         *
+         * @return SqlOperationKind
+         */
+        virtual SqlOperationKind Kind() const { return SQL_OP_OTHER; }
         /**
          * @brief
          *
@@ -125,6 +147,7 @@ class SqlTransaction : public SqlOperation
 {
     private:
         std::vector<SqlOperation* > m_queue; /**< TODO */
+        std::shared_ptr<std::atomic<bool> > m_failed;   ///< set when the transaction fails, if anyone asked
 
     public:
         /**
@@ -145,6 +168,18 @@ class SqlTransaction : public SqlOperation
          */
         void DelayExecute(SqlOperation* sql) { m_queue.push_back(sql); }
 
+        /**
+         * @brief Have `failed` set if this transaction does not commit.
+         *
+         * For callers that cannot wait for the result but must learn of a failure
+         * later; the flag is shared, so it outlives whoever queued the transaction.
+         *
+         * @param failed set to true on failure, never cleared here
+         */
+        void SetFailureFlag(std::shared_ptr<std::atomic<bool> > const& failed) { m_failed = failed; }
+
+        SqlOperationKind Kind() const override { return SQL_OP_TRANSACTION; }
+
         /**
          * @brief
          *
@@ -152,6 +187,20 @@ class SqlTransaction : public SqlOperation
          * @return bool
          */
         bool ExecuteLocked(SqlConnection* conn) override;
+
+        /**
+         * @brief Run the queued statements inside a transaction the caller has opened.
+         *
+         * The body of ExecuteLocked() without its BEGIN/COMMIT, so that the delay thread
+         * can put several player saves under one commit. Consecutive runs of the same
+         * prepared INSERT are sent as one multi-row statement on the way through.
+         *
+         * @param conn connection with the lock held and a transaction open
+         * @param statements incremented by the number of round trips actually made
+         * @param rowsMerged incremented by the rows that rode along in a multi-row INSERT
+         * @return bool false as soon as one statement fails; the caller rolls back
+         */
+        bool ExecuteStatements(SqlConnection* conn, uint32& statements, uint32& rowsMerged);
 };
 
 /**
@@ -174,6 +223,8 @@ class SqlPreparedRequest : public SqlOperation
          */
         ~SqlPreparedRequest();
 
+        SqlOperationKind Kind() const override { return SQL_OP_PREPARED; }
+
         /**
          * @brief
          *
@@ -182,6 +233,9 @@ class SqlPreparedRequest : public SqlOperation
          */
         bool ExecuteLocked(SqlConnection* conn) override;
 
+        int GetIndex() const { return m_nIndex; }
+        const SqlStmtParameters& GetParams() const { return *m_param; }
+
     private:
         const int m_nIndex; /**< TODO */
         SqlStmtParameters* m_param; /**< TODO */
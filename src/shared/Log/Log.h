@@ -354,6 +354,12 @@ class Log : public MaNGOS::Singleton<Log>
          * @return uint32
          */
         uint32 GetLogLevel() const { return m_logLevel; }
+        /**
+         * @brief Directory the log files are written to, with a trailing slash; empty for the working directory.
+         *
+         * @return std::string const&
+         */
+        std::string const& GetLogsDir() const { return m_logsDir; }
         /**
          * @brief
          *
@@ -34,6 +34,7 @@
 #include <list>
 #include "Utilities/ByteConverter.h"
 #include "Utilities/Errors.h"
+#include "Utilities/PacketBufferPool.h"
 
 #define BITS_1 uint8 _1
 #define BITS_2 BITS_1, uint8 _2
@@ -155,6 +156,36 @@ class ByteBuffer
         {
         }
 
+        /**
+         * @brief Move constructor
+         *
+         * Takes over the source's storage without copying it; the source is left
+         * empty, as if cleared.
+         *
+         * @param buf Source ByteBuffer to move from
+         */
+        ByteBuffer(ByteBuffer&& buf) noexcept : _rpos(buf._rpos), _wpos(buf._wpos),
+            _bitpos(buf._bitpos), _curbitval(buf._curbitval), _storage(std::move(buf._storage))
+        {
+            buf.clear();
+        }
+
+        ByteBuffer& operator=(const ByteBuffer& buf) = default;
+
+        ByteBuffer& operator=(ByteBuffer&& buf) noexcept
+        {
+            if (this != &buf)
+            {
+                _rpos = buf._rpos;
+                _wpos = buf._wpos;
+                _bitpos = buf._bitpos;
+                _curbitval = buf._curbitval;
+                _storage = std::move(buf._storage);
+                buf.clear();
+            }
+            return *this;
+        }
+
         /**
          * @brief Clear the buffer and reset positions
          *
@@ -1172,7 +1203,7 @@ class ByteBuffer
     protected:
         size_t _rpos, _wpos, _bitpos;
         uint8 _curbitval;
-        std::vector<uint8> _storage; /**< TODO */
+        std::vector<uint8, PacketBufferAllocator<uint8> > _storage; /**< drawn from PacketBufferPool */
 };
 
 template <typename T>
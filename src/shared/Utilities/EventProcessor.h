@@ -139,6 +139,13 @@ class EventProcessor
          */
         uint64 CalculateTime(uint64 t_offset) const;
 
+        /**
+         * @brief Checks whether any event is queued
+         *
+         * @return bool True if no event is waiting to execute
+         */
+        bool Empty() const { return m_events.empty(); }
+
     protected:
         uint64 m_time; /**< Current time in milliseconds */
         EventList m_events; /**< List of events */
@@ -0,0 +1,254 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_LOCKFREEREGISTRY_H
+#define MANGOS_LOCKFREEREGISTRY_H
+
+#include "Platform/Define.h"
+#include "Utilities/ReadEpoch.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace MaNGOS
+{
+    /**
+     * @brief A key -> pointer index whose lookups take no lock.
+     *
+     * Same interface as ConcurrentRegistry, for indexes read from every map
+     * thread and written rarely. A lookup probes an open addressed table with
+     * atomic loads inside a ReadEpoch section, so concurrent readers write no
+     * shared memory at all; with a reader/writer lock every lookup bumps the
+     * lock's reader count, and that one cache line bounces between the threads.
+     *
+     * Writers are serialized by a mutex. A slot, once given a key, keeps it for
+     * the life of the table: Remove only clears the value, and a key that comes
+     * back reuses its slot. When live and cleared slots fill the table, a fresh
+     * table of the live entries is published and the old one is freed once the
+     * readers still on it are done.
+     *
+     * Remove returns only when no read section that could have seen the entry is
+     * still open, as it did under the exclusive lock: once it returns, the caller
+     * may free the object.
+     *
+     * @tparam Key    Key type, convertible to a non-zero uint64 (ObjectGuid in the game code).
+     * @tparam T      Pointed-to type. Ownership stays with the caller.
+     */
+    template <typename Key, typename T>
+    class LockFreeRegistry final
+    {
+        public:
+
+            LockFreeRegistry() : m_table(new Table(MIN_CAPACITY)), m_live(0) {}
+
+            ~LockFreeRegistry()
+            {
+                delete m_table.load(std::memory_order_relaxed);
+            }
+
+            LockFreeRegistry(const LockFreeRegistry&) = delete;
+            LockFreeRegistry& operator=(const LockFreeRegistry&) = delete;
+
+            void Insert(const Key& key, T* value)
+            {
+                uint64 raw = uint64(key);
+                std::lock_guard<std::mutex> guard(m_writeLock);
+
+                Table* table = m_table.load(std::memory_order_relaxed);
+                Slot* slot = table->Probe(raw);
+                if (slot->key.load(std::memory_order_relaxed) == raw)
+                {
+                    if (!slot->value.exchange(value, std::memory_order_release))
+                    {
+                        m_live.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    return;
+                }
+
+                if ((table->used + 1) * 4 > (table->mask + 1) * 3)
+                {
+                    table = Rebuild(table);
+                    slot = table->Probe(raw);
+                }
+
+                // Value first: a reader that sees the key must find the value with it
+                slot->value.store(value, std::memory_order_relaxed);
+                slot->key.store(raw, std::memory_order_release);
+                ++table->used;
+                m_live.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void Remove(const Key& key)
+            {
+                uint64 raw = uint64(key);
+                std::lock_guard<std::mutex> guard(m_writeLock);
+
+                Slot* slot = m_table.load(std::memory_order_relaxed)->Probe(raw);
+                if (slot->key.load(std::memory_order_relaxed) != raw)
+                {
+                    return;
+                }
+
+                if (slot->value.exchange(nullptr, std::memory_order_release))
+                {
+                    m_live.fetch_sub(1, std::memory_order_relaxed);
+                    ReadEpoch::Synchronize();
+                }
+            }
+
+            /// Look one up, or nullptr.
+            T* Find(const Key& key) const
+            {
+                uint64 raw = uint64(key);
+                ReadEpoch::Guard guard;
+
+                Slot const* slot = m_table.load(std::memory_order_acquire)->Probe(raw);
+                return slot->key.load(std::memory_order_acquire) == raw ? slot->value.load(std::memory_order_acquire) : nullptr;
+            }
+
+            /// First entry satisfying pred(key, value), or nullptr.
+            template <typename F>
+            T* FindWith(F&& pred) const
+            {
+                ReadEpoch::Guard guard;
+
+                Table const* table = m_table.load(std::memory_order_acquire);
+                for (size_t i = 0; i <= table->mask; ++i)
+                {
+                    uint64 raw = table->slots[i].key.load(std::memory_order_acquire);
+                    T* value = raw ? table->slots[i].value.load(std::memory_order_acquire) : nullptr;
+                    if (value && pred(Key(raw), value))
+                    {
+                        return value;
+                    }
+                }
+                return nullptr;
+            }
+
+            /// Run work(value) over every entry; entries removed meanwhile stay valid until it returns.
+            template <typename F>
+            void ForEach(F&& work) const
+            {
+                ReadEpoch::Guard guard;
+
+                Table const* table = m_table.load(std::memory_order_acquire);
+                for (size_t i = 0; i <= table->mask; ++i)
+                {
+                    if (!table->slots[i].key.load(std::memory_order_acquire))
+                    {
+                        continue;
+                    }
+
+                    if (T* value = table->slots[i].value.load(std::memory_order_acquire))
+                    {
+                        work(value);
+                    }
+                }
+            }
+
+            size_t Size() const
+            {
+                return m_live.load(std::memory_order_relaxed);
+            }
+
+        private:
+
+            static const size_t MIN_CAPACITY = 64;
+
+            struct Slot
+            {
+                std::atomic<uint64> key;        ///< 0 while free; never changes once set
+                std::atomic<T*>     value;      ///< nullptr once removed
+            };
+
+            struct Table
+            {
+                explicit Table(size_t capacity) : mask(capacity - 1), used(0), slots(new Slot[capacity])
+                {
+                    for (size_t i = 0; i < capacity; ++i)
+                    {
+                        slots[i].key.store(0, std::memory_order_relaxed);
+                        slots[i].value.store(nullptr, std::memory_order_relaxed);
+                    }
+                }
+
+                /// The slot holding raw, or the free slot ending its probe sequence.
+                Slot* Probe(uint64 raw) const
+                {
+                    // Low guid bits are a counter; mix the rest in before masking
+                    uint64 hash = raw * UI64LIT(0x9E3779B97F4A7C15);
+                    size_t i = size_t(hash ^ (hash >> 32)) & mask;
+                    for (;; i = (i + 1) & mask)
+                    {
+                        uint64 key = slots[i].key.load(std::memory_order_acquire);
+                        if (key == 0 || key == raw)
+                        {
+                            return &slots[i];
+                        }
+                    }
+                }
+
+                size_t                  mask;
+                size_t                  used;   ///< Slots with a key, live or removed; writers only
+                std::unique_ptr<Slot[]> slots;
+            };
+
+            /// Publishes a table of the live entries, sized to stay at most half full.
+            Table* Rebuild(Table* old)
+            {
+                size_t capacity = MIN_CAPACITY;
+                while (capacity < (m_live.load(std::memory_order_relaxed) + 1) * 2)
+                {
+                    capacity *= 2;
+                }
+
+                Table* table = new Table(capacity);
+                for (size_t i = 0; i <= old->mask; ++i)
+                {
+                    uint64 raw = old->slots[i].key.load(std::memory_order_relaxed);
+                    T* value = old->slots[i].value.load(std::memory_order_relaxed);
+                    if (raw && value)
+                    {
+                        Slot* slot = table->Probe(raw);
+                        slot->value.store(value, std::memory_order_relaxed);
+                        slot->key.store(raw, std::memory_order_relaxed);
+                        ++table->used;
+                    }
+                }
+
+                m_table.store(table, std::memory_order_release);
+                ReadEpoch::Synchronize();
+                delete old;
+                return table;
+            }
+
+            std::mutex          m_writeLock;
+            std::atomic<Table*> m_table;
+            std::atomic<size_t> m_live;
+    };
+}
+
+#endif
@@ -0,0 +1,243 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "PacketBufferPool.h"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace
+{
+    const size_t SMALLEST_CLASS_SHIFT = 6;                  // 64 bytes
+    const size_t CLASS_COUNT          = 9;                  // .. 16 KiB
+    const size_t THREAD_CACHE_LIMIT   = 64;                 // blocks per class a thread keeps
+    const size_t BATCH                = 32;                 // blocks moved to or from the shared list at once
+    const size_t SHARED_LIMIT         = 2048;               // blocks per class the shared list keeps
+
+    size_t ClassSize(size_t sizeClass)
+    {
+        return size_t(1) << (SMALLEST_CLASS_SHIFT + sizeClass);
+    }
+
+    /// The smallest class that fits `bytes`; CLASS_COUNT if none does.
+    size_t ClassFor(size_t bytes)
+    {
+        size_t sizeClass = 0;
+        while (sizeClass < CLASS_COUNT && ClassSize(sizeClass) < bytes)
+        {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    struct Counters
+    {
+        std::atomic<uint64> systemAllocations;
+        std::atomic<uint64> systemFrees;
+        std::atomic<uint64> oversized;
+        std::atomic<uint64> spills;
+        std::atomic<uint64> refills;
+    };
+
+    struct SharedList
+    {
+        std::mutex lock;
+        std::vector<void*> blocks[CLASS_COUNT];
+        Counters counters;
+    };
+
+    // Never destroyed: threads hand their caches back on exit, which may be
+    // after static destructors have run.
+    SharedList& Shared()
+    {
+        static SharedList* shared = new SharedList();
+        return *shared;
+    }
+
+    void Spill(std::vector<void*>& cache, size_t sizeClass, size_t count)
+    {
+        SharedList& shared = Shared();
+        shared.counters.spills.fetch_add(1, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> guard(shared.lock);
+        std::vector<void*>& list = shared.blocks[sizeClass];
+        for (; count && !cache.empty(); --count)
+        {
+            if (list.size() < SHARED_LIMIT)
+            {
+                list.push_back(cache.back());
+            }
+            else
+            {
+                ::operator delete(cache.back());
+                shared.counters.systemFrees.fetch_add(1, std::memory_order_relaxed);
+            }
+            cache.pop_back();
+        }
+    }
+
+    void Refill(std::vector<void*>& cache, size_t sizeClass)
+    {
+        SharedList& shared = Shared();
+        {
+            std::lock_guard<std::mutex> guard(shared.lock);
+            std::vector<void*>& list = shared.blocks[sizeClass];
+            for (size_t taken = 0; taken < BATCH && !list.empty(); ++taken)
+            {
+                cache.push_back(list.back());
+                list.pop_back();
+            }
+        }
+
+        if (!cache.empty())
+        {
+            shared.counters.refills.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        cache.push_back(::operator new(ClassSize(sizeClass)));
+        shared.counters.systemAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    struct ThreadCache
+    {
+        std::vector<void*> blocks[CLASS_COUNT];
+    };
+
+    struct ThreadCacheOwner
+    {
+        ThreadCache* cache;
+        ~ThreadCacheOwner();
+    };
+
+    thread_local ThreadCacheOwner t_owner = { NULL };
+    thread_local bool t_exited = false;                     // trivially destructible, so still readable after t_owner is gone
+
+    ThreadCacheOwner::~ThreadCacheOwner()
+    {
+        t_exited = true;
+        if (!cache)
+        {
+            return;
+        }
+
+        for (size_t sizeClass = 0; sizeClass < CLASS_COUNT; ++sizeClass)
+        {
+            Spill(cache->blocks[sizeClass], sizeClass, cache->blocks[sizeClass].size());
+        }
+        delete cache;
+        cache = NULL;
+    }
+
+    /// This thread's cache; NULL while the thread is exiting.
+    ThreadCache* LocalCache()
+    {
+        if (t_exited)
+        {
+            return NULL;
+        }
+        if (!t_owner.cache)
+        {
+            t_owner.cache = new ThreadCache();
+        }
+        return t_owner.cache;
+    }
+}
+
+void* PacketBufferPool::Allocate(size_t bytes)
+{
+    size_t sizeClass = ClassFor(bytes);
+    if (sizeClass == CLASS_COUNT)
+    {
+        Shared().counters.oversized.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(bytes);
+    }
+
+    ThreadCache* local = LocalCache();
+    if (!local)
+    {
+        std::vector<void*> scratch;
+        Refill(scratch, sizeClass);
+        void* block = scratch.back();
+        scratch.pop_back();
+        Spill(scratch, sizeClass, scratch.size());
+        return block;
+    }
+
+    std::vector<void*>& cache = local->blocks[sizeClass];
+    if (cache.empty())
+    {
+        Refill(cache, sizeClass);
+    }
+
+    void* block = cache.back();
+    cache.pop_back();
+    return block;
+}
+
+void PacketBufferPool::Release(void* block, size_t bytes)
+{
+    if (!block)
+    {
+        return;
+    }
+
+    size_t sizeClass = ClassFor(bytes);
+    if (sizeClass == CLASS_COUNT)
+    {
+        ::operator delete(block);
+        return;
+    }
+
+    ThreadCache* local = LocalCache();
+    if (!local)
+    {
+        std::vector<void*> single(1, block);
+        Spill(single, sizeClass, 1);
+        return;
+    }
+
+    std::vector<void*>& cache = local->blocks[sizeClass];
+    cache.push_back(block);
+    if (cache.size() > THREAD_CACHE_LIMIT)
+    {
+        Spill(cache, sizeClass, BATCH);
+    }
+}
+
+PacketBufferPool::Stats PacketBufferPool::GetStats()
+{
+    Counters const& counters = Shared().counters;
+
+    Stats stats;
+    stats.systemAllocations = counters.systemAllocations.load(std::memory_order_relaxed);
+    stats.systemFrees       = counters.systemFrees.load(std::memory_order_relaxed);
+    stats.oversized         = counters.oversized.load(std::memory_order_relaxed);
+    stats.spills            = counters.spills.load(std::memory_order_relaxed);
+    stats.refills           = counters.refills.load(std::memory_order_relaxed);
+    return stats;
+}
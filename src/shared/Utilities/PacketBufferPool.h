@@ -0,0 +1,88 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file PacketBufferPool.h
+ * @brief Size-class pool behind the storage of every ByteBuffer and WorldPacket.
+ *
+ * Nearly every packet the server builds lives for one tick or less: it is
+ * filled, sent or handled, and destroyed. With plain std::vector storage each
+ * of them is a malloc and a free, and the growth steps in between are more.
+ * The pool keeps freed buffers in power-of-two size classes from 64 bytes to
+ * 16 KiB and hands them out again.
+ *
+ * Each thread keeps a small cache per class and takes nothing lock-wise to use
+ * it. A cache that grows past its limit -- a thread that frees what others
+ * built, like a map thread handling inbound packets -- spills a batch into a
+ * shared, locked list, which an empty cache refills from. Only when both are
+ * empty does the pool go to the system allocator, so in steady state a tick
+ * allocates nothing. Requests above the largest class go straight to the
+ * system allocator.
+ */
+
+#ifndef MANGOS_H_PACKETBUFFERPOOL
+#define MANGOS_H_PACKETBUFFERPOOL
+
+#include "Platform/Define.h"
+
+#include <cstddef>
+
+class PacketBufferPool
+{
+    public:
+        /// Traffic that reached the system allocator, since startup.
+        struct Stats
+        {
+            uint64 systemAllocations;                       ///< class blocks taken from the system
+            uint64 systemFrees;                             ///< class blocks given back: the shared list was full
+            uint64 oversized;                               ///< requests above the largest class, never pooled
+            uint64 spills;                                  ///< batches a thread cache handed to the shared list
+            uint64 refills;                                 ///< batches a thread cache took from the shared list
+        };
+
+        static void* Allocate(size_t bytes);
+        static void Release(void* block, size_t bytes);
+
+        static Stats GetStats();
+};
+
+/// std::allocator stand-in that draws from PacketBufferPool.
+template<class T>
+class PacketBufferAllocator
+{
+    public:
+        typedef T value_type;
+
+        PacketBufferAllocator() {}
+        template<class U> PacketBufferAllocator(PacketBufferAllocator<U> const&) {}
+
+        T* allocate(size_t count) { return static_cast<T*>(PacketBufferPool::Allocate(count * sizeof(T))); }
+        void deallocate(T* block, size_t count) { PacketBufferPool::Release(block, count * sizeof(T)); }
+
+        template<class U> bool operator==(PacketBufferAllocator<U> const&) const { return true; }
+        template<class U> bool operator!=(PacketBufferAllocator<U> const&) const { return false; }
+};
+
+#endif
@@ -195,3 +195,12 @@ void BarGoLink::SetOutputState(bool on)
 {
     m_showOutput = on;
 }
+
+/**
+ * @brief Report whether progress bar output is enabled
+ * @return the state last set by SetOutputState()
+ */
+bool BarGoLink::GetOutputState()
+{
+    return m_showOutput;
+}
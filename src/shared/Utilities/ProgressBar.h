@@ -65,6 +65,9 @@ class BarGoLink
          */
         static void SetOutputState(bool on);
 
+        /// Whether bars currently produce output, so a caller can restore it.
+        static bool GetOutputState();
+
         /**
          * @brief Console output sink for one fully-built bar redraw.
          *
@@ -0,0 +1,115 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "ReadEpoch.h"
+#include "Platform/Define.h"
+
+#include <atomic>
+#include <thread>
+
+namespace MaNGOS
+{
+    namespace
+    {
+        /// A thread's counter, on a cache line of its own. Never freed: a thread
+        /// that exits leaves it even, which writers skip.
+        struct alignas(64) Reader
+        {
+            std::atomic<uint64> sequence;
+            Reader* next;
+        };
+
+        std::atomic<Reader*> s_readers(nullptr);
+
+        thread_local Reader* t_reader = nullptr;
+        thread_local unsigned t_depth = 0;
+
+        Reader* GetReader()
+        {
+            if (!t_reader)
+            {
+                Reader* reader = new Reader();
+                reader->sequence.store(0, std::memory_order_relaxed);
+                reader->next = s_readers.load(std::memory_order_relaxed);
+                while (!s_readers.compare_exchange_weak(reader->next, reader, std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+                t_reader = reader;
+            }
+            return t_reader;
+        }
+    }
+
+    void ReadEpoch::Enter()
+    {
+        if (t_depth++ != 0)
+        {
+            return;
+        }
+
+        Reader* reader = GetReader();
+        reader->sequence.store(reader->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        // Pairs with the fence in Synchronize(): either the writer sees this section
+        // open, or this section sees everything the writer did before it
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    void ReadEpoch::Leave()
+    {
+        if (--t_depth != 0)
+        {
+            return;
+        }
+
+        Reader* reader = t_reader;
+        reader->sequence.store(reader->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    void ReadEpoch::Synchronize()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        for (Reader* reader = s_readers.load(std::memory_order_acquire); reader; reader = reader->next)
+        {
+            if (reader == t_reader)
+            {
+                continue;
+            }
+
+            uint64 sequence = reader->sequence.load(std::memory_order_acquire);
+            if ((sequence & 1) == 0)
+            {
+                continue;
+            }
+
+            // Only the section seen open is waited for, not any the reader opens later
+            while (reader->sequence.load(std::memory_order_acquire) == sequence)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_READEPOCH_H
+#define MANGOS_READEPOCH_H
+
+namespace MaNGOS
+{
+    /**
+     * @brief Read sections that writers can wait out, without readers sharing a lock.
+     *
+     * Each thread that reads owns a counter, odd while it is inside a section.
+     * Entering and leaving a section only writes the thread's own counter, so
+     * readers on different threads never bounce a cache line between them the
+     * way they do on the counter of a shared lock.
+     *
+     * A writer that has unlinked something calls Synchronize(), which returns once
+     * every section that was open at the time of the call has closed; after that
+     * no reader can still hold what was unlinked.
+     *
+     * Sections nest. A thread that calls Synchronize() from inside a section does
+     * not wait for itself.
+     */
+    class ReadEpoch final
+    {
+        public:
+
+            /// Keeps a read section open for its lifetime.
+            class Guard final
+            {
+                public:
+
+                    Guard() { ReadEpoch::Enter(); }
+                    ~Guard() { ReadEpoch::Leave(); }
+
+                    Guard(const Guard&) = delete;
+                    Guard& operator=(const Guard&) = delete;
+            };
+
+            static void Enter();
+            static void Leave();
+
+            /// Waits until every read section open on another thread has closed.
+            static void Synchronize();
+    };
+}
+
+#endif
@@ -0,0 +1,360 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "Trace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> Trace::s_enabled(false);
+
+namespace
+{
+    const uint64 RING_SIZE      = 16384;                // events a thread keeps, a power of two
+    const uint64 RING_MASK      = RING_SIZE - 1;
+    const uint64 SLOT_WRITING   = ~uint64(0);           // index of a slot being overwritten
+    const uint32 OPEN_SPANS     = 32;                   // nesting depth whose open spans a thread keeps
+
+    /// One begin or end event. The index is a per slot sequence lock: it names the
+    /// event the slot holds, and is SLOT_WRITING while the owner rewrites it.
+    struct Slot
+    {
+        std::atomic<uint64> index;
+        std::atomic<char const*> name;
+        std::atomic<uint64> stamp;                      // microseconds << 1, low bit set for an end
+    };
+
+    /// The events of a thread, and the spans it is inside of. A long tick wraps the
+    /// ring and overwrites the begin of the span around it; the open slots keep that
+    /// begin, indexed by nesting depth, until the span ends.
+    struct Ring
+    {
+        explicit Ring(uint32 threadId) : tid(threadId), name(NULL), head(0), depth(0)
+        {
+            for (uint64 i = 0; i < RING_SIZE; ++i)
+            {
+                slots[i].index.store(SLOT_WRITING, std::memory_order_relaxed);
+            }
+            for (uint32 i = 0; i < OPEN_SPANS; ++i)
+            {
+                open[i].index.store(SLOT_WRITING, std::memory_order_relaxed);
+            }
+        }
+
+        uint32 tid;
+        std::atomic<char const*> name;
+        std::atomic<uint64> head;                       // index of the next event; only the owner writes it
+        std::atomic<uint32> depth;                      // spans begun and not ended; only the owner writes it
+        Slot slots[RING_SIZE];
+        Slot open[OPEN_SPANS];                          // begin of the open span at each depth
+    };
+
+    /// Every ring ever made. A ring outlives its thread, so a thread that has
+    /// just exited still shows in the next dump; the pools are fixed size, so
+    /// this does not grow after start up.
+    struct Rings
+    {
+        std::mutex lock;
+        std::vector<Ring*> all;
+    };
+
+    Rings& GetRings()
+    {
+        static Rings rings;
+        return rings;
+    }
+
+    thread_local Ring* t_ring = NULL;
+    thread_local char const* t_threadName = NULL;
+
+    uint64 Now()
+    {
+        typedef std::chrono::steady_clock Clock;
+        static Clock::time_point const epoch = Clock::now();
+        return uint64(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - epoch).count());
+    }
+
+    Ring* GetRing()
+    {
+        if (!t_ring)
+        {
+            Rings& rings = GetRings();
+            std::lock_guard<std::mutex> guard(rings.lock);
+            t_ring = new Ring(uint32(rings.all.size() + 1));
+            t_ring->name.store(t_threadName, std::memory_order_relaxed);
+            rings.all.push_back(t_ring);
+        }
+        return t_ring;
+    }
+
+    void Store(Slot& slot, uint64 index, char const* name, uint64 stamp)
+    {
+        slot.index.store(SLOT_WRITING, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.stamp.store(stamp, std::memory_order_relaxed);
+        slot.index.store(index, std::memory_order_release);
+    }
+
+    void Write(char const* name, bool end)
+    {
+        Ring* ring = GetRing();
+        uint64 index = ring->head.load(std::memory_order_relaxed);
+        uint64 stamp = (Now() << 1) | (end ? 1 : 0);
+        Store(ring->slots[index & RING_MASK], index, name, stamp);
+        ring->head.store(index + 1, std::memory_order_release);
+
+        uint32 depth = ring->depth.load(std::memory_order_relaxed);
+        if (end)
+        {
+            if (depth)
+            {
+                ring->depth.store(depth - 1, std::memory_order_release);
+            }
+            return;
+        }
+
+        if (depth < OPEN_SPANS)
+        {
+            Store(ring->open[depth], index, name, stamp);
+        }
+        ring->depth.store(depth + 1, std::memory_order_release);
+    }
+
+    struct Event
+    {
+        uint64 index;
+        char const* name;
+        uint64 stamp;
+    };
+
+    /// Copies the event a slot holds, unless the owner is rewriting it.
+    bool Load(Slot const& slot, Event& event)
+    {
+        event.index = slot.index.load(std::memory_order_acquire);
+        if (event.index == SLOT_WRITING)
+        {
+            return false;
+        }
+
+        event.name = slot.name.load(std::memory_order_relaxed);
+        event.stamp = slot.stamp.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.index.load(std::memory_order_relaxed) == event.index;
+    }
+
+    /// Copies a ring's events, oldest first, skipping any the owner overwrote meanwhile.
+    void ReadRing(Ring const& ring, std::vector<Event>& events)
+    {
+        uint64 head = ring.head.load(std::memory_order_acquire);
+        uint64 first = head > RING_SIZE ? head - RING_SIZE : 0;
+
+        for (uint64 index = first; index < head; ++index)
+        {
+            Event event;
+            if (Load(ring.slots[index & RING_MASK], event) && event.index == index)
+            {
+                events.push_back(event);
+            }
+        }
+    }
+
+    /// Copies the begins of the spans a ring's thread is inside of, outermost first.
+    void ReadOpenSpans(Ring const& ring, std::vector<Event>& spans)
+    {
+        uint32 depth = ring.depth.load(std::memory_order_acquire);
+        for (uint32 i = 0; i < depth && i < OPEN_SPANS; ++i)
+        {
+            Event event;
+            if (Load(ring.open[i], event))
+            {
+                spans.push_back(event);
+            }
+        }
+    }
+
+    void AppendEscaped(std::string& out, char const* text)
+    {
+        for (; *text; ++text)
+        {
+            if (*text == '"' || *text == '\\')
+            {
+                out += '\\';
+            }
+            out += *text;
+        }
+    }
+}
+
+void Trace::SetEnabled(bool enabled)
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Trace::SetThreadName(char const* name)
+{
+    t_threadName = name;
+    if (t_ring)
+    {
+        t_ring->name.store(name, std::memory_order_relaxed);
+    }
+}
+
+void Trace::Begin(char const* name)
+{
+    Write(name, false);
+}
+
+void Trace::End(char const* name)
+{
+    Write(name, true);
+}
+
+uint32 Trace::WriteChromeTrace(std::string& out, uint32 lastMs)
+{
+    std::vector<Ring*> rings;
+    {
+        Rings& all = GetRings();
+        std::lock_guard<std::mutex> guard(all.lock);
+        rings = all.all;
+    }
+
+    uint64 now = Now();
+    uint64 cutoff = lastMs && now > uint64(lastMs) * 1000 ? now - uint64(lastMs) * 1000 : 0;
+
+    char buffer[128];
+    uint32 written = 0;
+    std::vector<Event> events;
+    std::vector<Event> spans;
+
+    out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"mangosd\"}}";
+
+    for (std::vector<Ring*>::const_iterator itr = rings.begin(); itr != rings.end(); ++itr)
+    {
+        Ring const& ring = **itr;
+
+        char const* threadName = ring.name.load(std::memory_order_relaxed);
+        snprintf(buffer, sizeof(buffer), ",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", ring.tid);
+        out += buffer;
+        if (threadName)
+        {
+            AppendEscaped(out, threadName);
+        }
+        else
+        {
+            snprintf(buffer, sizeof(buffer), "thread %u", ring.tid);
+            out += buffer;
+        }
+        out += "\"}}";
+
+        spans.clear();
+        ReadOpenSpans(ring, spans);
+        events.clear();
+        ReadRing(ring, events);
+
+        // A span still open whose begin the ring no longer holds, or that began
+        // before the window, is opened from the open slots so it runs to the end
+        uint64 firstShown = ~uint64(0);
+        for (std::vector<Event>::const_iterator event = events.begin(); event != events.end(); ++event)
+        {
+            if ((event->stamp >> 1) >= cutoff)
+            {
+                firstShown = event->index;
+                break;
+            }
+        }
+
+        for (std::vector<Event>::const_iterator span = spans.begin(); span != spans.end(); ++span)
+        {
+            if (span->index >= firstShown || !span->name)
+            {
+                continue;
+            }
+
+            out += ",{\"name\":\"";
+            AppendEscaped(out, span->name);
+            snprintf(buffer, sizeof(buffer), "\",\"ph\":\"B\",\"ts\":" UI64FMTD ",\"pid\":1,\"tid\":%u}",
+                     span->stamp >> 1, ring.tid);
+            out += buffer;
+            ++written;
+        }
+
+        // An end whose begin is older than the window, or was overwritten, would
+        // close a span the viewer never saw open. Such a span was opened deeper
+        // than any of the open ones written above, so the count starts from zero.
+        uint32 depth = 0;
+        for (std::vector<Event>::const_iterator event = events.begin(); event != events.end(); ++event)
+        {
+            uint64 micros = event->stamp >> 1;
+            bool end = (event->stamp & 1) != 0;
+            if (micros < cutoff || !event->name)
+            {
+                continue;
+            }
+
+            if (end)
+            {
+                if (!depth)
+                {
+                    continue;
+                }
+                --depth;
+            }
+            else
+            {
+                ++depth;
+            }
+
+            out += ",{\"name\":\"";
+            AppendEscaped(out, event->name);
+            snprintf(buffer, sizeof(buffer), "\",\"ph\":\"%c\",\"ts\":" UI64FMTD ",\"pid\":1,\"tid\":%u}",
+                     end ? 'E' : 'B', micros, ring.tid);
+            out += buffer;
+            ++written;
+        }
+    }
+
+    out += "]}\n";
+    return written;
+}
+
+int32 Trace::DumpChromeTrace(std::string const& path, uint32 lastMs)
+{
+    std::string json;
+    uint32 written = WriteChromeTrace(json, lastMs);
+
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file)
+    {
+        return -1;
+    }
+
+    bool complete = fwrite(json.data(), 1, json.size(), file) == json.size();
+    complete = fclose(file) == 0 && complete;
+    return complete ? int32(written) : -1;
+}
@@ -0,0 +1,120 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * @file Trace.h
+ * @brief Built-in tracer of what the server threads spend their time on.
+ *
+ * Code marks the spans worth seeing with TRACE_SCOPE("name"). While tracing is on,
+ * each span writes a begin and an end event into a ring owned by the calling
+ * thread, so recording takes no lock and threads never share a cache line. Each
+ * ring keeps the last few thousand events of its thread, which at the rates the
+ * server produces them is the last several seconds.
+ *
+ * While tracing is off, a span costs one relaxed load and a branch, and nothing
+ * is allocated: a thread's ring is only made the first time it records.
+ *
+ * The rings can be written out as Chrome trace_event JSON, which chrome://tracing
+ * and Perfetto open as a timeline with one row per thread. A span that has begun
+ * and not ended -- what a stuck thread is stuck in -- shows running to the end.
+ * Besides its ring, each thread keeps the begins of the spans it is inside of, up
+ * to 32 deep, so such a span still shows after the ring has wrapped past its begin.
+ *
+ * Span names must be string literals: only the pointer is stored.
+ */
+
+#ifndef MANGOS_H_TRACE
+#define MANGOS_H_TRACE
+
+#include "Platform/Define.h"
+
+#include <atomic>
+#include <string>
+
+class Trace
+{
+    public:
+        static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+        static void SetEnabled(bool enabled);
+
+        /// Names the calling thread's row in the trace; a string literal.
+        static void SetThreadName(char const* name);
+
+        static void Begin(char const* name);
+        static void End(char const* name);
+
+        /**
+         * @brief Writes the recorded events as Chrome trace_event JSON.
+         *
+         * @param out Receives the JSON.
+         * @param lastMs Only events of the last lastMs milliseconds; 0 for all.
+         * @return uint32 The number of begin and end events written.
+         */
+        static uint32 WriteChromeTrace(std::string& out, uint32 lastMs);
+
+        /**
+         * @brief Writes the recorded events to a file, see WriteChromeTrace().
+         *
+         * @return int32 The number of events written, or -1 if the file could not be written.
+         */
+        static int32 DumpChromeTrace(std::string const& path, uint32 lastMs);
+
+    private:
+        static std::atomic<bool> s_enabled;
+};
+
+/// Span from construction to destruction, recorded while tracing is on.
+class TraceScope
+{
+    public:
+        explicit TraceScope(char const* name) : m_name(NULL)
+        {
+            if (Trace::IsEnabled())
+            {
+                m_name = name;
+                Trace::Begin(name);
+            }
+        }
+
+        ~TraceScope()
+        {
+            if (m_name)
+            {
+                Trace::End(m_name);
+            }
+        }
+
+    private:
+        TraceScope(TraceScope const&);
+        TraceScope& operator=(TraceScope const&);
+
+        char const* m_name;
+};
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+
+#endif
@@ -44,6 +44,13 @@ namespace net {
 // span need only stay valid for the duration of the call.
 using Sender = std::function<void(const uint8_t* data, size_t len)>;
 
+// The same channel taking two spans that go out back to back, as if joined: a header
+// built on the caller's stack and a body it does not own (a packet shared by every
+// recipient of a broadcast). Saves the sender stitching them into a buffer of its own
+// first. Same threading and lifetime rules as Sender; either span may be empty.
+using GatherSender = std::function<void(const uint8_t* head, size_t headLen,
+                                        const uint8_t* body, size_t bodyLen)>;
+
 // Lets a session ask the transport to tear the connection down. No-op once gone.
 using Closer = std::function<void()>;
 
@@ -80,6 +87,10 @@ public:
     // Default: ignored (request/response sessions only ever use onData's return).
     virtual void setSender(Sender) {}
 
+    // Hands the session the two-span form of the same channel (net thread, once,
+    // before onConnect). Default: ignored — Sender alone is enough for everything.
+    virtual void setGatherSender(GatherSender) {}
+
     // Hands the session a way to request its own teardown (net thread, once).
     virtual void setCloser(Closer) {}
 
@@ -63,14 +63,30 @@ public:
     /// `data` need only stay valid for the duration of the call.
     bool append(const uint8_t* data, size_t len)
     {
-        if (data == nullptr || len == 0)
+        return append(data, len, nullptr, 0);
+    }
+
+    /// Producer (any thread): as above, for two spans queued back to back under one
+    /// lock, so nothing another producer appends can land between them.
+    bool append(const uint8_t* head, size_t headLen, const uint8_t* body, size_t bodyLen)
+    {
+        if (head == nullptr)
+        {
+            headLen = 0;
+        }
+        if (body == nullptr)
+        {
+            bodyLen = 0;
+        }
+        if (headLen + bodyLen == 0)
         {
             return false;
         }
 
         std::lock_guard<std::mutex> lock(m_mu);
-        m_pending.insert(m_pending.end(), data, data + len);
-        m_gate.onQueued(len);
+        m_pending.insert(m_pending.end(), head, head + headLen);
+        m_pending.insert(m_pending.end(), body, body + bodyLen);
+        m_gate.onQueued(headLen + bodyLen);
 
         if (m_writing)
         {
@@ -43,10 +43,10 @@ namespace net {
 
 // ── SendChannel ───────────────────────────────────────────────────────────────
 
-void SendChannel::post(const uint8_t* data, size_t len) {
+void SendChannel::post(const uint8_t* data, size_t len, const uint8_t* body, size_t bodyLen) {
     std::lock_guard<std::mutex> lock(mu);
     if (ctx)
-        ctx->enqueue(data, len);
+        ctx->enqueue(data, len, body, bodyLen);
 }
 
 // The session asked to close. Do NOT close the socket here.
@@ -111,11 +111,11 @@ bool ConnCtx::postSend(const uint8_t* data, size_t len) {
     return true;
 }
 
-void ConnCtx::enqueue(const uint8_t* data, size_t len) {
+void ConnCtx::enqueue(const uint8_t* data, size_t len, const uint8_t* body, size_t bodyLen) {
     // append() returns true only for the caller that finds no write in flight, so
     // exactly one thread starts the write and the stream stays ordered. Everything
     // else queued meanwhile is coalesced into the next span by nextSpan().
-    if (channel && channel->out.append(data, len))
+    if (channel && channel->out.append(data, len, body, bodyLen))
         startSend();
 }
 
@@ -535,6 +535,8 @@ void IocpServer::handleAccept(AcceptOv* aov, DWORD /*bytes*/) {
     ctx->channel->ctx = ctx;
     ctx->session->setSender(
         [ch = ctx->channel](const uint8_t* d, size_t n) { ch->post(d, n); });
+    ctx->session->setGatherSender(
+        [ch = ctx->channel](const uint8_t* h, size_t hn, const uint8_t* b, size_t bn) { ch->post(h, hn, b, bn); });
     ctx->session->setCloser([ch = ctx->channel] { ch->requestClose(); });
     ctx->session->setFlowControl(
         std::shared_ptr<net::FlowControl>(ctx->channel, &ctx->channel->out.gate()));
@@ -117,7 +117,9 @@ struct SendChannel {
     // world thread holds, and it outlives the ctx by design.
     bool closeRequested = false;
 
-    void post(const uint8_t* data, size_t len);  // append + kick a write while armed
+    void post(const uint8_t* data, size_t len,   // append + kick a write while armed;
+              const uint8_t* body = nullptr,     // the second span, if any, goes
+              size_t bodyLen = 0);               // right after the first
     void requestClose();                   // drain, then close
     void disarm();                         // detach from the ctx, forever
 };
@@ -191,7 +193,8 @@ struct ConnCtx {
 
     // Append bytes to the outbound buffer and start a write if none is in flight.
     // Thread-safe; callable from any thread.
-    void enqueue(const uint8_t* data, size_t len);
+    void enqueue(const uint8_t* data, size_t len,
+                 const uint8_t* body = nullptr, size_t bodyLen = 0);
     // Post the next contiguous span from the SendQueue, if any. Exactly one write is
     // ever in flight, which is what keeps the byte stream ordered.
     void startSend();
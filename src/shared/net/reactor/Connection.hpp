@@ -70,7 +70,9 @@ struct SendChannel : public std::enable_shared_from_this<SendChannel> {
     std::deque<std::shared_ptr<SendChannel>>*   reqQueue = nullptr;
     Poller*                                     poller   = nullptr;
 
-    void post(const uint8_t* data, size_t len);  // world thread
+    void post(const uint8_t* data, size_t len,   // world thread; the second span,
+              const uint8_t* body = nullptr,     // if any, goes right after the first
+              size_t bodyLen = 0);
     void requestClose();                         // world thread
     void disarm();                               // worker thread
 
@@ -28,6 +28,7 @@
 
 #include "net/BindAddress.hpp"
 #include "Log.h"
+#include "Trace.h"
 
 // Reactor server is POSIX-only; on Windows the proactor IocpServer is used and
 // this translation unit collapses to nothing.
@@ -210,6 +211,8 @@ void ReactorServer::acceptLoop() {
                 conn->channel->poller   = w.poller.get();
                 conn->session->setSender(
                     [ch = conn->channel](const uint8_t* d, size_t n) { ch->post(d, n); });
+                conn->session->setGatherSender(
+                    [ch = conn->channel](const uint8_t* h, size_t hn, const uint8_t* b, size_t bn) { ch->post(h, hn, b, bn); });
                 conn->session->setCloser([ch = conn->channel] { ch->requestClose(); });
                 conn->session->setFlowControl(
                     std::shared_ptr<net::FlowControl>(conn->channel, &conn->channel->out.gate()));
@@ -248,7 +251,7 @@ void SendChannel::notifyWorker() {
     poller->wake();
 }
 
-void SendChannel::post(const uint8_t* data, size_t len) {
+void SendChannel::post(const uint8_t* data, size_t len, const uint8_t* body, size_t bodyLen) {
     {
         std::lock_guard<std::mutex> lock(mu);
         if (!alive) return;
@@ -256,7 +259,7 @@ void SendChannel::post(const uint8_t* data, size_t len) {
         // is already queued) and count the bytes against backpressure here, at
         // hand-off, so a producer cannot outrun a lagging worker. The worker drains
         // the very same buffer — no second hand-off, no per-packet allocation.
-        out.append(data, len);
+        out.append(data, len, body, bodyLen);
     }
     notifyWorker();
 }
@@ -391,11 +394,15 @@ void ReactorServer::workerLoop(Worker& w) {
     PollerEvent evs[MAXEV];
     uint8_t     rbuf[8192];
 
+    Trace::SetThreadName("net worker");
+
     while (true) {
         int n = w.poller->wait(evs, MAXEV);
         if (n < 0) break;
         if (!m_running.load()) break;
 
+        TRACE_SCOPE("net events");
+
         // Socket events are handled FIRST, while every Connection* that wait()
         // put in evs[] is still alive. drainIncoming()/drainSendRequests() can
         // both close — and therefore free — a connection; they are safe about it
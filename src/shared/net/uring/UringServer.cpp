@@ -32,6 +32,7 @@
 
 #include "net/BindAddress.hpp"
 #include "Log.h"
+#include "Trace.h"
 
 #ifdef MANGOS_USE_IO_URING
 
@@ -189,6 +190,8 @@ void UringServer::acceptLoop() {
         conn->channel->evfd     = w.evfd;
         conn->session->setSender(
             [ch = conn->channel](const uint8_t* d, size_t n) { ch->post(d, n); });
+        conn->session->setGatherSender(
+            [ch = conn->channel](const uint8_t* h, size_t hn, const uint8_t* b, size_t bn) { ch->post(h, hn, b, bn); });
         conn->session->setCloser([ch = conn->channel] { ch->requestClose(); });
         conn->session->setFlowControl(
             std::shared_ptr<net::FlowControl>(conn->channel, &conn->channel->out.gate()));
@@ -225,7 +228,7 @@ void UringSendChannel::notifyWorker() {
     (void)r;
 }
 
-void UringSendChannel::post(const uint8_t* data, size_t len) {
+void UringSendChannel::post(const uint8_t* data, size_t len, const uint8_t* body, size_t bodyLen) {
     {
         std::lock_guard<std::mutex> lock(mu);
         if (!alive) return;
@@ -234,7 +237,7 @@ void UringSendChannel::post(const uint8_t* data, size_t len) {
         // hand-off, so a producer cannot outrun a lagging worker. The worker submits
         // its SQEs out of the very same buffer — no second hand-off, no per-packet
         // allocation.
-        out.append(data, len);
+        out.append(data, len, body, bodyLen);
     }
     notifyWorker();
 }
@@ -426,11 +429,15 @@ void UringServer::workerLoop(Worker& w) {
     submitWakeRead(w);
     io_uring_submit(&w.ring);
 
+    Trace::SetThreadName("net worker");
+
     bool stopping = false;
     while (!stopping) {
         int ret = io_uring_submit_and_wait(&w.ring, 1);
         if (ret < 0 && ret == -EINTR) continue;
 
+        TRACE_SCOPE("net completions");
+
         unsigned        head;
         io_uring_cqe*   cqe;
         unsigned        count = 0;
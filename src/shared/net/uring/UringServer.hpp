@@ -75,7 +75,9 @@ struct UringSendChannel : public std::enable_shared_from_this<UringSendChannel>
     std::deque<std::shared_ptr<UringSendChannel>>* reqQueue = nullptr;
     int                                            evfd     = -1;
 
-    void post(const uint8_t* data, size_t len);  // world thread
+    void post(const uint8_t* data, size_t len,   // world thread; the second span,
+              const uint8_t* body = nullptr,     // if any, goes right after the first
+              size_t bodyLen = 0);
     void requestClose();                         // world thread
     void disarm();                               // worker thread
 
@@ -99,8 +99,11 @@ namespace world::terrain
 
     FusedTerrain::TilePtr FusedTerrain::TileAt(float x, float y) const
     {
-        const int tx = TileIndex(x);
-        const int ty = TileIndex(y);
+        return TileAtIndex(TileIndex(x), TileIndex(y));
+    }
+
+    FusedTerrain::TilePtr FusedTerrain::TileAtIndex(int tx, int ty) const
+    {
         if (tx < 0 || tx >= GRID_COUNT || ty < 0 || ty >= GRID_COUNT)
         {
             return nullptr;
@@ -227,6 +230,11 @@ namespace world::terrain
         }
     }
 
+    void FusedTerrain::Prefetch(int tx, int ty) const
+    {
+        TileAtIndex(tx, ty);
+    }
+
     size_t FusedTerrain::ResidentTiles() const
     {
         std::shared_lock<std::shared_mutex> lock(m_mutex);
@@ -91,12 +91,18 @@ namespace world::terrain
         void PinCell(int tx, int ty);
         void UnpinCell(int tx, int ty);
 
+        // Reads a cell's tile into the cache ahead of its first query. Safe from any
+        // thread; the grid loader calls it off the map thread so the file read is done
+        // before a player arrives. It does not pin: a tile nobody comes for ages out.
+        void Prefetch(int tx, int ty) const;
+
         size_t ResidentTiles() const;
 
     private:
         using TilePtr = std::shared_ptr<const TerrainTile>;
 
         TilePtr TileAt(float x, float y) const;
+        TilePtr TileAtIndex(int tx, int ty) const;
         TilePtr GlobalWmo() const;
         TilePtr LoadCell(int tx, int ty) const;
         void EvictTile(int tx, int ty) const;
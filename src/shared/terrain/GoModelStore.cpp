@@ -27,18 +27,25 @@ namespace world::terrain
 
     std::shared_ptr<const ICollisionModel> GoModelStore::Get(uint32_t displayId)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        auto found = m_models.find(displayId);
-        if (found != m_models.end())
+        std::string dir;
         {
-            return found->second;
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto found = m_models.find(displayId);
+            if (found != m_models.end())
+            {
+                return found->second;
+            }
+            dir = m_dir;
         }
 
+        // Read outside the lock: the grid preloader warms models from its own threads,
+        // and a map thread asking for a model already held must not wait behind a file.
+        // Two threads may read the same file; the first to insert wins.
         std::shared_ptr<const ICollisionModel> model;
-        if (!m_dir.empty())
+        if (!dir.empty())
         {
-            if (auto tile = ReadTile(m_dir + "/" + GoModelFileName(displayId)))
+            if (auto tile = ReadTile(dir + "/" + GoModelFileName(displayId)))
             {
                 if (!tile->instances.empty())
                 {
@@ -49,7 +56,7 @@ namespace world::terrain
 
         // A null is cached too: it records that this display id has no collision, which
         // is true of most of them, and spares a failed open per spawn.
-        m_models.emplace(displayId, model);
-        return model;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_models.emplace(displayId, model).first->second;
     }
 }
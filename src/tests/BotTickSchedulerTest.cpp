@@ -0,0 +1,165 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "Platform/Define.h"
+
+#include <vector>
+
+#include "BotTickScheduler.h"
+
+TEST(BotTickScheduler_tier_follows_observers)
+{
+    BotTickObservers nobody;
+    CHECK_EQ(int(SelectBotTickTier(nobody)), int(BOT_TICK_IDLE));
+
+    BotTickObservers zone;
+    zone.realPlayerInZone = true;
+    CHECK_EQ(int(SelectBotTickTier(zone)), int(BOT_TICK_REDUCED));
+
+    // An unobserved fight still has to finish
+    BotTickObservers fighting;
+    fighting.inCombat = true;
+    CHECK_EQ(int(SelectBotTickTier(fighting)), int(BOT_TICK_REDUCED));
+
+    BotTickObservers sight = zone;
+    sight.realPlayerInSight = true;
+    CHECK_EQ(int(SelectBotTickTier(sight)), int(BOT_TICK_FULL));
+
+    BotTickObservers grouped;
+    grouped.realPlayerInGroup = true;
+    CHECK_EQ(int(SelectBotTickTier(grouped)), int(BOT_TICK_FULL));
+
+    BotTickObservers invited;
+    invited.pendingPackets = true;
+    CHECK_EQ(int(SelectBotTickTier(invited)), int(BOT_TICK_FULL));
+}
+
+TEST(BotTickScheduler_gate_hands_over_all_elapsed_time)
+{
+    BotTickGate gate;
+    CHECK(gate.Review(50, 2000));
+    CHECK(!gate.Review(50, 2000));
+
+    // Full rate: every update goes through with its own elapsed time
+    CHECK(gate.Advance(50, 0));
+    CHECK_EQ(gate.TakeElapsed(), 50u);
+
+    // A 1000 ms tier lets one update in twenty through, carrying the whole second
+    uint32 runs = 0;
+    uint32 handed = 0;
+    for (uint32 i = 0; i < 100; ++i)
+    {
+        if (gate.Advance(50, 1000))
+        {
+            ++runs;
+            handed += gate.TakeElapsed();
+        }
+    }
+    CHECK_EQ(runs, 5u);
+    CHECK_EQ(handed, 5000u);
+
+    // Reviews come once per period of accumulated time
+    uint32 reviews = 0;
+    for (uint32 i = 0; i < 100; ++i)
+    {
+        reviews += gate.Review(50, 2000) ? 1 : 0;
+    }
+    CHECK_EQ(reviews, 2u);
+}
+
+TEST(BotTickScheduler_accounting_totals_per_tier)
+{
+    BotTickAccounting accounting;
+    accounting.RecordRun(BOT_TICK_FULL, 120);
+    accounting.RecordRun(BOT_TICK_FULL, 80);
+    accounting.RecordSkip(BOT_TICK_IDLE);
+    accounting.RecordSkip(BOT_TICK_IDLE);
+    accounting.RecordRun(BOT_TICK_IDLE, 40);
+
+    BotTickAccounting::Totals full = accounting.Get(BOT_TICK_FULL);
+    CHECK_EQ(full.runs, uint64(2));
+    CHECK_EQ(full.micros, uint64(200));
+    CHECK_EQ(full.skips, uint64(0));
+
+    BotTickAccounting::Totals idle = accounting.Get(BOT_TICK_IDLE);
+    CHECK_EQ(idle.runs, uint64(1));
+    CHECK_EQ(idle.skips, uint64(2));
+
+    accounting.Reset();
+    CHECK_EQ(accounting.Get(BOT_TICK_FULL).runs, uint64(0));
+}
+
+TEST(BotTickScheduler_population_runs_at_tier_rates)
+{
+    // A random bot population spread the way a live realm spreads it: a few bots
+    // near the real players, some more in the zones they are in, the rest alone.
+    // Each world update feeds every bot through its gate at the default intervals.
+    const uint32 BOTS = 2000;
+    const uint32 UPDATES = 400;
+    const uint32 DIFF = 50;
+    const uint32 INTERVALS[BOT_TICK_TIERS] = { 0, 1000, 10000 };
+
+    std::vector<BotTickGate> gates(BOTS);
+    for (uint32 b = 0; b < BOTS; ++b)
+    {
+        BotTickObservers observers;
+        observers.realPlayerInSight = b % 20 == 0;
+        observers.realPlayerInZone = b % 5 == 0;
+        gates[b].SetTier(SelectBotTickTier(observers));
+    }
+
+    BotTickAccounting accounting;
+    for (uint32 u = 0; u < UPDATES; ++u)
+    {
+        for (uint32 b = 0; b < BOTS; ++b)
+        {
+            BotTickTier tier = gates[b].GetTier();
+            if (!gates[b].Advance(DIFF, INTERVALS[tier]))
+            {
+                accounting.RecordSkip(tier);
+                continue;
+            }
+            gates[b].TakeElapsed();
+            accounting.RecordRun(tier, 0);
+        }
+    }
+
+    uint64 runs = 0;
+    uint64 updates = 0;
+    for (int tier = 0; tier < BOT_TICK_TIERS; ++tier)
+    {
+        BotTickAccounting::Totals totals = accounting.Get(BotTickTier(tier));
+        runs += totals.runs;
+        updates += totals.runs + totals.skips;
+    }
+    CHECK_EQ(updates, uint64(BOTS) * UPDATES);
+
+    // 100 bots at full rate, 300 at 1/20, 1600 at 1/200
+    CHECK_EQ(accounting.Get(BOT_TICK_FULL).runs, uint64(100) * UPDATES);
+    CHECK_EQ(accounting.Get(BOT_TICK_REDUCED).runs, uint64(300) * UPDATES / 20);
+    CHECK_EQ(accounting.Get(BOT_TICK_IDLE).runs, uint64(1600) * UPDATES / 200);
+    CHECK(runs * 5 < updates);
+}
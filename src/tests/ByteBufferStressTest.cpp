@@ -29,8 +29,10 @@
 #include "Utilities/ByteBuffer.h"
 
 #include <cstring>
+#include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 /**
@@ -332,3 +334,110 @@ TEST(ByteBufferStress_empty_buffer_survives_every_accessor)
         CHECK(buf.empty());
     }
 }
+
+namespace
+{
+    /// One "tick" of packet traffic: build `sizes.size()` buffers, keep them all alive, drop them.
+    void BuildTick(std::vector<uint32> const& sizes)
+    {
+        std::vector<std::unique_ptr<ByteBuffer> > live;
+        live.reserve(sizes.size());
+        for (size_t i = 0; i < sizes.size(); ++i)
+        {
+            live.emplace_back(new ByteBuffer());
+            for (uint32 written = 0; written < sizes[i]; written += 4)
+            {
+                *live.back() << written;
+            }
+        }
+    }
+}
+
+TEST(ByteBufferStress_steady_state_ticks_do_not_reach_malloc)
+{
+    // Same traffic every tick, from the small update packets up to the large
+    // ones: once the pool has seen a tick, later ticks are served from it.
+    std::mt19937 rng(SEED);
+    std::uniform_int_distribution<uint32> small(1, 200);
+    std::uniform_int_distribution<uint32> large(200, 12000);
+    std::vector<uint32> sizes;
+    for (int i = 0; i < 400; ++i)
+    {
+        sizes.push_back(i % 10 ? small(rng) : large(rng));
+    }
+
+    BuildTick(sizes);
+    BuildTick(sizes);
+
+    PacketBufferPool::Stats before = PacketBufferPool::GetStats();
+    for (int tick = 0; tick < 20; ++tick)
+    {
+        BuildTick(sizes);
+    }
+    PacketBufferPool::Stats after = PacketBufferPool::GetStats();
+
+    CHECK_EQ(after.systemAllocations - before.systemAllocations, uint64(0));
+}
+
+TEST(ByteBufferStress_buffers_freed_on_another_thread_come_back)
+{
+    // The inbound path: the network side builds, a map thread frees. The freeing
+    // thread's cache spills to the shared list and the building thread refills
+    // from it, instead of one allocating forever and the other hoarding.
+    const int rounds = 50;
+    const int perRound = 500;
+
+    PacketBufferPool::Stats before;
+    for (int round = 0; round < rounds; ++round)
+    {
+        if (round == 10)
+        {
+            before = PacketBufferPool::GetStats();
+        }
+
+        std::vector<ByteBuffer*> built;
+        std::thread builder([&built]()
+        {
+            for (int i = 0; i < perRound; ++i)
+            {
+                ByteBuffer* buffer = new ByteBuffer();
+                *buffer << uint32(i) << uint64(i) << std::string(40, 'x');
+                built.push_back(buffer);
+            }
+        });
+        builder.join();
+
+        for (size_t i = 0; i < built.size(); ++i)
+        {
+            uint32 value = 0;
+            *built[i] >> value;
+            if (value != uint32(i))
+            {
+                CHECK_EQ(value, uint32(i));
+            }
+            delete built[i];
+        }
+    }
+    PacketBufferPool::Stats after = PacketBufferPool::GetStats();
+
+    CHECK(after.refills > before.refills);
+    CHECK_EQ(after.systemAllocations - before.systemAllocations, uint64(0));
+}
+
+TEST(ByteBufferStress_move_hands_over_the_storage)
+{
+    ByteBuffer source;
+    source << uint32(0xDEADBEEF) << std::string("payload");
+    uint8 const* storage = source.contents();
+
+    ByteBuffer moved(std::move(source));
+    CHECK(moved.contents() == storage);
+    CHECK(source.empty());
+    CHECK_EQ(source.wpos(), size_t(0));
+
+    uint32 value = 0;
+    std::string text;
+    moved >> value >> text;
+    CHECK_EQ(value, uint32(0xDEADBEEF));
+    CHECK_STR(text.c_str(), "payload");
+}
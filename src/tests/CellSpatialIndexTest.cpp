@@ -0,0 +1,253 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "CellSpatialIndex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace
+{
+    const uint32 MASK_UNIT = 0x0008;
+    const uint32 MASK_PLAYER = 0x0010;
+
+    struct Mob
+    {
+        Mob(uint32 id_, float x_, float y_, float z_, float extent_, uint32 typeMask_)
+            : id(id_), x(x_), y(y_), z(z_), extent(extent_), typeMask(typeMask_), slot(0) {}
+
+        bool InReach(float cx, float cy, float cz, float range, bool is3D) const
+        {
+            float dx = x - cx;
+            float dy = y - cy;
+            float dz = is3D ? z - cz : 0.0f;
+            float limit = range + extent;
+            return dx * dx + dy * dy + dz * dz <= limit * limit;
+        }
+
+        uint32 id;
+        float x, y, z;
+        float extent;
+        uint32 typeMask;
+        uint32 slot;
+    };
+
+    std::vector<uint32> Ids(std::vector<Mob*> const& mobs)
+    {
+        std::vector<uint32> ids;
+        for (Mob const* mob : mobs)
+        {
+            ids.push_back(mob->id);
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+}
+
+TEST(CellSpatialIndex_select_agrees_with_the_plain_test)
+{
+    std::mt19937 rng(0xCE11U);
+    std::uniform_real_distribution<float> coord(0.0f, 66.0f);
+    std::uniform_real_distribution<float> height(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> extent(0.0f, 3.0f);
+    std::uniform_real_distribution<float> range(0.0f, 40.0f);
+
+    // every count from empty to a few vectors' worth, so the scalar tail is tried at each length
+    for (uint32 count = 0; count < 23; ++count)
+    {
+        std::vector<Mob> mobs;
+        for (uint32 i = 0; i < count; ++i)
+        {
+            mobs.push_back(Mob(i, coord(rng), coord(rng), height(rng), extent(rng), (i % 3) ? MASK_UNIT : MASK_UNIT | MASK_PLAYER));
+        }
+
+        CellSpatialIndex<Mob> index;
+        for (Mob& mob : mobs)
+        {
+            mob.slot = index.insert(&mob, mob.x, mob.y, mob.z, mob.extent, mob.typeMask);
+        }
+        REQUIRE(index.size() == count);
+
+        for (int query = 0; query < 50; ++query)
+        {
+            float cx = coord(rng);
+            float cy = coord(rng);
+            float cz = height(rng);
+            float r = range(rng);
+            bool is3D = query % 2 == 0;
+            uint32 wanted = query % 5 == 0 ? MASK_PLAYER : MASK_UNIT;
+
+            std::vector<Mob*> selected;
+            index.select(cx, cy, cz, r, wanted, is3D, selected);
+
+            std::vector<Mob*> expected;
+            for (Mob& mob : mobs)
+            {
+                if ((mob.typeMask & wanted) && mob.InReach(cx, cy, cz, r, is3D))
+                {
+                    expected.push_back(&mob);
+                }
+            }
+
+            CHECK(Ids(selected) == Ids(expected));
+        }
+    }
+}
+
+TEST(CellSpatialIndex_remove_fills_the_slot_from_the_end)
+{
+    std::vector<Mob> mobs;
+    for (uint32 i = 0; i < 6; ++i)
+    {
+        mobs.push_back(Mob(i, float(i), 0.0f, 0.0f, 0.5f, MASK_UNIT));
+    }
+
+    CellSpatialIndex<Mob> index;
+    for (Mob& mob : mobs)
+    {
+        mob.slot = index.insert(&mob, mob.x, mob.y, mob.z, mob.extent, mob.typeMask);
+    }
+
+    // dropping the middle moves the last entry into its place
+    Mob* moved = index.remove(mobs[2].slot);
+    REQUIRE(moved == &mobs[5]);
+    moved->slot = mobs[2].slot;
+    CHECK(index.at(mobs[5].slot) == &mobs[5]);
+    CHECK_EQ(index.size(), 5u);
+
+    // dropping the last moves nothing
+    CHECK(index.remove(mobs[4].slot) == NULL);
+    CHECK_EQ(index.size(), 4u);
+
+    // a move is seen by the next search
+    index.move(mobs[5].slot, 100.0f, 100.0f, 0.0f, 0.5f);
+    std::vector<Mob*> selected;
+    index.select(100.0f, 100.0f, 0.0f, 1.0f, MASK_UNIT, true, selected);
+    REQUIRE(selected.size() == 1u);
+    CHECK(selected[0] == &mobs[5]);
+
+    selected.clear();
+    index.select(0.0f, 0.0f, 0.0f, 10.0f, MASK_UNIT, true, selected);
+    CHECK(Ids(selected) == std::vector<uint32>({ 0, 1, 3 }));
+}
+
+TEST(CellSpatialIndex_benchmark_aoe_three_hundred_mobs)
+{
+    // A dungeon pull gone wrong: 300 mobs packed into the nine cells around the
+    // caster, each one its own allocation as a creature is, and a stream of 8 yard
+    // AoEs dropped at random points among them. The list side is what an area search
+    // did before: walk every mob in the cells and ask it where it is.
+    const uint32 MOBS = 300;
+    const uint32 CELLS = 9;
+    const uint32 CASTS = 20000;
+    const float CELL_SIZE = 533.33333f / 8;
+    const float RADIUS = 8.0f;
+
+    std::mt19937 rng(0xA0EU);
+    std::uniform_real_distribution<float> inCell(0.0f, CELL_SIZE);
+    std::uniform_real_distribution<float> height(0.0f, 5.0f);
+    std::uniform_real_distribution<float> extent(0.3f, 1.5f);
+
+    // padded out so that the mobs lie as far apart as real creatures do
+    struct Creature
+    {
+        Mob mob;
+        char body[1024];
+
+        explicit Creature(Mob const& m) : mob(m) {}
+    };
+
+    std::vector<std::list<Creature*> > cellLists(CELLS);
+    std::vector<CellSpatialIndex<Mob> > cellIndexes(CELLS);
+    std::vector<Creature*> everyone;
+    for (uint32 i = 0; i < MOBS; ++i)
+    {
+        uint32 cell = i % CELLS;
+        float x = float(cell % 3) * CELL_SIZE + inCell(rng);
+        float y = float(cell / 3) * CELL_SIZE + inCell(rng);
+        Creature* creature = new Creature(Mob(i, x, y, height(rng), extent(rng), MASK_UNIT));
+        creature->mob.slot = cellIndexes[cell].insert(&creature->mob, x, y, creature->mob.z, creature->mob.extent, MASK_UNIT);
+        cellLists[cell].push_back(creature);
+        everyone.push_back(creature);
+    }
+
+    std::uniform_real_distribution<float> area(0.0f, 3 * CELL_SIZE);
+    std::vector<float> centers(CASTS * 3);
+    for (uint32 i = 0; i < CASTS; ++i)
+    {
+        centers[i * 3] = area(rng);
+        centers[i * 3 + 1] = area(rng);
+        centers[i * 3 + 2] = height(rng);
+    }
+
+    uint64 indexHits = 0;
+    uint64 listHits = 0;
+    std::vector<Mob*> targets;
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (uint32 cast = 0; cast < CASTS; ++cast)
+    {
+        targets.clear();
+        for (uint32 cell = 0; cell < CELLS; ++cell)
+        {
+            cellIndexes[cell].select(centers[cast * 3], centers[cast * 3 + 1], centers[cast * 3 + 2], RADIUS, MASK_UNIT, true, targets);
+        }
+        indexHits += targets.size();
+    }
+    double indexMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+    for (uint32 cast = 0; cast < CASTS; ++cast)
+    {
+        targets.clear();
+        for (uint32 cell = 0; cell < CELLS; ++cell)
+        {
+            for (Creature* creature : cellLists[cell])
+            {
+                if ((creature->mob.typeMask & MASK_UNIT) && creature->mob.InReach(centers[cast * 3], centers[cast * 3 + 1], centers[cast * 3 + 2], RADIUS, true))
+                {
+                    targets.push_back(&creature->mob);
+                }
+            }
+        }
+        listHits += targets.size();
+    }
+    double listMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    // both sides saw the same casts, so they must have hit the same mobs
+    CHECK_EQ(indexHits, listHits);
+
+    std::printf("    %u mobs x %u casts: packed index %.1f ms, object lists %.1f ms\n",
+                MOBS, CASTS, indexMs, listMs);
+
+    for (Creature* creature : everyone)
+    {
+        delete creature;
+    }
+}
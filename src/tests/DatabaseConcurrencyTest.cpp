@@ -26,9 +26,11 @@
 #include "TestHarness.h"
 #include "Database/QueryResult.h"
 #include "Database/Database.h"
+#include "Database/SqlOperations.h"
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <string>
 #include <thread>
 #include <vector>
@@ -70,7 +72,11 @@ class FakeConnection final : public SqlConnection
             return nullptr;
         }
 
-        bool Execute(const char*) override { return true; }
+        bool Execute(const char* sql) override
+        {
+            executed.push_back(sql);
+            return !failExecute;
+        }
 
         unsigned long escape_string(
             char* to, const char* from,
@@ -95,11 +101,13 @@ class FakeConnection final : public SqlConnection
             active.fetch_sub(1);
         }
 
+        std::vector<std::string> executed;
         std::atomic<int> active{0};
         std::atomic<bool> overlap{false};
         std::atomic<bool> queryEntered{false};
         std::atomic<bool> escapeAttempting{false};
         bool coordinateEscape = false;
+        bool failExecute = false;
 };
 
 class FakeDatabase final : public Database
@@ -114,6 +122,8 @@ class FakeDatabase final : public Database
 
         FakeConnection& Connection() { return *m_connection; }
 
+        void SetMultiRowInsertLimit(uint32 rows) { m_multiRowInsertLimit = rows; }
+
     protected:
         SqlConnection* CreateConnection() override
         {
@@ -163,3 +173,85 @@ TEST(Database_escape_shares_connection_zero_lock)
     escape.join();
     CHECK(!connection.overlap.load());
 }
+
+TEST(Database_multi_row_insert_repeats_the_values_tuple)
+{
+    std::string sql;
+    CHECK(Database::BuildMultiRowInsert(
+        "INSERT INTO `t` (`a`, `b`) VALUES (?, ?)", 3, sql));
+    CHECK(sql == "INSERT INTO `t` (`a`, `b`) VALUES (?, ?), (?, ?), (?, ?)");
+
+    CHECK(Database::BuildMultiRowInsert(
+        "REPLACE INTO `t` (`a`) VALUES (?)", 2, sql));
+    CHECK(sql == "REPLACE INTO `t` (`a`) VALUES (?), (?)");
+}
+
+TEST(Database_multi_row_insert_refuses_other_statements)
+{
+    std::string sql;
+    CHECK(!Database::BuildMultiRowInsert("DELETE FROM `t` WHERE `a` = ?", 2, sql));
+    CHECK(!Database::BuildMultiRowInsert("INSERT INTO `t` (`a`) VALUES (?)", 1, sql));
+    CHECK(!Database::BuildMultiRowInsert(
+        "INSERT INTO `t` (`a`) SELECT `a` FROM `u` WHERE `a` = ?", 2, sql));
+    CHECK(!Database::BuildMultiRowInsert(
+        "INSERT INTO `t` (`a`) VALUES (?) ON DUPLICATE KEY UPDATE `a` = ?", 2, sql));
+    CHECK(!Database::BuildMultiRowInsert(
+        "INSERT INTO `t` (`a`, `b`) VALUES (?, NOW())", 2, sql));
+}
+
+TEST(Database_transaction_merges_runs_of_the_same_insert)
+{
+    FakeDatabase database;
+    database.SetMultiRowInsertLimit(4);
+    FakeConnection& connection = database.Connection();
+
+    static SqlStatementID insertRow;
+    static SqlStatementID deleteRows;
+    SqlStatement insert = database.CreateStatement(insertRow, "INSERT INTO `t` (`a`) VALUES (?)");
+    SqlStatement remove = database.CreateStatement(deleteRows, "DELETE FROM `t` WHERE `g` = ?");
+
+    SqlTransaction trans;
+    SqlStmtParameters* params = new SqlStmtParameters(1);
+    params->addParam(SqlStmtFieldData(uint32(7)));
+    trans.DelayExecute(new SqlPreparedRequest(remove.ID(), params));
+    for (uint32 i = 0; i < 5; ++i)
+    {
+        params = new SqlStmtParameters(1);
+        params->addParam(SqlStmtFieldData(i));
+        trans.DelayExecute(new SqlPreparedRequest(insert.ID(), params));
+    }
+
+    uint32 statements = 0;
+    uint32 rowsMerged = 0;
+    CHECK(trans.ExecuteStatements(&connection, statements, rowsMerged));
+    CHECK(statements == 3);
+    CHECK(rowsMerged == 3);
+    CHECK(connection.executed.size() == 3);
+    CHECK(connection.executed[0] == "DELETE FROM `t` WHERE `g` = '7'");
+    CHECK(connection.executed[1] == "INSERT INTO `t` (`a`) VALUES ('0'), ('1'), ('2'), ('3')");
+    CHECK(connection.executed[2] == "INSERT INTO `t` (`a`) VALUES ('4')");
+}
+
+TEST(Database_failed_transaction_sets_its_failure_flag)
+{
+    FakeDatabase database;
+    FakeConnection& connection = database.Connection();
+
+    static SqlStatementID deleteRow;
+    SqlStatement remove = database.CreateStatement(deleteRow, "DELETE FROM `t` WHERE `g` = ?");
+
+    std::shared_ptr<std::atomic<bool> > failed = std::make_shared<std::atomic<bool> >(false);
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+        SqlTransaction trans;
+        SqlStmtParameters* params = new SqlStmtParameters(1);
+        params->addParam(SqlStmtFieldData(uint32(7)));
+        trans.DelayExecute(new SqlPreparedRequest(remove.ID(), params));
+        trans.SetFailureFlag(failed);
+
+        // the first one commits, the second fails and is rolled back
+        connection.failExecute = attempt == 1;
+        CHECK(trans.ExecuteLocked(&connection) == (attempt == 0));
+        CHECK(failed->load() == (attempt == 1));
+    }
+}
@@ -0,0 +1,286 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "Platform/Define.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "Utilities/ConcurrentRegistry.h"
+#include "Utilities/LockFreeRegistry.h"
+
+namespace
+{
+    struct Entry
+    {
+        uint64 key;
+    };
+
+    typedef MaNGOS::LockFreeRegistry<uint64, Entry> Registry;
+}
+
+TEST(LockFreeRegistry_insert_find_remove)
+{
+    Registry registry;
+    Entry a = { 1 };
+    Entry b = { 2 };
+
+    CHECK(registry.Find(1) == nullptr);
+    registry.Insert(1, &a);
+    registry.Insert(2, &b);
+    CHECK(registry.Find(1) == &a);
+    CHECK(registry.Find(2) == &b);
+    CHECK(registry.Find(3) == nullptr);
+    CHECK_EQ(registry.Size(), size_t(2));
+
+    registry.Remove(1);
+    registry.Remove(3);
+    CHECK(registry.Find(1) == nullptr);
+    CHECK_EQ(registry.Size(), size_t(1));
+
+    // A removed key comes back in its old slot; inserting again replaces the value
+    registry.Insert(1, &b);
+    registry.Insert(1, &a);
+    CHECK(registry.Find(1) == &a);
+    CHECK_EQ(registry.Size(), size_t(2));
+}
+
+TEST(LockFreeRegistry_grows_and_sheds_removed_slots)
+{
+    const uint64 COUNT = 5000;
+    Registry registry;
+    std::vector<Entry> entries(COUNT);
+    for (uint64 i = 0; i < COUNT; ++i)
+    {
+        entries[i].key = i + 1;
+        registry.Insert(i + 1, &entries[i]);
+    }
+    CHECK_EQ(registry.Size(), size_t(COUNT));
+
+    // Log every other one out and back in under a new key, as relogging players do
+    for (uint32 round = 0; round < 4; ++round)
+    {
+        for (uint64 i = 0; i < COUNT; i += 2)
+        {
+            registry.Remove(entries[i].key);
+            entries[i].key += COUNT;
+            registry.Insert(entries[i].key, &entries[i]);
+        }
+    }
+    CHECK_EQ(registry.Size(), size_t(COUNT));
+
+    uint32 found = 0;
+    for (uint64 i = 0; i < COUNT; ++i)
+    {
+        found += registry.Find(entries[i].key) == &entries[i] ? 1 : 0;
+    }
+    CHECK_EQ(found, uint32(COUNT));
+    CHECK(registry.Find(1) == nullptr);
+
+    uint32 visited = 0;
+    registry.ForEach([&visited](Entry*) { ++visited; });
+    CHECK_EQ(visited, uint32(COUNT));
+
+    Entry* hit = registry.FindWith([](uint64 key, Entry*) { return key == 4; });
+    CHECK(hit == &entries[3]);
+}
+
+TEST(LockFreeRegistry_remove_waits_for_open_readers)
+{
+    Registry registry;
+    Entry a = { 1 };
+    registry.Insert(1, &a);
+
+    std::atomic<bool> inside(false);
+    std::atomic<bool> release(false);
+    std::thread reader([&]()
+    {
+        registry.ForEach([&](Entry*)
+        {
+            inside.store(true);
+            while (!release.load())
+            {
+                std::this_thread::yield();
+            }
+        });
+    });
+
+    while (!inside.load())
+    {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> removed(false);
+    std::thread writer([&]()
+    {
+        registry.Remove(1);
+        removed.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    CHECK(!removed.load());
+    CHECK(registry.Find(1) == nullptr);
+
+    release.store(true);
+    reader.join();
+    writer.join();
+    CHECK(removed.load());
+}
+
+TEST(LockFreeRegistry_lookups_during_churn)
+{
+    const uint64 COUNT = 1000;
+    Registry registry;
+    std::vector<Entry> entries(COUNT);
+    for (uint64 i = 0; i < COUNT; ++i)
+    {
+        entries[i].key = i + 1;
+        registry.Insert(i + 1, &entries[i]);
+    }
+
+    std::atomic<bool> stop(false);
+    std::atomic<uint32> wrong(0);
+    std::vector<std::thread> readers;
+    for (uint32 t = 0; t < 3; ++t)
+    {
+        readers.push_back(std::thread([&, t]()
+        {
+            uint64 key = t;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                key = key % (COUNT * 2) + 1;
+                Entry* entry = registry.Find(key);
+                if (entry && entry->key != key)
+                {
+                    wrong.fetch_add(1);
+                }
+            }
+        }));
+    }
+
+    // The odd keys come and go; the even ones must never be missed
+    for (uint32 round = 0; round < 50; ++round)
+    {
+        for (uint64 i = 0; i < COUNT; i += 2)
+        {
+            registry.Remove(i + 1);
+        }
+        for (uint64 i = 0; i < COUNT; i += 2)
+        {
+            registry.Insert(i + 1, &entries[i]);
+        }
+        for (uint64 i = 1; i < COUNT; i += 2)
+        {
+            if (registry.Find(i + 1) != &entries[i])
+            {
+                wrong.fetch_add(1);
+            }
+        }
+    }
+
+    stop.store(true);
+    for (size_t t = 0; t < readers.size(); ++t)
+    {
+        readers[t].join();
+    }
+    CHECK_EQ(wrong.load(), uint32(0));
+}
+
+namespace
+{
+    template <class REGISTRY>
+    double TimeLookups(REGISTRY& registry, uint32 threads, uint32 lookups, uint64 keys)
+    {
+        std::atomic<uint32> ready(0);
+        std::atomic<bool> go(false);
+        std::atomic<uint64> sink(0);
+        std::vector<std::thread> workers;
+        for (uint32 t = 0; t < threads; ++t)
+        {
+            workers.push_back(std::thread([&, t]()
+            {
+                ready.fetch_add(1);
+                while (!go.load())
+                {
+                    std::this_thread::yield();
+                }
+
+                uint64 hits = 0;
+                uint64 key = t;
+                for (uint32 i = 0; i < lookups; ++i)
+                {
+                    key = (key * 7 + 1) % keys + 1;
+                    hits += registry.Find(key) ? 1 : 0;
+                }
+                sink.fetch_add(hits);
+            }));
+        }
+
+        while (ready.load() != threads)
+        {
+            std::this_thread::yield();
+        }
+
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        go.store(true);
+        for (size_t t = 0; t < workers.size(); ++t)
+        {
+            workers[t].join();
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        CHECK_EQ(sink.load(), uint64(threads) * lookups);
+        return ms;
+    }
+}
+
+TEST(LockFreeRegistry_benchmark_contended_lookups)
+{
+    // Map workers looking up players at once: the shared lock's reader count is
+    // written by every lookup, the lock-free table is only read
+    const uint64 KEYS = 3000;
+    const uint32 LOOKUPS = 200000;
+    std::vector<Entry> entries(KEYS);
+    MaNGOS::ConcurrentRegistry<uint64, Entry> locked;
+    Registry lockFree;
+    for (uint64 i = 0; i < KEYS; ++i)
+    {
+        entries[i].key = i + 1;
+        locked.Insert(i + 1, &entries[i]);
+        lockFree.Insert(i + 1, &entries[i]);
+    }
+
+    const uint32 threadCounts[] = { 1, 2, 4, 8 };
+    for (uint32 threads : threadCounts)
+    {
+        double lockedMs = TimeLookups(locked, threads, LOOKUPS, KEYS);
+        double lockFreeMs = TimeLookups(lockFree, threads, LOOKUPS, KEYS);
+        std::printf("    %u threads x %u lookups: shared lock %.1f ms, lock-free %.1f ms\n",
+                    threads, LOOKUPS, lockedMs, lockFreeMs);
+    }
+}
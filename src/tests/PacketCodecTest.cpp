@@ -27,6 +27,7 @@
 
 #include "PacketCodec.h"
 
+#include <algorithm>
 #include <vector>
 
 /**
@@ -348,3 +349,32 @@ TEST(PacketCodec_encode_sizes_the_header_the_way_this_expansion_does)
     CHECK_EQ(int(wire[2]), 0x02);
 #endif
 }
+
+// A broadcast sends EncodeHeader()'s bytes followed by the shared payload, so the two
+// must add up to exactly what Encode() produces -- including under the encryptor,
+// which has to see the same bytes, once.
+TEST(PacketCodec_encode_header_is_the_head_of_encode)
+{
+    WorldPacket packet(0x0123, 4);
+    packet << uint32(0xDEADBEEF);
+
+    int calls = 0;
+    const proto::PacketCodec::HeaderEncryptor encryptor = [&calls](uint8* header, size_t len)
+    {
+        ++calls;
+        for (size_t i = 0; i < len; ++i)
+        {
+            header[i] ^= 0x5A;
+        }
+    };
+
+    const std::vector<uint8> wire = proto::PacketCodec::Encode(packet, encryptor);
+
+    uint8 header[proto::MAX_SERVER_HEADER_SIZE];
+    const size_t headerLen = proto::PacketCodec::EncodeHeader(packet, header, encryptor);
+
+    CHECK_EQ(calls, 2);
+    REQUIRE(headerLen + packet.size() == wire.size());
+    CHECK(std::equal(header, header + headerLen, wire.begin()));
+    CHECK(std::equal(packet.contents(), packet.contents() + packet.size(), wire.begin() + headerLen));
+}
@@ -0,0 +1,247 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "Platform/Define.h"
+
+#include <chrono>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+
+class PlayerbotAI;
+
+#include "NamedObjectContext.h"
+
+using namespace ai;
+
+namespace
+{
+    // Stands in for a bot value: only the parts the contexts touch
+    class FakeValue : public Qualified
+    {
+    public:
+        virtual ~FakeValue() {}
+
+        void Update() {}
+        void Reset() {}
+        std::string const& GetQualifier() const { return qualifier; }
+    };
+
+    FakeValue* MakeValue(PlayerbotAI*) { return new FakeValue(); }
+
+    class FakeValueContext : public NamedObjectContext<FakeValue>
+    {
+    public:
+        FakeValueContext(std::string const& prefix, uint32 count)
+        {
+            for (uint32 i = 0; i < count; ++i)
+            {
+                creators[prefix + " " + std::to_string(i)] = &MakeValue;
+            }
+        }
+    };
+}
+
+TEST(SymbolTable_interns_each_name_once_per_kind)
+{
+    SymbolId health = SymbolTable<FakeValue>::Intern("symbol test health");
+    SymbolId mana = SymbolTable<FakeValue>::Intern(std::string("symbol test mana"));
+
+    CHECK(health != mana);
+    CHECK_EQ(SymbolTable<FakeValue>::Intern("symbol test health"), health);
+    CHECK(SymbolTable<FakeValue>::GetName(mana) == "symbol test mana");
+
+    // Other kinds count from their own start, so a bot's flat arrays stay small
+    SymbolId qualifier = SymbolTable<QualifierSymbol>::Intern("symbol test health");
+    CHECK(SymbolTable<QualifierSymbol>::GetName(qualifier) == "symbol test health");
+    CHECK(qualifier < SymbolTable<QualifierSymbol>::Size());
+}
+
+TEST(SymbolTable_threads_agree_on_ids)
+{
+    const uint32 THREADS = 4;
+    const uint32 NAMES = 500;
+
+    std::vector<std::vector<SymbolId> > seen(THREADS);
+    std::vector<std::thread> threads;
+    for (uint32 t = 0; t < THREADS; ++t)
+    {
+        threads.push_back(std::thread([t, &seen]()
+        {
+            for (uint32 i = 0; i < NAMES; ++i)
+            {
+                seen[t].push_back(SymbolTable<QualifierSymbol>::Intern("threaded " + std::to_string(i)));
+            }
+        }));
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (uint32 t = 1; t < THREADS; ++t)
+    {
+        CHECK(seen[t] == seen[0]);
+    }
+    CHECK(SymbolTable<QualifierSymbol>::GetName(seen[0][42]) == "threaded 42");
+}
+
+TEST(NamedObjectContextList_id_lookups_match_name_lookups)
+{
+    NamedObjectContextList<FakeValue> values;
+    values.Add(new FakeValueContext("first", 10));
+
+    FakeValue* byName = values.GetObject("first 3", NULL);
+    REQUIRE(byName != NULL);
+    CHECK(values.GetObject(SymbolTable<FakeValue>::Intern("first 3"), NULL) == byName);
+    CHECK(values.GetObject("first 3", NULL) == byName);
+
+    // Qualified names reach the same object whichever way they are spelled
+    FakeValue* qualified = values.GetObject("first 4::fireball", NULL);
+    REQUIRE(qualified != NULL);
+    CHECK(qualified->GetQualifier() == "fireball");
+    CHECK(values.GetQualifiedObject(SymbolTable<FakeValue>::Intern("first 4"), SymbolTable<QualifierSymbol>::Intern("fireball"), NULL) == qualified);
+
+    FakeValue* numbered = values.GetNumberedObject(SymbolTable<FakeValue>::Intern("first 4"), 133, NULL);
+    REQUIRE(numbered != NULL);
+    CHECK(numbered->GetQualifier() == "133");
+    CHECK(values.GetObject("first 4::133", NULL) == numbered);
+    CHECK(numbered != qualified);
+
+    // A miss is remembered, until a context that knows the name is added
+    CHECK(values.GetObject("second 1", NULL) == NULL);
+    values.Add(new FakeValueContext("second", 2));
+    CHECK(values.GetObject("second 1", NULL) != NULL);
+}
+
+TEST(NamedObjectContextList_benchmark_bot_ticks)
+{
+    // A random bot population in a headless harness: each bot owns the same value
+    // contexts as the real AiObjectContext does, and every tick asks them for the
+    // values its triggers read, a third of them qualified by a spell name or id.
+    // The string side is what a lookup cost before: format the qualified name, then
+    // walk every context's string map.
+    const uint32 BOTS = 500;
+    const uint32 TICKS = 20;
+    const uint32 READS = 60;
+
+    std::vector<NamedObjectContextList<FakeValue>*> bots;
+    std::vector<std::vector<NamedObjectContext<FakeValue>*> > contexts(BOTS);
+    for (uint32 b = 0; b < BOTS; ++b)
+    {
+        NamedObjectContextList<FakeValue>* list = new NamedObjectContextList<FakeValue>();
+        contexts[b].push_back(new FakeValueContext("class value", 120));
+        contexts[b].push_back(new FakeValueContext("generic value", 200));
+        for (NamedObjectContext<FakeValue>* context : contexts[b])
+        {
+            list->Add(context);
+        }
+        bots.push_back(list);
+    }
+
+    std::vector<std::string> names;
+    std::vector<SymbolId> ids;
+    for (uint32 r = 0; r < READS; ++r)
+    {
+        names.push_back(r % 2 ? "generic value " + std::to_string(r * 3) : "class value " + std::to_string(r));
+        ids.push_back(SymbolTable<FakeValue>::Intern(names.back()));
+    }
+    SymbolId spell = SymbolTable<QualifierSymbol>::Intern("shadow word: pain");
+
+    uint64 stringHits = 0;
+    uint64 idHits = 0;
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (uint32 tick = 0; tick < TICKS; ++tick)
+    {
+        for (uint32 b = 0; b < BOTS; ++b)
+        {
+            for (uint32 r = 0; r < READS; ++r)
+            {
+                std::string name = names[r];
+                if (r % 3 == 1)
+                {
+                    name = name + "::" + "shadow word: pain";
+                }
+                else if (r % 3 == 2)
+                {
+                    std::ostringstream out; out << 589;
+                    name = name + "::" + out.str();
+                }
+
+                for (NamedObjectContext<FakeValue>* context : contexts[b])
+                {
+                    if (context->create(name, NULL))
+                    {
+                        ++stringHits;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    double stringMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+    for (uint32 tick = 0; tick < TICKS; ++tick)
+    {
+        for (uint32 b = 0; b < BOTS; ++b)
+        {
+            for (uint32 r = 0; r < READS; ++r)
+            {
+                FakeValue* value;
+                if (r % 3 == 1)
+                {
+                    value = bots[b]->GetQualifiedObject(ids[r], spell, NULL);
+                }
+                else if (r % 3 == 2)
+                {
+                    value = bots[b]->GetNumberedObject(ids[r], 589, NULL);
+                }
+                else
+                {
+                    value = bots[b]->GetObject(ids[r], NULL);
+                }
+                idHits += value ? 1 : 0;
+            }
+        }
+    }
+    double idMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    // both sides made the same reads, so they must have found the same values
+    CHECK_EQ(idHits, stringHits);
+    CHECK_EQ(idHits, uint64(BOTS) * TICKS * READS);
+
+    std::printf("    %u bots x %u ticks x %u reads: interned ids %.1f ms, string names %.1f ms\n",
+                BOTS, TICKS, READS, idMs, stringMs);
+
+    for (NamedObjectContextList<FakeValue>* list : bots)
+    {
+        delete list;
+    }
+}
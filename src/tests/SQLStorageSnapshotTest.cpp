@@ -0,0 +1,135 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "Database/SQLStorageSnapshot.h"
+#include "Database/Field.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+// A snapshot that replays a row differently from the query it replaced would corrupt
+// a template silently and for good -- every later start trusts it. So: rows must come
+// back column for column, NULL strings must stay NULL, and anything that is not the
+// snapshot written under the current key must be refused rather than half-read.
+
+namespace
+{
+    // the shape of page_text: entry, text, next page
+    const char PAGE_TEXT_FMT[] = "isi";
+
+    struct SnapshotDir
+    {
+        std::filesystem::path path;
+
+        SnapshotDir() : path(std::filesystem::temp_directory_path() / "mangos_snapshot_test")
+        {
+            std::filesystem::remove_all(path);
+            SQLStorageSnapshot::SetDirectory(path.string());
+        }
+
+        ~SnapshotDir()
+        {
+            SQLStorageSnapshot::SetDirectory("");
+            std::error_code error;
+            std::filesystem::remove_all(path, error);
+        }
+    };
+
+    void WritePages(std::string const& key)
+    {
+        SQLStorageSnapshot::Writer writer("page_text", key, PAGE_TEXT_FMT);
+
+        Field first[] = { Field("15", MYSQL_TYPE_LONG), Field("Tear along the dotted line.", MYSQL_TYPE_STRING), Field("16", MYSQL_TYPE_LONG) };
+        Field second[] = { Field("16", MYSQL_TYPE_LONG), Field(NULL, MYSQL_TYPE_STRING), Field("0", MYSQL_TYPE_LONG) };
+        writer.AddRow(first);
+        writer.AddRow(second);
+
+        REQUIRE(writer.Commit(17));
+    }
+}
+
+TEST(SQLStorageSnapshot_replays_the_rows_it_was_given)
+{
+    SnapshotDir dir;
+    std::string key = SQLStorageSnapshot::MakeKey("page_text", PAGE_TEXT_FMT, PAGE_TEXT_FMT, 1234567);
+    WritePages(key);
+
+    SQLStorageSnapshot::Reader reader;
+    REQUIRE(reader.Open("page_text", key, PAGE_TEXT_FMT));
+    CHECK_EQ(reader.GetMaxRecordId(), uint32(17));
+    CHECK_EQ(reader.GetRowCount(), uint32(2));
+
+    REQUIRE(reader.NextRow());
+    CHECK_EQ(reader.GetUInt32(0), uint32(15));
+    CHECK_STR(reader.GetString(1), "Tear along the dotted line.");
+    CHECK_EQ(reader.GetUInt32(2), uint32(16));
+
+    REQUIRE(reader.NextRow());
+    CHECK_EQ(reader.GetUInt32(0), uint32(16));
+    CHECK(reader.GetString(1) == NULL);
+    CHECK_EQ(reader.GetUInt32(2), uint32(0));
+
+    CHECK(!reader.NextRow());
+}
+
+TEST(SQLStorageSnapshot_refuses_a_stale_key)
+{
+    SnapshotDir dir;
+    WritePages(SQLStorageSnapshot::MakeKey("page_text", PAGE_TEXT_FMT, PAGE_TEXT_FMT, 1234567));
+
+    // the table changed, and separately the record layout changed
+    SQLStorageSnapshot::Reader changedTable;
+    CHECK(!changedTable.Open("page_text", SQLStorageSnapshot::MakeKey("page_text", PAGE_TEXT_FMT, PAGE_TEXT_FMT, 1234568), PAGE_TEXT_FMT));
+
+    SQLStorageSnapshot::Reader changedLayout;
+    CHECK(!changedLayout.Open("page_text", SQLStorageSnapshot::MakeKey("page_text", PAGE_TEXT_FMT, "isx", 1234567), PAGE_TEXT_FMT));
+}
+
+TEST(SQLStorageSnapshot_refuses_a_truncated_file)
+{
+    SnapshotDir dir;
+    std::string key = SQLStorageSnapshot::MakeKey("page_text", PAGE_TEXT_FMT, PAGE_TEXT_FMT, 1234567);
+    WritePages(key);
+
+    std::filesystem::path file = dir.path / "page_text.snapshot";
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) - 3);
+
+    SQLStorageSnapshot::Reader reader;
+    CHECK(!reader.Open("page_text", key, PAGE_TEXT_FMT));
+}
+
+TEST(SQLStorageSnapshot_does_nothing_when_disabled)
+{
+    SQLStorageSnapshot::SetDirectory("");
+    CHECK(!SQLStorageSnapshot::IsEnabled());
+
+    SQLStorageSnapshot::Writer writer("page_text", "key", PAGE_TEXT_FMT);
+    CHECK(!writer.Commit(1));
+
+    SQLStorageSnapshot::Reader reader;
+    CHECK(!reader.Open("page_text", "key", PAGE_TEXT_FMT));
+}
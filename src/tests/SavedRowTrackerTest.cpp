@@ -0,0 +1,102 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "SavedRowTracker.h"
+
+// The tracker decides which character rows an autosave may leave alone. Getting it
+// wrong in the lenient direction loses a buff or a cooldown across a relog, and
+// nothing else notices, so each way a row can change between saves is pinned here.
+
+static uint64 Fingerprint(uint32 stacks, int32 remaining)
+{
+    RowFingerprint row;
+    row << stacks << remaining;
+    return row.Value();
+}
+
+TEST(SavedRowTracker_first_save_writes_every_row)
+{
+    SavedRowTracker<uint32> tracker;
+    CHECK(!tracker.IsValid());
+
+    tracker.Begin();
+    CHECK(tracker.Check(1, Fingerprint(1, -1)) == SAVED_ROW_NEW);
+    CHECK(tracker.Check(2, Fingerprint(1, -1)) == SAVED_ROW_NEW);
+
+    std::vector<uint32> gone;
+    tracker.Finish(gone);
+    CHECK(tracker.IsValid());
+    CHECK(gone.empty());
+}
+
+TEST(SavedRowTracker_later_saves_skip_unchanged_rows_and_delete_removed_ones)
+{
+    SavedRowTracker<uint32> tracker;
+    std::vector<uint32> gone;
+
+    tracker.Begin();
+    tracker.Check(1, Fingerprint(1, -1));
+    tracker.Check(2, Fingerprint(1, 30000));
+    tracker.Check(3, Fingerprint(1, -1));
+    tracker.Finish(gone);
+
+    uint64 skipped = SavedRowsSkipped().load();
+
+    tracker.Begin();
+    CHECK(tracker.Check(1, Fingerprint(1, -1)) == SAVED_ROW_UNCHANGED);
+    CHECK(tracker.Check(2, Fingerprint(1, 25000)) == SAVED_ROW_CHANGED);
+    CHECK(tracker.Check(4, Fingerprint(2, -1)) == SAVED_ROW_NEW);
+    tracker.Finish(gone);
+
+    CHECK_EQ(SavedRowsSkipped().load() - skipped, uint64(1));
+    REQUIRE(gone.size() == 1);
+    CHECK_EQ(gone[0], uint32(3));
+
+    // a row that went away and came back is not in the database any more
+    gone.clear();
+    tracker.Begin();
+    CHECK(tracker.Check(3, Fingerprint(1, -1)) == SAVED_ROW_NEW);
+    tracker.Finish(gone);
+    CHECK_EQ(gone.size(), size_t(3));
+}
+
+TEST(SavedRowTracker_invalidate_forces_a_full_rewrite)
+{
+    SavedRowTracker<uint32> tracker;
+    std::vector<uint32> gone;
+
+    tracker.Begin();
+    tracker.Check(1, Fingerprint(1, -1));
+    tracker.Finish(gone);
+
+    tracker.Invalidate();
+    CHECK(!tracker.IsValid());
+
+    tracker.Begin();
+    CHECK(tracker.Check(1, Fingerprint(1, -1)) == SAVED_ROW_NEW);
+    tracker.Finish(gone);
+    CHECK(gone.empty());
+}
@@ -0,0 +1,167 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "ScriptSchedule.h"
+
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Step
+    {
+        Step(uint32 type_, uint32 id_, uint32 source_, uint32 order_) : type(type_), id(id_), source(source_), order(order_) {}
+
+        uint32 GetType() const { return type; }
+        uint32 GetId() const { return id; }
+
+        uint32 type;
+        uint32 id;
+        uint32 source;
+        uint32 order;                                       // when it was scheduled
+    };
+
+    std::vector<uint32> Drain(ScriptSchedule<Step>& schedule, time_t now)
+    {
+        std::vector<uint32> order;
+        while (std::optional<Step> step = schedule.Next(now))
+        {
+            order.push_back(step->order);
+        }
+        return order;
+    }
+}
+
+TEST(ScriptSchedule_runs_by_due_time_then_in_scheduling_order)
+{
+    ScriptSchedule<Step> schedule;
+    schedule.Schedule(12, Step(0, 1, 1, 0));
+    schedule.Schedule(10, Step(0, 1, 1, 1));
+    schedule.Schedule(11, Step(0, 2, 1, 2));
+    schedule.Schedule(10, Step(0, 2, 1, 3));
+    schedule.Schedule(10, Step(0, 1, 2, 4));
+    CHECK_EQ(schedule.size(), 5u);
+
+    CHECK(Drain(schedule, 9).empty());
+    CHECK(Drain(schedule, 10) == std::vector<uint32>({ 1, 3, 4 }));
+
+    // a step scheduled while draining, already due, comes out of the same drain
+    std::optional<Step> step = schedule.Next(11);
+    REQUIRE(step.has_value());
+    CHECK_EQ(step->order, 2u);
+    schedule.Schedule(11, Step(0, 3, 1, 5));
+    CHECK(Drain(schedule, 12) == std::vector<uint32>({ 5, 0 }));
+    CHECK(schedule.empty());
+
+    CHECK_EQ(schedule.GetStats().scheduled, 6u);
+    CHECK_EQ(schedule.GetStats().run, 6u);
+    CHECK_EQ(schedule.GetStats().peak, 5u);
+}
+
+TEST(ScriptSchedule_cancel_drops_only_matching_steps_of_that_script)
+{
+    ScriptSchedule<Step> schedule;
+    uint32 order = 0;
+    for (time_t due = 1; due <= 4; ++due)
+    {
+        for (uint32 source = 1; source <= 3; ++source)
+        {
+            schedule.Schedule(due, Step(0, 7, source, order++));
+            schedule.Schedule(due, Step(1, 7, source, order++));  // another table, same id
+        }
+    }
+
+    auto fromSource = [](uint32 source) { return [source](Step const& step) { return step.source == source; }; };
+
+    CHECK(schedule.Any(0, 7, fromSource(2)));
+    CHECK(!schedule.Any(0, 8, fromSource(2)));
+    CHECK_EQ(schedule.Cancel(0, 7, fromSource(2)), 4u);
+    CHECK(!schedule.Any(0, 7, fromSource(2)));
+    CHECK(schedule.Any(1, 7, fromSource(2)));
+    CHECK_EQ(schedule.Cancel(0, 7, fromSource(2)), 0u);
+    CHECK_EQ(schedule.size(), 20u);
+
+    // what is left still runs in order, and the cancelled steps never do
+    std::vector<uint32> ran = Drain(schedule, 4);
+    CHECK_EQ(ran.size(), 20u);
+    for (size_t i = 1; i < ran.size(); ++i)
+    {
+        CHECK(ran[i - 1] < ran[i]);
+    }
+    CHECK_EQ(schedule.GetStats().cancelled, 4u);
+}
+
+TEST(ScriptSchedule_agrees_with_a_multimap_under_churn)
+{
+    // what Map::ScriptsProcess did before: a multimap by due time, and a scan of all
+    // of it to drop the rest of a script that ended early
+    std::mt19937 rng(0x5C41U);
+    std::uniform_int_distribution<int> roll(0, 99);
+
+    ScriptSchedule<Step> schedule;
+    std::multimap<time_t, Step> reference;
+    uint32 order = 0;
+
+    for (time_t now = 0; now < 400; ++now)
+    {
+        for (int i = roll(rng) % 6; i > 0; --i)
+        {
+            Step step(roll(rng) % 2, roll(rng) % 5, roll(rng) % 4, order++);
+            time_t due = now + roll(rng) % 8;
+            schedule.Schedule(due, step);
+            reference.insert(std::make_pair(due, step));
+        }
+
+        while (std::optional<Step> step = schedule.Next(now))
+        {
+            REQUIRE(!reference.empty() && reference.begin()->first <= now);
+            CHECK_EQ(step->order, reference.begin()->second.order);
+            reference.erase(reference.begin());
+
+            if (roll(rng) < 15)
+            {
+                uint32 source = step->source;
+                auto same = [&](Step const& other) { return other.source == source; };
+                schedule.Cancel(step->type, step->id, same);
+                for (std::multimap<time_t, Step>::iterator itr = reference.begin(); itr != reference.end();)
+                {
+                    if (itr->second.type == step->type && itr->second.id == step->id && same(itr->second))
+                    {
+                        reference.erase(itr++);
+                    }
+                    else
+                    {
+                        ++itr;
+                    }
+                }
+            }
+        }
+
+        REQUIRE(reference.empty() || reference.begin()->first > now);
+        CHECK_EQ(schedule.size(), reference.size());
+    }
+}
@@ -0,0 +1,174 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "StartupLoader.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The loader replaces a hand-ordered sequence whose ordering comments were the
+// only thing keeping, say, spell learn skills after spell chains. What matters
+// is that a stage never starts before the stages it names, with any number of
+// threads, and that one thread is the old sequence exactly.
+
+namespace
+{
+    // one log of "+name" on entry and "-name" on exit, in the order they happened
+    struct Journal
+    {
+        std::mutex mutex;
+        std::vector<std::string> events;
+
+        StartupLoader::Step Stage(char const* name)
+        {
+            return [this, name]
+            {
+                Record(std::string("+") + name);
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                Record(std::string("-") + name);
+            };
+        }
+
+        void Record(std::string const& event)
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            events.push_back(event);
+        }
+
+        size_t Position(std::string const& event) const
+        {
+            for (size_t i = 0; i < events.size(); ++i)
+            {
+                if (events[i] == event)
+                {
+                    return i;
+                }
+            }
+            return events.size();
+        }
+
+        bool FinishedBeforeStart(char const* before, char const* after) const
+        {
+            return Position(std::string("-") + before) < Position(std::string("+") + after);
+        }
+    };
+
+    void Declare(StartupLoader& loader, Journal& journal)
+    {
+        loader.Add("chains",      journal.Stage("chains"));
+        loader.Add("items",       journal.Stage("items"));
+        loader.Add("learn",       journal.Stage("learn"),     { "chains" });
+        loader.Add("creatures",   journal.Stage("creatures"), { "items" });
+        loader.Add("quests",      journal.Stage("quests"),    { "items", "creatures" });
+        loader.Add("texts",       journal.Stage("texts"));
+        loader.Add("events",      journal.Stage("events"),    { "quests", "learn" });
+    }
+}
+
+TEST(StartupLoader_one_thread_runs_the_declared_sequence)
+{
+    Journal journal;
+    StartupLoader loader;
+    Declare(loader, journal);
+
+    loader.Run(1, NULL);
+
+    char const* expected[] = { "chains", "items", "learn", "creatures", "quests", "texts", "events" };
+    REQUIRE(journal.events.size() == 14);
+    for (size_t i = 0; i < 7; ++i)
+    {
+        CHECK_STR(journal.events[2 * i], std::string("+") + expected[i]);
+        CHECK_STR(journal.events[2 * i + 1], std::string("-") + expected[i]);
+    }
+}
+
+TEST(StartupLoader_parallel_run_respects_every_prerequisite)
+{
+    for (int round = 0; round < 20; ++round)
+    {
+        Journal journal;
+        StartupLoader loader;
+        Declare(loader, journal);
+
+        loader.Run(4, NULL);
+
+        REQUIRE(journal.events.size() == 14);
+        CHECK(journal.FinishedBeforeStart("chains", "learn"));
+        CHECK(journal.FinishedBeforeStart("items", "creatures"));
+        CHECK(journal.FinishedBeforeStart("creatures", "quests"));
+        CHECK(journal.FinishedBeforeStart("quests", "events"));
+        CHECK(journal.FinishedBeforeStart("learn", "events"));
+    }
+}
+
+TEST(StartupLoader_independent_stages_overlap)
+{
+    // each waits until the other has started: only possible if both run at once
+    std::atomic<int> arrived(0);
+    std::atomic<bool> overlapped(true);
+    StartupLoader::Step meet = [&]
+    {
+        ++arrived;
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (arrived.load() < 2)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                overlapped = false;
+                return;
+            }
+            std::this_thread::yield();
+        }
+    };
+
+    StartupLoader loader;
+    loader.Add("left", meet);
+    loader.Add("right", meet);
+    loader.Run(2, NULL);
+
+    CHECK(overlapped.load());
+}
+
+TEST(StartupLoader_critical_path_follows_the_slowest_chain)
+{
+    StartupLoader loader;
+    loader.Add("fast", [] {});
+    loader.Add("slow", [] { std::this_thread::sleep_for(std::chrono::milliseconds(30)); });
+    loader.Add("after both", [] {}, { "fast", "slow" });
+    loader.Run(2, NULL);
+
+    std::vector<StartupLoader::StageTiming> timings = loader.GetTimings();
+    REQUIRE(timings.size() == 3);
+    CHECK(timings[1].ms >= 25);
+    CHECK(timings[2].pathMs >= timings[1].ms);
+    CHECK(timings[2].pathMs >= timings[0].pathMs);
+
+    loader.LogReport();
+}
@@ -0,0 +1,285 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "ThreatHeap.h"
+
+#include <chrono>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Attacker : public ThreatHeapNode
+    {
+        explicit Attacker(uint32 id_) : id(id_), threat(0.0f) {}
+
+        float getThreat() const { return threat; }
+
+        uint32 id;
+        float threat;
+    };
+
+    std::vector<Attacker*> WalkAll(ThreatHeap<Attacker> const& heap)
+    {
+        std::vector<Attacker*> order;
+        ThreatHeap<Attacker>::Walk walk(heap);
+        while (Attacker* next = walk.next())
+        {
+            order.push_back(next);
+        }
+        return order;
+    }
+
+    bool Descending(std::vector<Attacker*> const& order)
+    {
+        for (size_t i = 1; i < order.size(); ++i)
+        {
+            if (order[i - 1]->threat < order[i]->threat)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST(ThreatHeap_top_follows_threat_changes)
+{
+    std::vector<Attacker> attackers;
+    for (uint32 i = 0; i < 5; ++i)
+    {
+        attackers.push_back(Attacker(i));
+    }
+
+    ThreatHeap<Attacker> heap;
+    for (Attacker& attacker : attackers)
+    {
+        heap.push(&attacker);
+    }
+
+    // all on zero threat: the first to join is on top
+    CHECK_EQ(heap.top()->id, 0u);
+
+    attackers[3].threat = 50.0f;
+    heap.reposition(&attackers[3]);
+    CHECK_EQ(heap.top()->id, 3u);
+
+    attackers[1].threat = 50.0f;
+    heap.reposition(&attackers[1]);
+    CHECK_EQ(heap.top()->id, 1u);                           // a tie goes to who joined first
+
+    attackers[1].threat = 0.0f;
+    heap.reposition(&attackers[1]);
+    CHECK_EQ(heap.top()->id, 3u);
+
+    heap.remove(&attackers[3]);
+    CHECK(!heap.contains(&attackers[3]));
+    CHECK_EQ(heap.size(), 4u);
+    CHECK_EQ(heap.top()->id, 0u);
+
+    heap.remove(&attackers[3]);                             // not in the heap any more: ignored
+    CHECK_EQ(heap.size(), 4u);
+
+    ThreatHeap<Attacker> other;
+    CHECK(!other.contains(&attackers[0]));
+}
+
+TEST(ThreatHeap_walk_visits_in_descending_order)
+{
+    std::mt19937 rng(0x7EA7U);
+    std::uniform_int_distribution<int> roll(0, 99);
+
+    std::vector<Attacker> attackers;
+    for (uint32 i = 0; i < 40; ++i)
+    {
+        attackers.push_back(Attacker(i));
+    }
+
+    ThreatHeap<Attacker> heap;
+    for (Attacker& attacker : attackers)
+    {
+        heap.push(&attacker);
+    }
+
+    for (int round = 0; round < 500; ++round)
+    {
+        Attacker& attacker = attackers[roll(rng) % attackers.size()];
+        if (roll(rng) < 10)
+        {
+            if (heap.contains(&attacker))
+            {
+                heap.remove(&attacker);
+            }
+            else
+            {
+                heap.push(&attacker);
+            }
+        }
+        else
+        {
+            // coarse values, so that ties are common
+            attacker.threat = float(roll(rng) / 10);
+            heap.reposition(&attacker);
+        }
+
+        std::vector<Attacker*> walked = WalkAll(heap);
+        std::vector<Attacker*> sorted;
+        heap.sortInto(sorted);
+
+        REQUIRE(walked.size() == heap.size());
+        CHECK(Descending(walked));
+        CHECK(walked == sorted);
+        CHECK(heap.top() == (walked.empty() ? NULL : walked.front()));
+    }
+
+    // a restarted walk starts over from the top
+    ThreatHeap<Attacker>::Walk walk(heap);
+    Attacker* first = walk.next();
+    walk.next();
+    walk.restart();
+    CHECK(walk.next() == first);
+}
+
+TEST(ThreatHeap_entry_moves_between_online_and_offline_heaps)
+{
+    // ThreatManager's two containers: an attacker goes offline, comes back
+    // online, and is then dropped from the threat list altogether
+    std::vector<Attacker> attackers;
+    for (uint32 i = 0; i < 6; ++i)
+    {
+        attackers.push_back(Attacker(i));
+        attackers.back().threat = float(10 * i);
+    }
+
+    ThreatHeap<Attacker> online;
+    ThreatHeap<Attacker> offline;
+    for (uint32 i = 0; i < 3; ++i)
+    {
+        online.push(&attackers[i]);
+    }
+    for (uint32 i = 3; i < 6; ++i)
+    {
+        offline.push(&attackers[i]);
+    }
+
+    // offline -> online: out of the old heap before going into the new one
+    Attacker* back = &attackers[4];
+    offline.remove(back);
+    online.push(back);
+    CHECK(online.contains(back));
+    CHECK(!offline.contains(back));
+    CHECK_EQ(online.size(), size_t(4));
+    CHECK_EQ(offline.size(), size_t(2));
+    CHECK_EQ(online.top()->id, 4u);
+
+    // and removed: neither heap may keep a pointer to it
+    online.remove(back);
+    CHECK(!online.contains(back));
+    CHECK_EQ(online.size(), size_t(3));
+    for (Attacker* entry : online.entries())
+    {
+        CHECK(entry != back);
+        CHECK(online.contains(entry));
+    }
+    for (Attacker* entry : offline.entries())
+    {
+        CHECK(entry != back);
+        CHECK(offline.contains(entry));
+    }
+    CHECK(Descending(WalkAll(online)));
+    CHECK(Descending(WalkAll(offline)));
+    CHECK_EQ(online.top()->id, 2u);
+    CHECK_EQ(offline.top()->id, 5u);
+}
+
+TEST(ThreatHeap_benchmark_eighty_attackers)
+{
+    // A raid boss: 80 attackers, every one of them generating threat on every
+    // tick, and the boss asking for its most hated target after each tick. The
+    // list side is what ThreatContainer did before: sort the whole list whenever
+    // anything gained threat.
+    const uint32 ATTACKERS = 80;
+    const uint32 TICKS = 20000;
+
+    std::mt19937 rng(0xB055U);
+    std::uniform_real_distribution<float> gain(0.0f, 100.0f);
+
+    std::vector<float> gains(ATTACKERS * 64);
+    for (float& g : gains)
+    {
+        g = gain(rng);
+    }
+
+    std::vector<Attacker> heapSide;
+    std::vector<Attacker> listSide;
+    for (uint32 i = 0; i < ATTACKERS; ++i)
+    {
+        heapSide.push_back(Attacker(i));
+        listSide.push_back(Attacker(i));
+    }
+
+    ThreatHeap<Attacker> heap;
+    std::list<Attacker*> list;
+    for (uint32 i = 0; i < ATTACKERS; ++i)
+    {
+        heap.push(&heapSide[i]);
+        list.push_back(&listSide[i]);
+    }
+
+    uint64 heapSum = 0;
+    uint64 listSum = 0;
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (uint32 tick = 0; tick < TICKS; ++tick)
+    {
+        for (uint32 i = 0; i < ATTACKERS; ++i)
+        {
+            heapSide[i].threat += gains[(tick * ATTACKERS + i) % gains.size()];
+            heap.reposition(&heapSide[i]);
+        }
+        heapSum += heap.top()->id;
+    }
+    double heapMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+    for (uint32 tick = 0; tick < TICKS; ++tick)
+    {
+        for (uint32 i = 0; i < ATTACKERS; ++i)
+        {
+            listSide[i].threat += gains[(tick * ATTACKERS + i) % gains.size()];
+        }
+        list.sort([](Attacker const* lhs, Attacker const* rhs) { return lhs->threat > rhs->threat; });
+        listSum += list.front()->id;
+    }
+    double listMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    // both sides saw the same fight, so they must have picked the same targets
+    CHECK_EQ(heapSum, listSum);
+
+    std::printf("    %u attackers x %u ticks: heap %.1f ms, sorted list %.1f ms\n",
+                ATTACKERS, TICKS, heapMs, listMs);
+}
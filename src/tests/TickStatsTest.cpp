@@ -0,0 +1,134 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "Platform/Define.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "TickStats.h"
+
+TEST(TickStats_histogram_buckets_by_power_of_two)
+{
+    CHECK_EQ(TickHistogram::GetBucket(0), 0u);
+    CHECK_EQ(TickHistogram::GetBucket(15), 0u);
+    CHECK_EQ(TickHistogram::GetBucket(16), 1u);
+    CHECK_EQ(TickHistogram::GetBucket(1000), 6u);
+    CHECK_EQ(TickHistogram::GetBucket(0xFFFFFFFF), uint32(TICK_HISTOGRAM_BUCKETS - 1));
+
+    TickHistogram histogram;
+    for (uint32 i = 0; i < 98; ++i)
+    {
+        histogram.Add(100);
+    }
+    histogram.Add(5000);
+    histogram.Add(40000);
+
+    CHECK_EQ(histogram.GetCount(), uint64(100));
+    CHECK_EQ(histogram.GetTotal(), uint64(98 * 100 + 5000 + 40000));
+    CHECK_EQ(histogram.GetMax(), 40000u);
+    CHECK_EQ(histogram.GetPercentile(50), 128u);
+    CHECK_EQ(histogram.GetPercentile(99), 8192u);
+    CHECK_EQ(histogram.GetPercentile(100), 40000u);
+
+    TickHistogram other;
+    other.Add(70000);
+    histogram.Merge(other);
+    CHECK_EQ(histogram.GetCount(), uint64(101));
+    CHECK_EQ(histogram.GetMax(), 70000u);
+
+    histogram.Reset();
+    CHECK_EQ(histogram.GetCount(), uint64(0));
+    CHECK_EQ(histogram.GetPercentile(99), 0u);
+}
+
+TEST(TickStats_lap_timer_sums_a_phase_once_per_update)
+{
+    TickStatsRecorder recorder;
+    for (uint32 update = 0; update < 3; ++update)
+    {
+        TickLapTimer lap(recorder);
+        lap.Lap(TICK_PHASE_MAP_SESSIONS);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        lap.Lap(TICK_PHASE_MAP_CELLS);
+        lap.Lap(TICK_PHASE_MAP_SESSIONS);
+        lap.Finish(TICK_PHASE_MAP_TOTAL);
+    }
+
+    CHECK_EQ(recorder.phases[TICK_PHASE_MAP_SESSIONS].GetCount(), uint64(3));
+    CHECK_EQ(recorder.phases[TICK_PHASE_MAP_CELLS].GetCount(), uint64(3));
+    CHECK_EQ(recorder.phases[TICK_PHASE_MAP_TOTAL].GetCount(), uint64(3));
+    CHECK_EQ(recorder.phases[TICK_PHASE_MAP_SCRIPTS].GetCount(), uint64(0));
+
+    // The sleep lands in the cells phase, and the total covers every lap
+    CHECK(recorder.phases[TICK_PHASE_MAP_CELLS].GetTotal() >= 3 * 2000);
+    CHECK(recorder.phases[TICK_PHASE_MAP_TOTAL].GetTotal() >=
+          recorder.phases[TICK_PHASE_MAP_CELLS].GetTotal() + recorder.phases[TICK_PHASE_MAP_SESSIONS].GetTotal());
+}
+
+TEST(TickStats_registry_sums_per_instance_and_sorts_busiest_first)
+{
+    TickStatsRegistry registry;
+    TickStatsRecorder quiet;
+    TickStatsRecorder busy;
+    TickStatsRecorder world;
+
+    quiet.phases[TICK_PHASE_MAP_TOTAL].Add(100);
+    busy.phases[TICK_PHASE_MAP_TOTAL].Add(3000);
+    busy.phases[TICK_PHASE_MAP_CELLS].Add(2500);
+    world.phases[TICK_PHASE_WORLD_TOTAL].Add(5000);
+    busy.sinceHandOver = 1000;
+
+    registry.HandOver(0, 0, quiet);
+    registry.HandOver(409, 7, busy);
+    CHECK_EQ(busy.phases[TICK_PHASE_MAP_TOTAL].GetCount(), uint64(0));
+    CHECK_EQ(busy.sinceHandOver, 0u);
+
+    // A second hand over of the same instance adds to its entry
+    busy.phases[TICK_PHASE_MAP_TOTAL].Add(1000);
+    registry.HandOver(409, 7, busy);
+    registry.HandOver(TICK_STATS_WORLD, 0, world);
+
+    uint32 seconds = 1;
+    CHECK(registry.GetLastWindow(seconds).empty());
+    CHECK_EQ(seconds, 0u);
+
+    registry.Rotate(60000);
+    std::vector<TickStatsEntry> window = registry.GetLastWindow(seconds);
+    CHECK_EQ(seconds, 60u);
+    REQUIRE(window.size() == 3);
+    CHECK_EQ(window[0].mapId, uint32(TICK_STATS_WORLD));
+    CHECK_EQ(window[1].mapId, 409u);
+    CHECK_EQ(window[1].instanceId, 7u);
+    CHECK_EQ(window[1].GetTotal(), uint64(4000));
+    CHECK_EQ(window[1].phases[TICK_PHASE_MAP_TOTAL].GetCount(), uint64(2));
+    CHECK_EQ(window[2].mapId, 0u);
+
+    // The next window starts empty
+    registry.Rotate(60000);
+    CHECK(registry.GetLastWindow(seconds).empty());
+}
@@ -51,6 +51,7 @@
 #include <filesystem>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace world::terrain;
@@ -562,3 +563,39 @@ TEST(FusedTerrainSweepDropsUnpinnedTilesAndKeepsPinnedOnes)
     std::remove(b.c_str());
     FusedTerrain::SetTileDir(std::string());
 }
+
+TEST(FusedTerrainPrefetchReadsTheTileAheadOfItsFirstQuery)
+{
+    const std::string dir = TempPath("prefetchdir");
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+
+    TerrainTile tile = MakeTile();
+    tile.instances.clear();
+    for (float& h : tile.v9) { h = 10.f; }
+    for (float& h : tile.v8) { h = 10.f; }
+    tile.holes.fill(0);
+    tile.tx = 32; tile.ty = 32;
+
+    const std::string path = dir + "/" + TileFileName(7777, 32, 32);
+    REQUIRE(WriteTile(tile, path));
+
+    FusedTerrain::SetTileDir(dir);
+    FusedTerrain terrain(7777);
+
+    // From another thread, as the grid preloader does it.
+    std::thread reader([&terrain] { terrain.Prefetch(32, 32); });
+    reader.join();
+    CHECK_EQ(terrain.ResidentTiles(), size_t(1));
+
+    // The file is gone; the query is served from what the prefetch read.
+    std::remove(path.c_str());
+    CHECK(!terrain.ColumnAt(-1.f, -1.f, 50.f, -10000.f).Empty());
+
+    // Out of range is ignored, and a prefetch pins nothing: the sweep takes it.
+    terrain.Prefetch(-1, FusedTerrain::GRID_COUNT);
+    terrain.Update(10u * 60u * 1000u);
+    CHECK_EQ(terrain.ResidentTiles(), size_t(0));
+
+    FusedTerrain::SetTileDir(std::string());
+}
@@ -0,0 +1,183 @@
+/**
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2026 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TestHarness.h"
+#include "Platform/Define.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Trace.h"
+
+namespace
+{
+    size_t CountOf(std::string const& text, std::string const& what)
+    {
+        size_t count = 0;
+        for (size_t at = text.find(what); at != std::string::npos; at = text.find(what, at + what.size()))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    // Runs on a thread of its own, so its ring holds only what the test wrote
+    template<class F> void OnThread(F work)
+    {
+        std::thread thread(work);
+        thread.join();
+    }
+}
+
+TEST(Trace_records_nothing_while_off)
+{
+    Trace::SetEnabled(false);
+    OnThread([]()
+    {
+        Trace::SetThreadName("trace test off");
+        for (uint32 i = 0; i < 100; ++i)
+        {
+            TRACE_SCOPE("trace test quiet span");
+        }
+    });
+
+    std::string json;
+    Trace::WriteChromeTrace(json, 0);
+    CHECK_EQ(CountOf(json, "trace test quiet span"), size_t(0));
+    CHECK_EQ(CountOf(json, "trace test off"), size_t(0));
+}
+
+TEST(Trace_spans_export_as_nested_begin_end_pairs)
+{
+    Trace::SetEnabled(true);
+    OnThread([]()
+    {
+        Trace::SetThreadName("trace test nesting");
+        TRACE_SCOPE("trace test outer");
+        for (uint32 i = 0; i < 3; ++i)
+        {
+            TRACE_SCOPE("trace test inner");
+        }
+    });
+    Trace::SetEnabled(false);
+
+    std::string json;
+    Trace::WriteChromeTrace(json, 0);
+    CHECK_EQ(CountOf(json, "\"trace test nesting\""), size_t(1));
+    CHECK_EQ(CountOf(json, "\"name\":\"trace test outer\",\"ph\":\"B\""), size_t(1));
+    CHECK_EQ(CountOf(json, "\"name\":\"trace test outer\",\"ph\":\"E\""), size_t(1));
+    CHECK_EQ(CountOf(json, "\"name\":\"trace test inner\",\"ph\":\"B\""), size_t(3));
+    CHECK_EQ(CountOf(json, "\"name\":\"trace test inner\",\"ph\":\"E\""), size_t(3));
+
+    // The outer span opens before and closes after every inner one
+    CHECK(json.find("trace test outer\",\"ph\":\"B\"") < json.find("trace test inner"));
+    CHECK(json.rfind("trace test outer\",\"ph\":\"E\"") > json.rfind("trace test inner"));
+    CHECK(json.compare(json.size() - 3, 3, "]}\n") == 0);
+}
+
+TEST(Trace_ring_keeps_the_latest_events_and_an_open_span)
+{
+    Trace::SetEnabled(true);
+    OnThread([]()
+    {
+        Trace::SetThreadName("trace test wrap");
+        TRACE_SCOPE("trace test stuck");
+        for (uint32 i = 0; i < 20000; ++i)
+        {
+            TRACE_SCOPE("trace test flood");
+        }
+
+        // Still inside "stuck", as a wedged thread would be
+        std::string json;
+        Trace::WriteChromeTrace(json, 0);
+
+        // The ring wrapped: its oldest events are gone, and the ends that lost
+        // their begin are not written
+        size_t begins = CountOf(json, "\"name\":\"trace test flood\",\"ph\":\"B\"");
+        size_t ends = CountOf(json, "\"name\":\"trace test flood\",\"ph\":\"E\"");
+        CHECK(begins > 8000 && begins <= 8192);
+        CHECK_EQ(begins, ends);
+
+        // The stuck begin went with them, but the span is still written open,
+        // ahead of the flood it encloses
+        CHECK_EQ(CountOf(json, "\"name\":\"trace test stuck\",\"ph\":\"B\""), size_t(1));
+        CHECK_EQ(CountOf(json, "\"name\":\"trace test stuck\",\"ph\":\"E\""), size_t(0));
+        CHECK(json.find("trace test stuck") < json.find("trace test flood"));
+
+        // Also when it began before the window asked for
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        Trace::WriteChromeTrace(json, 5);
+        CHECK_EQ(CountOf(json, "\"name\":\"trace test stuck\",\"ph\":\"B\""), size_t(1));
+    });
+
+    OnThread([]()
+    {
+        Trace::SetThreadName("trace test open");
+        Trace::Begin("trace test open span");
+
+        std::string json;
+        Trace::WriteChromeTrace(json, 0);
+        CHECK_EQ(CountOf(json, "\"name\":\"trace test open span\",\"ph\":\"B\""), size_t(1));
+        CHECK_EQ(CountOf(json, "\"name\":\"trace test open span\",\"ph\":\"E\""), size_t(0));
+    });
+    Trace::SetEnabled(false);
+}
+
+TEST(Trace_export_while_threads_record)
+{
+    Trace::SetEnabled(true);
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> writers;
+    for (uint32 t = 0; t < 4; ++t)
+    {
+        writers.push_back(std::thread([&stop]()
+        {
+            Trace::SetThreadName("trace test writer");
+            while (!stop.load())
+            {
+                TRACE_SCOPE("trace test busy");
+            }
+        }));
+    }
+
+    uint32 written = 0;
+    for (uint32 i = 0; i < 20; ++i)
+    {
+        std::string json;
+        written = Trace::WriteChromeTrace(json, 0);
+        CHECK(CountOf(json, "\"ph\":\"B\"") >= CountOf(json, "\"ph\":\"E\""));
+    }
+
+    stop.store(true);
+    for (size_t t = 0; t < writers.size(); ++t)
+    {
+        writers[t].join();
+    }
+    Trace::SetEnabled(false);
+    CHECK(written > 0);
+}